@@ -53,6 +53,11 @@ void UOmniRuntimeSystem::HandleEvent_Implementation(const FOmniEventMessage& Eve
 	(void)Event;
 }
 
+void UOmniRuntimeSystem::SaveState(FArchive& Ar)
+{
+	(void)Ar;
+}
+
 bool UOmniRuntimeSystem::IsInitializationSuccessful() const
 {
 	return bInitializationSuccessful;
@@ -9,6 +9,7 @@ namespace OmniMessageSchema
 	const FName CommandStartAction(TEXT("StartAction"));
 	const FName CommandStopAction(TEXT("StopAction"));
 	const FName CommandSetSprinting(TEXT("SetSprinting"));
+	const FName CommandSetSprintRequested(TEXT("SetSprintRequested"));
 	const FName QueryCanStartAction(TEXT("CanStartAction"));
 	const FName QueryIsExhausted(TEXT("IsExhausted"));
 	const FName QueryGetStateTagsCsv(TEXT("GetStateTagsCsv"));
@@ -211,6 +212,59 @@ bool FOmniSetSprintingCommandSchema::Validate(const FOmniCommandMessage& Message
 	return true;
 }
 
+FOmniCommandMessage FOmniSetSprintRequestedCommandSchema::ToMessage(const FOmniSetSprintRequestedCommandSchema& Data)
+{
+	FOmniCommandMessage Message;
+	Message.SourceSystem = Data.SourceSystem;
+	Message.TargetSystem = OmniMessageSchema::SystemMovement;
+	Message.CommandName = OmniMessageSchema::CommandSetSprintRequested;
+	Message.Arguments.Add(TEXT("bRequested"), Data.bRequested ? TEXT("True") : TEXT("False"));
+	return Message;
+}
+
+bool FOmniSetSprintRequestedCommandSchema::TryFromMessage(
+	const FOmniCommandMessage& Message,
+	FOmniSetSprintRequestedCommandSchema& OutData,
+	FString& OutError
+)
+{
+	if (!Validate(Message, OutError))
+	{
+		return false;
+	}
+
+	bool bRequested = false;
+	TryParseBool(Message.Arguments.FindChecked(TEXT("bRequested")), bRequested);
+
+	OutData.SourceSystem = Message.SourceSystem;
+	OutData.bRequested = bRequested;
+	return true;
+}
+
+bool FOmniSetSprintRequestedCommandSchema::Validate(const FOmniCommandMessage& Message, FString& OutError)
+{
+	if (Message.TargetSystem != OmniMessageSchema::SystemMovement || Message.CommandName != OmniMessageSchema::CommandSetSprintRequested)
+	{
+		OutError = TEXT("Command schema mismatch for SetSprintRequested.");
+		return false;
+	}
+
+	FString RequestedValue;
+	if (!TryGetRequiredValue(Message.Arguments, TEXT("bRequested"), RequestedValue, OutError))
+	{
+		return false;
+	}
+
+	bool bParsedValue = false;
+	if (!TryParseBool(RequestedValue, bParsedValue))
+	{
+		OutError = TEXT("Invalid boolean value for bRequested.");
+		return false;
+	}
+
+	return true;
+}
+
 FOmniQueryMessage FOmniCanStartActionQuerySchema::ToMessage(const FOmniCanStartActionQuerySchema& Data)
 {
 	FOmniQueryMessage Message;
@@ -461,6 +515,10 @@ bool FOmniMessageSchemaValidator::ValidateCommand(const FOmniCommandMessage& Mes
 	{
 		return FOmniSetSprintingCommandSchema::Validate(Message, OutError);
 	}
+	if (Message.TargetSystem == OmniMessageSchema::SystemMovement && Message.CommandName == OmniMessageSchema::CommandSetSprintRequested)
+	{
+		return FOmniSetSprintRequestedCommandSchema::Validate(Message, OutError);
+	}
 
 	return true;
 }
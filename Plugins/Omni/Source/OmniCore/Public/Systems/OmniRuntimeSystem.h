@@ -43,6 +43,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Omni|System")
 	bool IsInitializationSuccessful() const;
 
+	// Writes the simulation state that must match across deterministic replays (no pointers, caches or telemetry).
+	virtual void SaveState(FArchive& Ar);
+
 protected:
 	void SetInitializationResult(bool bSuccess);
 
@@ -12,6 +12,7 @@ namespace OmniMessageSchema
 	OMNICORE_API extern const FName CommandStartAction;
 	OMNICORE_API extern const FName CommandStopAction;
 	OMNICORE_API extern const FName CommandSetSprinting;
+	OMNICORE_API extern const FName CommandSetSprintRequested;
 	OMNICORE_API extern const FName QueryCanStartAction;
 	OMNICORE_API extern const FName QueryIsExhausted;
 	OMNICORE_API extern const FName QueryGetStateTagsCsv;
@@ -50,6 +51,16 @@ struct OMNICORE_API FOmniSetSprintingCommandSchema
 	static bool Validate(const FOmniCommandMessage& Message, FString& OutError);
 };
 
+struct OMNICORE_API FOmniSetSprintRequestedCommandSchema
+{
+	FName SourceSystem = NAME_None;
+	bool bRequested = false;
+
+	static FOmniCommandMessage ToMessage(const FOmniSetSprintRequestedCommandSchema& Data);
+	static bool TryFromMessage(const FOmniCommandMessage& Message, FOmniSetSprintRequestedCommandSchema& OutData, FString& OutError);
+	static bool Validate(const FOmniCommandMessage& Message, FString& OutError);
+};
+
 struct OMNICORE_API FOmniCanStartActionQuerySchema
 {
 	FName SourceSystem = NAME_None;
@@ -23,7 +23,9 @@ public class OmniForge : ModuleRules
 			{
 				"Json",
 				"UnrealEd",
+				"AssetRegistry",
 				"AssetTools",
+				"GameplayTags",
 				"Projects",
 				"Slate",
 				"SlateCore"
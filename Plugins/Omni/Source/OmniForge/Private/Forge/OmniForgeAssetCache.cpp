@@ -0,0 +1,34 @@
+#include "Forge/OmniForgeAssetCache.h"
+
+UObject* FOmniForgeAssetCache::Load(const FSoftObjectPath& ObjectPath)
+{
+	check(IsInGameThread());
+	if (ObjectPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<UObject>* Existing = Objects.Find(ObjectPath))
+	{
+		++HitCount;
+		return *Existing;
+	}
+
+	++LoadCount;
+	UObject* Loaded = ObjectPath.TryLoad();
+	Objects.Add(ObjectPath, Loaded);
+	return Loaded;
+}
+
+void FOmniForgeAssetCache::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<FSoftObjectPath, TObjectPtr<UObject>>& Pair : Objects)
+	{
+		Collector.AddReferencedObject(Pair.Value);
+	}
+}
+
+FString FOmniForgeAssetCache::GetReferencerName() const
+{
+	return TEXT("FOmniForgeAssetCache");
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "UObject/SoftObjectPath.h"
+
+// Objects Forge loaded, keyed by object path and kept alive for the lifetime of the cache. A batch run shares one
+// cache so profiles and libraries referenced by several manifests are loaded once.
+class FOmniForgeAssetCache : public FGCObject
+{
+public:
+	// Game thread only. Failed loads are remembered as null.
+	UObject* Load(const FSoftObjectPath& ObjectPath);
+
+	int32 GetLoadCount() const
+	{
+		return LoadCount;
+	}
+
+	int32 GetHitCount() const
+	{
+		return HitCount;
+	}
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	TMap<FSoftObjectPath, TObjectPtr<UObject>> Objects;
+	int32 LoadCount = 0;
+	int32 HitCount = 0;
+};
@@ -0,0 +1,281 @@
+#include "Forge/OmniForgeBenchCommandlet.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Forge/OmniForgeBenchContent.h"
+#include "Forge/OmniForgeRunner.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Profile/OmniActionProfile.h"
+#include "Serialization/JsonWriter.h"
+#include "Systems/OmniSystemRegistrySubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOmniForgeBench, Log, All);
+
+namespace OmniForgeBenchCommandlet
+{
+	static constexpr TCHAR SchemaName[] = TEXT("omni.forge.bench.v1");
+
+	struct FSample
+	{
+		FName Phase = NAME_None;
+		double Seconds = 0.0;
+		uint64 UsedPhysicalBytes = 0;
+		uint64 PeakUsedPhysicalBytes = 0;
+	};
+
+	struct FIteration
+	{
+		bool bForgePassed = false;
+		bool bRegistryInitialized = false;
+		// "trusted", "untrusted" or "none": which cooked manifest path RegistryInitialize measured.
+		FString RegistryCookedManifest;
+		int32 ErrorCount = 0;
+		int32 SystemCount = 0;
+		int32 ActionCount = 0;
+		TArray<FSample> Samples;
+	};
+
+	static FSample SampleNow(const FName Phase, const double Seconds)
+	{
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		FSample Sample;
+		Sample.Phase = Phase;
+		Sample.Seconds = Seconds;
+		Sample.UsedPhysicalBytes = MemoryStats.UsedPhysical;
+		Sample.PeakUsedPhysicalBytes = MemoryStats.PeakUsedPhysical;
+		return Sample;
+	}
+
+	static int32 ParseCount(const FString& Params, const TCHAR* Key, const int32 DefaultValue)
+	{
+		int32 Value = DefaultValue;
+		FParse::Value(*Params, Key, Value);
+		return FMath::Max(0, Value);
+	}
+
+	static void WriteSample(const TSharedRef<TJsonWriter<>>& Writer, const FSample& Sample)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("phase"), Sample.Phase.ToString());
+		Writer->WriteValue(TEXT("seconds"), Sample.Seconds);
+		Writer->WriteValue(TEXT("usedPhysicalBytes"), static_cast<int64>(Sample.UsedPhysicalBytes));
+		Writer->WriteValue(TEXT("peakUsedPhysicalBytes"), static_cast<int64>(Sample.PeakUsedPhysicalBytes));
+		Writer->WriteObjectEnd();
+	}
+
+	static bool BuildJson(
+		const FOmniForgeBenchConfig& Config,
+		const FOmniForgeInput& Input,
+		const FSample& ContentSample,
+		const TArray<FIteration>& Iterations,
+		FString& OutJson
+	)
+	{
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("schema"), SchemaName);
+		Writer->WriteValue(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+		Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+
+		Writer->WriteObjectStart(TEXT("config"));
+		Writer->WriteValue(TEXT("systems"), Config.Systems);
+		Writer->WriteValue(TEXT("actionsPerLibrary"), Config.ActionsPerLibrary);
+		Writer->WriteValue(TEXT("tags"), Config.Tags);
+		Writer->WriteValue(TEXT("cancelFanOut"), Config.CancelFanOut);
+		Writer->WriteValue(TEXT("dependencyDepth"), Config.DependencyDepth);
+		Writer->WriteValue(TEXT("profileLayers"), Config.ProfileLayers);
+		Writer->WriteValue(TEXT("cache"), Input.bUseCache);
+		Writer->WriteValue(TEXT("parallel"), Input.bParallelResolve);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteIdentifierPrefix(TEXT("content"));
+		WriteSample(Writer, ContentSample);
+
+		Writer->WriteArrayStart(TEXT("iterations"));
+		for (int32 Index = 0; Index < Iterations.Num(); ++Index)
+		{
+			const FIteration& Iteration = Iterations[Index];
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("iteration"), Index);
+			Writer->WriteValue(TEXT("forgePassed"), Iteration.bForgePassed);
+			Writer->WriteValue(TEXT("registryInitialized"), Iteration.bRegistryInitialized);
+			Writer->WriteValue(TEXT("registryCookedManifest"), Iteration.RegistryCookedManifest);
+			Writer->WriteValue(TEXT("errors"), Iteration.ErrorCount);
+			Writer->WriteValue(TEXT("systemsCount"), Iteration.SystemCount);
+			Writer->WriteValue(TEXT("actionsCount"), Iteration.ActionCount);
+			Writer->WriteArrayStart(TEXT("phases"));
+			for (const FSample& Sample : Iteration.Samples)
+			{
+				WriteSample(Writer, Sample);
+			}
+			Writer->WriteArrayEnd();
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+		return Writer->Close();
+	}
+}
+
+UOmniForgeBenchCommandlet::UOmniForgeBenchCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UOmniForgeBenchCommandlet::Main(const FString& Params)
+{
+	using namespace OmniForgeBenchCommandlet;
+
+	FOmniForgeBenchConfig Config;
+	Config.Systems = ParseCount(Params, TEXT("Systems="), Config.Systems);
+	Config.ActionsPerLibrary = ParseCount(Params, TEXT("Actions="), Config.ActionsPerLibrary);
+	Config.Tags = ParseCount(Params, TEXT("Tags="), Config.Tags);
+	Config.CancelFanOut = ParseCount(Params, TEXT("CancelFanOut="), Config.CancelFanOut);
+	Config.DependencyDepth = ParseCount(Params, TEXT("DependencyDepth="), Config.DependencyDepth);
+	Config.ProfileLayers = FMath::Min(ParseCount(Params, TEXT("ProfileLayers="), Config.ProfileLayers), UOmniActionProfile::MaxParentDepth - 1);
+	const int32 IterationCount = FMath::Max(1, ParseCount(Params, TEXT("Iterations="), 3));
+
+	bool bRunRegistry = true;
+	FParse::Bool(*Params, TEXT("Registry="), bRunRegistry);
+	bool bTrustCooked = true;
+	FParse::Bool(*Params, TEXT("TrustCooked="), bTrustCooked);
+
+	const FString BenchDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Omni"), TEXT("Bench"));
+	FString OutputFile = FPaths::Combine(BenchDir, FString::Printf(TEXT("ForgeBench_%s.json"), *FDateTime::Now().ToString()));
+	FParse::Value(*Params, TEXT("Output="), OutputFile);
+
+	// Cold runs by default: the fragment cache would hide Resolve cost after the first iteration.
+	FOmniForgeInput Input;
+	Input.bUseCache = false;
+	FParse::Bool(*Params, TEXT("Cache="), Input.bUseCache);
+	FParse::Bool(*Params, TEXT("Parallel="), Input.bParallelResolve);
+	Input.OutputDirectory = FPaths::Combine(BenchDir, TEXT("Forge"));
+
+	FOmniForgeBenchContent Content;
+	FString ContentError;
+	double StartSeconds = FPlatformTime::Seconds();
+	if (!Content.Build(Config, ContentError))
+	{
+		UE_LOG(LogOmniForgeBench, Error, TEXT("%s"), *ContentError);
+		return 1;
+	}
+	const FSample ContentSample = SampleNow(TEXT("GenerateContent"), FPlatformTime::Seconds() - StartSeconds);
+	Input.ManifestAssetPath = FSoftObjectPath(Content.GetManifest());
+
+	UGameInstance* GameInstance = nullptr;
+	UOmniSystemRegistrySubsystem* Registry = nullptr;
+	if (bRunRegistry)
+	{
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+		Registry = GameInstance->GetSubsystem<UOmniSystemRegistrySubsystem>();
+		if (!Registry)
+		{
+			UE_LOG(LogOmniForgeBench, Warning, TEXT("Omni registry subsystem is not available; registry timing skipped."));
+		}
+	}
+
+	TArray<FIteration> Iterations;
+	int32 FailedCount = 0;
+	for (int32 IterationIndex = 0; IterationIndex < IterationCount; ++IterationIndex)
+	{
+		FIteration& Iteration = Iterations.AddDefaulted_GetRef();
+
+		const FOmniForgeResult Result = UOmniForgeRunner::Run(Input);
+		Iteration.bForgePassed = Result.bSuccess;
+		Iteration.ErrorCount = Result.Report.ErrorCount;
+		Iteration.SystemCount = Result.Report.SystemCount;
+		Iteration.ActionCount = Result.Report.ActionCount;
+		for (const FOmniForgePhaseStat& Stat : Result.Report.PhaseStats)
+		{
+			FSample& Sample = Iteration.Samples.AddDefaulted_GetRef();
+			Sample.Phase = Stat.Phase;
+			Sample.Seconds = Stat.Seconds;
+			Sample.UsedPhysicalBytes = Stat.UsedPhysicalBytes;
+			Sample.PeakUsedPhysicalBytes = Stat.PeakUsedPhysicalBytes;
+		}
+
+		if (Registry)
+		{
+			// The registry maps the image this iteration's Forge run wrote, not the project's default one.
+			Registry->SetCookedManifestSource(Result.bSuccess ? Result.Report.OutputCookedManifestPath : FString(), bTrustCooked);
+			StartSeconds = FPlatformTime::Seconds();
+			Iteration.bRegistryInitialized = Registry->InitializeFromManifest(Content.GetManifest());
+			Iteration.Samples.Add(SampleNow(TEXT("RegistryInitialize"), FPlatformTime::Seconds() - StartSeconds));
+			Iteration.RegistryCookedManifest = Registry->GetTrustedCookedManifest()
+				? TEXT("trusted")
+				: (Registry->GetCookedManifest() ? TEXT("untrusted") : TEXT("none"));
+
+			StartSeconds = FPlatformTime::Seconds();
+			Registry->ShutdownSystems();
+			Iteration.Samples.Add(SampleNow(TEXT("RegistryShutdown"), FPlatformTime::Seconds() - StartSeconds));
+		}
+
+		const bool bPassed = Iteration.bForgePassed && (!Registry || Iteration.bRegistryInitialized);
+		if (!bPassed)
+		{
+			++FailedCount;
+		}
+
+		double TotalSeconds = 0.0;
+		for (const FSample& Sample : Iteration.Samples)
+		{
+			TotalSeconds += Sample.Seconds;
+		}
+		UE_LOG(
+			LogOmniForgeBench,
+			Display,
+			TEXT("Iteration %d: %s Systems=%d Actions=%d Time=%.3fs Peak=%.1fMB"),
+			IterationIndex,
+			bPassed ? TEXT("PASS") : TEXT("FAIL"),
+			Iteration.SystemCount,
+			Iteration.ActionCount,
+			TotalSeconds,
+			FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0)
+		);
+	}
+
+	if (GameInstance)
+	{
+		GameInstance->Shutdown();
+		GameInstance->RemoveFromRoot();
+	}
+	Content.Release();
+
+	FString Json;
+	if (!BuildJson(Config, Input, ContentSample, Iterations, Json))
+	{
+		UE_LOG(LogOmniForgeBench, Error, TEXT("Failed to serialize benchmark results."));
+		return 1;
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputFile), true);
+	if (!FFileHelper::SaveStringToFile(Json, *OutputFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogOmniForgeBench, Error, TEXT("Failed to write file: %s"), *OutputFile);
+		return 1;
+	}
+
+	UE_LOG(
+		LogOmniForgeBench,
+		Display,
+		TEXT("Forge bench: %d iteration(s), %d failed. Systems=%d Actions=%d Results=%s"),
+		IterationCount,
+		FailedCount,
+		Config.Systems,
+		Config.ActionsPerLibrary,
+		*OutputFile
+	);
+
+	return FailedCount;
+}
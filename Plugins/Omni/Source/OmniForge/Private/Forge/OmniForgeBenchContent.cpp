@@ -0,0 +1,247 @@
+#include "Forge/OmniForgeBenchContent.h"
+
+#include "Forge/OmniForgeBenchSystem.h"
+#include "GameplayTagsManager.h"
+#include "HAL/FileManager.h"
+#include "Library/OmniActionLibrary.h"
+#include "Library/OmniMovementLibrary.h"
+#include "Library/OmniStatusLibrary.h"
+#include "Manifest/OmniManifest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Profile/OmniActionProfile.h"
+#include "Profile/OmniMovementProfile.h"
+#include "Profile/OmniStatusProfile.h"
+#include "Systems/ActionGate/OmniActionGateSystem.h"
+#include "Systems/Movement/OmniMovementSystem.h"
+#include "Systems/Status/OmniStatusSystem.h"
+#include "UObject/Package.h"
+
+namespace OmniForgeBenchContent
+{
+	static constexpr TCHAR PackageRoot[] = TEXT("/Game/OmniForgeBench");
+	static constexpr TCHAR TagIniFile[] = TEXT("OmniForgeBench.ini");
+
+	static FString GetTagName(const int32 TagIndex)
+	{
+		return FString::Printf(TEXT("Bench.Tag.%04d"), TagIndex);
+	}
+
+	static FName GetActionId(const int32 ActionIndex)
+	{
+		return FName(*FString::Printf(TEXT("Bench.Action.%05d"), ActionIndex));
+	}
+
+	static FName GetPaddingSystemId(const int32 SystemIndex)
+	{
+		return FName(*FString::Printf(TEXT("Bench.System.%04d"), SystemIndex));
+	}
+
+	template <typename AssetType>
+	static AssetType* CreateAsset(const TCHAR* Folder, const TCHAR* Name, TArray<TObjectPtr<UObject>>& OutObjects)
+	{
+		UPackage* Package = CreatePackage(*FString::Printf(TEXT("%s/%s/%s"), PackageRoot, Folder, Name));
+		Package->SetFlags(RF_Transient);
+		AssetType* Asset = NewObject<AssetType>(Package, Name, RF_Public | RF_Standalone | RF_Transient);
+		OutObjects.Add(Asset);
+		return Asset;
+	}
+
+	static void BuildActionDefinitions(const FOmniForgeBenchConfig& Config, TArray<FOmniActionDefinition>& OutDefinitions)
+	{
+		static constexpr EOmniActionPolicy Policies[] = {
+			EOmniActionPolicy::DenyIfActive,
+			EOmniActionPolicy::SucceedIfActive,
+			EOmniActionPolicy::RestartIfActive
+		};
+
+		TArray<FGameplayTag> Tags;
+		for (int32 TagIndex = 0; TagIndex < Config.Tags; ++TagIndex)
+		{
+			Tags.Add(FGameplayTag::RequestGameplayTag(FName(*GetTagName(TagIndex)), false));
+		}
+
+		OutDefinitions.Reset(Config.ActionsPerLibrary);
+		for (int32 ActionIndex = 0; ActionIndex < Config.ActionsPerLibrary; ++ActionIndex)
+		{
+			FOmniActionDefinition& Definition = OutDefinitions.AddDefaulted_GetRef();
+			Definition.ActionId = GetActionId(ActionIndex);
+			Definition.Policy = Policies[ActionIndex % UE_ARRAY_COUNT(Policies)];
+			if (Tags.Num() > 0)
+			{
+				Definition.BlockedBy.AddTag(Tags[ActionIndex % Tags.Num()]);
+				Definition.AppliesLocks.AddTag(Tags[(ActionIndex * 7 + 3) % Tags.Num()]);
+			}
+			for (int32 Offset = 1; Offset <= Config.CancelFanOut && Offset < Config.ActionsPerLibrary; ++Offset)
+			{
+				Definition.Cancels.Add(GetActionId((ActionIndex + Offset) % Config.ActionsPerLibrary));
+			}
+		}
+	}
+
+	static void BuildOverrideDefinitions(
+		const TArray<FOmniActionDefinition>& LibraryDefinitions,
+		const int32 Layer,
+		TArray<FOmniActionDefinition>& OutDefinitions
+	)
+	{
+		static constexpr int32 Stride = 4;
+
+		OutDefinitions.Reset(LibraryDefinitions.Num() / Stride + 1);
+		for (int32 ActionIndex = Layer % Stride; ActionIndex < LibraryDefinitions.Num(); ActionIndex += Stride)
+		{
+			FOmniActionDefinition& Definition = OutDefinitions.Add_GetRef(LibraryDefinitions[ActionIndex]);
+			Definition.Policy = static_cast<EOmniActionPolicy>((static_cast<int32>(Definition.Policy) + Layer) % 3);
+		}
+	}
+}
+
+FOmniForgeBenchContent::~FOmniForgeBenchContent()
+{
+	Release();
+}
+
+bool FOmniForgeBenchContent::Build(const FOmniForgeBenchConfig& Config, FString& OutError)
+{
+	using namespace OmniForgeBenchContent;
+
+	check(IsInGameThread());
+	check(!Manifest);
+
+	if (!RegisterTags(Config, OutError))
+	{
+		return false;
+	}
+
+	UOmniActionLibrary* ActionLibrary = CreateAsset<UOmniActionLibrary>(TEXT("Action"), TEXT("DA_Bench_ActionLibrary"), Objects);
+	BuildActionDefinitions(Config, ActionLibrary->Definitions);
+	UOmniActionProfile* ActionProfile = CreateAsset<UOmniActionProfile>(TEXT("Action"), TEXT("DA_Bench_ActionProfile"), Objects);
+	ActionProfile->ActionLibrary = ActionLibrary;
+	for (int32 Layer = 1; Layer <= Config.ProfileLayers; ++Layer)
+	{
+		const FString LayerName = FString::Printf(TEXT("DA_Bench_ActionProfile_L%02d"), Layer);
+		UOmniActionProfile* LayerProfile = CreateAsset<UOmniActionProfile>(TEXT("Action"), *LayerName, Objects);
+		LayerProfile->ParentProfile = ActionProfile;
+		BuildOverrideDefinitions(ActionLibrary->Definitions, Layer, LayerProfile->OverrideDefinitions);
+		ActionProfile = LayerProfile;
+	}
+
+	UOmniStatusLibrary* StatusLibrary = CreateAsset<UOmniStatusLibrary>(TEXT("Status"), TEXT("DA_Bench_StatusLibrary"), Objects);
+	UOmniStatusProfile* StatusProfile = CreateAsset<UOmniStatusProfile>(TEXT("Status"), TEXT("DA_Bench_StatusProfile"), Objects);
+	StatusProfile->StatusLibrary = StatusLibrary;
+
+	UOmniMovementLibrary* MovementLibrary = CreateAsset<UOmniMovementLibrary>(TEXT("Movement"), TEXT("DA_Bench_MovementLibrary"), Objects);
+	UOmniMovementProfile* MovementProfile = CreateAsset<UOmniMovementProfile>(TEXT("Movement"), TEXT("DA_Bench_MovementProfile"), Objects);
+	MovementProfile->MovementLibrary = MovementLibrary;
+
+	Manifest = CreateAsset<UOmniManifest>(TEXT("Manifest"), TEXT("DA_Bench_Manifest"), Objects);
+	Manifest->Namespace = TEXT("Omni.Bench");
+	Manifest->BuildVersion = 1;
+	Manifest->Systems.Reset();
+
+	{
+		FOmniSystemManifestEntry& Entry = Manifest->Systems.AddDefaulted_GetRef();
+		Entry.SystemId = TEXT("Status");
+		Entry.SystemClass = UOmniStatusSystem::StaticClass();
+		Entry.SetSetting(TEXT("StatusProfileAssetPath"), FSoftObjectPath(StatusProfile).ToString());
+	}
+	{
+		FOmniSystemManifestEntry& Entry = Manifest->Systems.AddDefaulted_GetRef();
+		Entry.SystemId = TEXT("ActionGate");
+		Entry.SystemClass = UOmniActionGateSystem::StaticClass();
+		Entry.Dependencies = { TEXT("Status") };
+		Entry.SetSetting(TEXT("ActionProfileAssetPath"), FSoftObjectPath(ActionProfile).ToString());
+	}
+	{
+		FOmniSystemManifestEntry& Entry = Manifest->Systems.AddDefaulted_GetRef();
+		Entry.SystemId = TEXT("Movement");
+		Entry.SystemClass = UOmniMovementSystem::StaticClass();
+		Entry.Dependencies = { TEXT("ActionGate"), TEXT("Status") };
+		Entry.SetSetting(TEXT("MovementProfileAssetPath"), FSoftObjectPath(MovementProfile).ToString());
+	}
+
+	// Padding systems are laid out in DependencyDepth layers; each depends on up to two systems of the layer below.
+	const int32 Depth = FMath::Max(1, Config.DependencyDepth);
+	const int32 LayerWidth = FMath::Max(1, FMath::DivideAndRoundUp(Config.Systems, Depth));
+	for (int32 SystemIndex = 0; SystemIndex < Config.Systems; ++SystemIndex)
+	{
+		FOmniSystemManifestEntry& Entry = Manifest->Systems.AddDefaulted_GetRef();
+		Entry.SystemId = GetPaddingSystemId(SystemIndex);
+		Entry.SystemClass = UOmniForgeBenchSystem::StaticClass();
+		if (SystemIndex < LayerWidth)
+		{
+			Entry.Dependencies = { TEXT("Movement") };
+			continue;
+		}
+
+		const int32 Below = SystemIndex - LayerWidth;
+		Entry.Dependencies.Add(GetPaddingSystemId(Below));
+		if (Below + 1 < SystemIndex - (SystemIndex % LayerWidth))
+		{
+			Entry.Dependencies.Add(GetPaddingSystemId(Below + 1));
+		}
+	}
+
+	return true;
+}
+
+void FOmniForgeBenchContent::Release()
+{
+	for (UObject* Object : Objects)
+	{
+		if (Object)
+		{
+			Object->ClearFlags(RF_Public | RF_Standalone);
+			Object->MarkAsGarbage();
+		}
+	}
+	Objects.Reset();
+	Manifest = nullptr;
+
+	if (!TagIniDir.IsEmpty())
+	{
+		UGameplayTagsManager::Get().RemoveTagIniSearchPath(TagIniDir);
+		IFileManager::Get().DeleteDirectory(*TagIniDir, false, true);
+		TagIniDir.Reset();
+	}
+}
+
+void FOmniForgeBenchContent::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(Objects);
+	Collector.AddReferencedObject(Manifest);
+}
+
+FString FOmniForgeBenchContent::GetReferencerName() const
+{
+	return TEXT("FOmniForgeBenchContent");
+}
+
+bool FOmniForgeBenchContent::RegisterTags(const FOmniForgeBenchConfig& Config, FString& OutError)
+{
+	if (Config.Tags <= 0)
+	{
+		return true;
+	}
+
+	TArray<FString> Lines;
+	Lines.Reserve(Config.Tags + 1);
+	Lines.Add(TEXT("[/Script/GameplayTags.GameplayTagsList]"));
+	for (int32 TagIndex = 0; TagIndex < Config.Tags; ++TagIndex)
+	{
+		Lines.Add(FString::Printf(TEXT("+GameplayTagList=(Tag=\"%s\",DevComment=\"\")"), *OmniForgeBenchContent::GetTagName(TagIndex)));
+	}
+
+	const FString Dir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Omni"), TEXT("Bench"), TEXT("Tags"));
+	const FString FilePath = FPaths::Combine(Dir, OmniForgeBenchContent::TagIniFile);
+	IFileManager::Get().MakeDirectory(*Dir, true);
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to write file: %s"), *FilePath);
+		return false;
+	}
+
+	TagIniDir = Dir;
+	UGameplayTagsManager::Get().AddTagIniSearchPath(TagIniDir);
+	return true;
+}
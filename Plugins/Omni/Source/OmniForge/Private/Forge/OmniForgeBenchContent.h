@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UOmniManifest;
+
+struct FOmniForgeBenchConfig
+{
+	// Padding systems on top of Status, ActionGate and Movement.
+	int32 Systems = 100;
+	int32 ActionsPerLibrary = 1000;
+	int32 Tags = 64;
+	int32 CancelFanOut = 2;
+	// Longest dependency chain through the padding systems.
+	int32 DependencyDepth = 8;
+	// Action profiles stacked through ParentProfile on top of the base profile, each overriding a quarter of the library.
+	int32 ProfileLayers = 0;
+};
+
+// Synthetic manifest plus in-memory profile/library assets under /Game/OmniForgeBench. Nothing is saved to disk;
+// Forge and the registry resolve the soft paths to the objects held here. Tags are registered through a generated
+// ini in Saved/Omni/Bench/Tags.
+class FOmniForgeBenchContent : public FGCObject
+{
+public:
+	~FOmniForgeBenchContent();
+
+	bool Build(const FOmniForgeBenchConfig& Config, FString& OutError);
+	void Release();
+
+	UOmniManifest* GetManifest() const
+	{
+		return Manifest;
+	}
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+
+private:
+	bool RegisterTags(const FOmniForgeBenchConfig& Config, FString& OutError);
+
+	TObjectPtr<UOmniManifest> Manifest = nullptr;
+	TArray<TObjectPtr<UObject>> Objects;
+	FString TagIniDir;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/OmniRuntimeSystem.h"
+#include "OmniForgeBenchSystem.generated.h"
+
+// No-op system used by the Forge benchmark to pad synthetic manifests with extra entries and dependency depth.
+UCLASS(NotBlueprintable, Transient)
+class UOmniForgeBenchSystem : public UOmniRuntimeSystem
+{
+	GENERATED_BODY()
+};
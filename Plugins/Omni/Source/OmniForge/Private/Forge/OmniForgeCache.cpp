@@ -0,0 +1,356 @@
+#include "Forge/OmniForgeCache.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Manifest/OmniHashingWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace OmniForgeCache
+{
+	static constexpr TCHAR SchemaName[] = TEXT("omni.forge.cache.v2");
+	static constexpr TCHAR MissingPackageHash[] = TEXT("missing");
+	static constexpr int64 HashChunkSize = 256 * 1024;
+
+	// XXH3 of the package file, streamed in chunks; only compared against the previous run's value.
+	static bool HashFile(const FString& Filename, FString& OutHash)
+	{
+		const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+		if (!Reader)
+		{
+			return false;
+		}
+
+		FOmniHashingWriter Hasher(EOmniHashKind::Fast);
+		TArray<uint8> Chunk;
+		Chunk.SetNumUninitialized(static_cast<int32>(FMath::Min(HashChunkSize, Reader->TotalSize())));
+		for (int64 Remaining = Reader->TotalSize(); Remaining > 0;)
+		{
+			const int64 ReadSize = FMath::Min<int64>(Remaining, Chunk.Num());
+			Reader->Serialize(Chunk.GetData(), ReadSize);
+			if (Reader->IsError())
+			{
+				return false;
+			}
+			Hasher.Serialize(Chunk.GetData(), ReadSize);
+			Remaining -= ReadSize;
+		}
+
+		OutHash = FOmniHashingWriter::FastHashToHex(Hasher.FinalizeFast());
+		return true;
+	}
+
+	static TArray<TSharedPtr<FJsonValue>> ToJsonStrings(const TArray<FString>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> Result;
+		Result.Reserve(Values.Num());
+		for (const FString& Value : Values)
+		{
+			Result.Add(MakeShared<FJsonValueString>(Value));
+		}
+		return Result;
+	}
+
+	static TArray<TSharedPtr<FJsonValue>> ToJsonStrings(const TArray<FName>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> Result;
+		Result.Reserve(Values.Num());
+		for (const FName Value : Values)
+		{
+			Result.Add(MakeShared<FJsonValueString>(Value.ToString()));
+		}
+		return Result;
+	}
+
+	static void ReadStrings(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TArray<FString>& OutValues)
+	{
+		OutValues.Reset();
+		Object->TryGetStringArrayField(Field, OutValues);
+	}
+
+	static void ReadNames(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TArray<FName>& OutValues)
+	{
+		TArray<FString> Strings;
+		ReadStrings(Object, Field, Strings);
+		OutValues.Reset(Strings.Num());
+		for (const FString& Value : Strings)
+		{
+			OutValues.Add(FName(*Value));
+		}
+	}
+
+	static TSharedRef<FJsonObject> WriteFragment(const FOmniForgeSystemFragment& Fragment)
+	{
+		const TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("systemId"), Fragment.SystemId.ToString());
+		Object->SetStringField(TEXT("entryKey"), Fragment.EntryKey);
+		Object->SetBoolField(TEXT("profileOk"), Fragment.bProfileOk);
+
+		const TSharedRef<FJsonObject> Profile = MakeShared<FJsonObject>();
+		Profile->SetStringField(TEXT("settingKey"), Fragment.Profile.SettingKey.ToString());
+		Profile->SetStringField(TEXT("profileAssetPath"), Fragment.Profile.ProfileAssetPath);
+		Profile->SetStringField(TEXT("profileClassPath"), Fragment.Profile.ProfileClassPath);
+		Profile->SetStringField(TEXT("libraryAssetPath"), Fragment.Profile.LibraryAssetPath);
+		Profile->SetStringField(TEXT("libraryClassPath"), Fragment.Profile.LibraryClassPath);
+		Object->SetObjectField(TEXT("profile"), Profile);
+
+		TArray<TSharedPtr<FJsonValue>> Actions;
+		for (const FOmniForgeResolvedAction& Action : Fragment.Actions)
+		{
+			const TSharedRef<FJsonObject> ActionObject = MakeShared<FJsonObject>();
+			ActionObject->SetStringField(TEXT("actionId"), Action.ActionId.ToString());
+			ActionObject->SetBoolField(TEXT("enabled"), Action.bEnabled);
+			ActionObject->SetStringField(TEXT("policy"), Action.Policy);
+			ActionObject->SetArrayField(TEXT("blockedBy"), ToJsonStrings(Action.BlockedBy));
+			ActionObject->SetArrayField(TEXT("cancels"), ToJsonStrings(Action.Cancels));
+			ActionObject->SetArrayField(TEXT("appliesLocks"), ToJsonStrings(Action.AppliesLocks));
+			Actions.Add(MakeShared<FJsonValueObject>(ActionObject));
+		}
+		Object->SetArrayField(TEXT("actions"), Actions);
+
+		TArray<TSharedPtr<FJsonValue>> Issues;
+		for (const FOmniForgeError& Issue : Fragment.Issues)
+		{
+			const TSharedRef<FJsonObject> IssueObject = MakeShared<FJsonObject>();
+			IssueObject->SetBoolField(TEXT("error"), Issue.Severity == EOmniForgeErrorSeverity::Error);
+			IssueObject->SetStringField(TEXT("code"), Issue.Code);
+			IssueObject->SetStringField(TEXT("message"), Issue.Message);
+			IssueObject->SetStringField(TEXT("location"), Issue.Location);
+			IssueObject->SetStringField(TEXT("recommendation"), Issue.Recommendation);
+			Issues.Add(MakeShared<FJsonValueObject>(IssueObject));
+		}
+		Object->SetArrayField(TEXT("issues"), Issues);
+
+		TArray<TSharedPtr<FJsonValue>> Dependencies;
+		for (const FOmniForgeCachedDependency& Dependency : Fragment.Dependencies)
+		{
+			const TSharedRef<FJsonObject> DependencyObject = MakeShared<FJsonObject>();
+			DependencyObject->SetStringField(TEXT("package"), Dependency.PackageName);
+			DependencyObject->SetStringField(TEXT("hash"), Dependency.Hash);
+			Dependencies.Add(MakeShared<FJsonValueObject>(DependencyObject));
+		}
+		Object->SetArrayField(TEXT("dependencies"), Dependencies);
+
+		return Object;
+	}
+
+	static bool ReadFragment(const TSharedPtr<FJsonObject>& Object, FOmniForgeSystemFragment& OutFragment)
+	{
+		FString SystemId;
+		if (!Object.IsValid() || !Object->TryGetStringField(TEXT("systemId"), SystemId)
+			|| !Object->TryGetStringField(TEXT("entryKey"), OutFragment.EntryKey))
+		{
+			return false;
+		}
+
+		OutFragment.SystemId = FName(*SystemId);
+		Object->TryGetBoolField(TEXT("profileOk"), OutFragment.bProfileOk);
+
+		const TSharedPtr<FJsonObject>* Profile = nullptr;
+		if (Object->TryGetObjectField(TEXT("profile"), Profile))
+		{
+			FString SettingKey;
+			(*Profile)->TryGetStringField(TEXT("settingKey"), SettingKey);
+			OutFragment.Profile.SystemId = OutFragment.SystemId;
+			OutFragment.Profile.SettingKey = FName(*SettingKey);
+			(*Profile)->TryGetStringField(TEXT("profileAssetPath"), OutFragment.Profile.ProfileAssetPath);
+			(*Profile)->TryGetStringField(TEXT("profileClassPath"), OutFragment.Profile.ProfileClassPath);
+			(*Profile)->TryGetStringField(TEXT("libraryAssetPath"), OutFragment.Profile.LibraryAssetPath);
+			(*Profile)->TryGetStringField(TEXT("libraryClassPath"), OutFragment.Profile.LibraryClassPath);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Actions = nullptr;
+		if (Object->TryGetArrayField(TEXT("actions"), Actions))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *Actions)
+			{
+				const TSharedPtr<FJsonObject> ActionObject = Value->AsObject();
+				if (!ActionObject.IsValid())
+				{
+					return false;
+				}
+
+				FOmniForgeResolvedAction& Action = OutFragment.Actions.AddDefaulted_GetRef();
+				FString ActionId;
+				ActionObject->TryGetStringField(TEXT("actionId"), ActionId);
+				Action.ActionId = FName(*ActionId);
+				ActionObject->TryGetBoolField(TEXT("enabled"), Action.bEnabled);
+				ActionObject->TryGetStringField(TEXT("policy"), Action.Policy);
+				ReadStrings(ActionObject, TEXT("blockedBy"), Action.BlockedBy);
+				ReadNames(ActionObject, TEXT("cancels"), Action.Cancels);
+				ReadStrings(ActionObject, TEXT("appliesLocks"), Action.AppliesLocks);
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Issues = nullptr;
+		if (Object->TryGetArrayField(TEXT("issues"), Issues))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *Issues)
+			{
+				const TSharedPtr<FJsonObject> IssueObject = Value->AsObject();
+				if (!IssueObject.IsValid())
+				{
+					return false;
+				}
+
+				FOmniForgeError& Issue = OutFragment.Issues.AddDefaulted_GetRef();
+				bool bError = true;
+				IssueObject->TryGetBoolField(TEXT("error"), bError);
+				Issue.Severity = bError ? EOmniForgeErrorSeverity::Error : EOmniForgeErrorSeverity::Warning;
+				IssueObject->TryGetStringField(TEXT("code"), Issue.Code);
+				IssueObject->TryGetStringField(TEXT("message"), Issue.Message);
+				IssueObject->TryGetStringField(TEXT("location"), Issue.Location);
+				IssueObject->TryGetStringField(TEXT("recommendation"), Issue.Recommendation);
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Dependencies = nullptr;
+		if (Object->TryGetArrayField(TEXT("dependencies"), Dependencies))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *Dependencies)
+			{
+				const TSharedPtr<FJsonObject> DependencyObject = Value->AsObject();
+				FOmniForgeCachedDependency Dependency;
+				if (!DependencyObject.IsValid() || !DependencyObject->TryGetStringField(TEXT("package"), Dependency.PackageName)
+					|| !DependencyObject->TryGetStringField(TEXT("hash"), Dependency.Hash))
+				{
+					return false;
+				}
+				OutFragment.Dependencies.Add(MoveTemp(Dependency));
+			}
+		}
+
+		return true;
+	}
+}
+
+bool FOmniForgeCache::Load(const FString& FilePath)
+{
+	Fragments.Reset();
+	TouchedSystemIds.Reset();
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	FString Schema;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid()
+		|| !Root->TryGetStringField(TEXT("schema"), Schema) || Schema != OmniForgeCache::SchemaName)
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!Root->TryGetArrayField(TEXT("systems"), Entries))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : *Entries)
+	{
+		FOmniForgeSystemFragment Fragment;
+		if (OmniForgeCache::ReadFragment(Value->AsObject(), Fragment))
+		{
+			const FName SystemId = Fragment.SystemId;
+			Fragments.Add(SystemId, MoveTemp(Fragment));
+		}
+	}
+
+	return true;
+}
+
+bool FOmniForgeCache::Save(const FString& FilePath) const
+{
+	TArray<FName> SystemIds = TouchedSystemIds.Array();
+	SystemIds.Sort(FNameLexicalLess());
+
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	for (const FName SystemId : SystemIds)
+	{
+		if (const FOmniForgeSystemFragment* Fragment = Fragments.Find(SystemId))
+		{
+			Entries.Add(MakeShared<FJsonValueObject>(OmniForgeCache::WriteFragment(*Fragment)));
+		}
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("schema"), OmniForgeCache::SchemaName);
+	Root->SetArrayField(TEXT("systems"), Entries);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+const FOmniForgeSystemFragment* FOmniForgeCache::FindValid(const FName SystemId, const FString& EntryKey)
+{
+	const FOmniForgeSystemFragment* Fragment = Fragments.Find(SystemId);
+	bool bValid = Fragment && Fragment->EntryKey == EntryKey;
+	if (bValid)
+	{
+		for (const FOmniForgeCachedDependency& Dependency : Fragment->Dependencies)
+		{
+			if (HashPackage(Dependency.PackageName) != Dependency.Hash)
+			{
+				bValid = false;
+				break;
+			}
+		}
+	}
+
+	if (!bValid)
+	{
+		++MissCount;
+		return nullptr;
+	}
+
+	++HitCount;
+	TouchedSystemIds.Add(SystemId);
+	return Fragment;
+}
+
+void FOmniForgeCache::Store(FOmniForgeSystemFragment&& Fragment)
+{
+	const FName SystemId = Fragment.SystemId;
+	TouchedSystemIds.Add(SystemId);
+	Fragments.Add(SystemId, MoveTemp(Fragment));
+}
+
+const FOmniForgeSystemFragment* FOmniForgeCache::Find(const FName SystemId) const
+{
+	return Fragments.Find(SystemId);
+}
+
+FString FOmniForgeCache::HashPackage(const FString& PackageName)
+{
+	if (const FString* Cached = PackageHashes.Find(PackageName))
+	{
+		return *Cached;
+	}
+
+	FString Hash = OmniForgeCache::MissingPackageHash;
+	FString Filename;
+	if (FPackageName::DoesPackageExist(PackageName, &Filename))
+	{
+		FString FileHash;
+		if (OmniForgeCache::HashFile(Filename, FileHash))
+		{
+			Hash = MoveTemp(FileHash);
+		}
+	}
+
+	PackageHashes.Add(PackageName, Hash);
+	return Hash;
+}
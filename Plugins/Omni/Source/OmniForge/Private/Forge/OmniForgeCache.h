@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Forge/OmniForgeTypes.h"
+
+struct FOmniForgeCachedDependency
+{
+	FString PackageName;
+	FString Hash;
+};
+
+// Validation outcome of one system: everything Resolve needs to replay it without loading assets.
+struct FOmniForgeSystemFragment
+{
+	FName SystemId = NAME_None;
+	FString EntryKey;
+	bool bProfileOk = false;
+	FOmniForgeResolvedProfile Profile;
+	TArray<FOmniForgeResolvedAction> Actions;
+	TArray<FOmniForgeError> Issues;
+	TArray<FOmniForgeCachedDependency> Dependencies;
+};
+
+// Persistent per-system fragment cache (Saved/Omni/ForgeCache.json). A fragment is reused only when the
+// normalized manifest entry hashes to the same key and every package it read still has the same content hash.
+class FOmniForgeCache
+{
+public:
+	bool Load(const FString& FilePath);
+	bool Save(const FString& FilePath) const;
+
+	const FOmniForgeSystemFragment* FindValid(FName SystemId, const FString& EntryKey);
+	void Store(FOmniForgeSystemFragment&& Fragment);
+	const FOmniForgeSystemFragment* Find(FName SystemId) const;
+
+	// XXH3 of the package file on disk; "missing" when the package does not exist so its creation invalidates.
+	FString HashPackage(const FString& PackageName);
+
+	int32 GetHitCount() const
+	{
+		return HitCount;
+	}
+
+	int32 GetMissCount() const
+	{
+		return MissCount;
+	}
+
+private:
+	TMap<FName, FOmniForgeSystemFragment> Fragments;
+	TSet<FName> TouchedSystemIds;
+	TMap<FString, FString> PackageHashes;
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+};
@@ -0,0 +1,246 @@
+#include "Forge/OmniForgeCodeWriter.h"
+
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+
+namespace OmniForgeCodeWriter
+{
+	static const FName ActionGateSystemId(TEXT("ActionGate"));
+	static const FName ActionProfileSettingKey(TEXT("ActionProfileAssetPath"));
+	static constexpr TCHAR FilePrefix[] = TEXT("OmniCompiledActions_");
+	static constexpr TCHAR CountEnumerator[] = TEXT("Count");
+
+	static FString SanitizeIdentifier(const FString& Value)
+	{
+		FString Result;
+		Result.Reserve(Value.Len() + 1);
+		for (const TCHAR Character : Value)
+		{
+			Result.AppendChar(FChar::IsAlnum(Character) && Character < 128 ? Character : TEXT('_'));
+		}
+		if (Result.IsEmpty() || FChar::IsDigit(Result[0]) || Result[0] == TEXT('_'))
+		{
+			Result.InsertAt(0, TEXT('N'));
+		}
+		return Result;
+	}
+
+	// Distinct ids can sanitize to the same identifier ("A.B" and "A_B"); later ones get their index appended.
+	static TArray<FString> MakeEnumerators(const TArray<FString>& Values)
+	{
+		TSet<FString> Used;
+		Used.Add(CountEnumerator);
+		TArray<FString> Result;
+		Result.Reserve(Values.Num());
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			FString Identifier = SanitizeIdentifier(Values[Index]);
+			if (Used.Contains(Identifier))
+			{
+				Identifier = FString::Printf(TEXT("%s_%d"), *Identifier, Index);
+			}
+			Used.Add(Identifier);
+			Result.Add(MoveTemp(Identifier));
+		}
+		return Result;
+	}
+
+	static FString QuoteLiteral(const FString& Value)
+	{
+		FString Escaped = Value.ReplaceCharWithEscapedChar();
+		return FString::Printf(TEXT("TEXT(\"%s\")"), *Escaped);
+	}
+
+	static FString FormatRange(const uint32 First, const uint32 Count)
+	{
+		return FString::Printf(TEXT("{ %u, %u }"), First, Count);
+	}
+
+	static void AppendEnum(TArray<FString>& Lines, const TCHAR* EnumName, const TArray<FString>& Enumerators)
+	{
+		Lines.Add(FString::Printf(TEXT("\tenum class %s : uint32"), EnumName));
+		Lines.Add(TEXT("\t{"));
+		for (int32 Index = 0; Index < Enumerators.Num(); ++Index)
+		{
+			Lines.Add(FString::Printf(TEXT("\t\t%s = %d,"), *Enumerators[Index], Index));
+		}
+		Lines.Add(FString::Printf(TEXT("\t\t%s = %d"), CountEnumerator, Enumerators.Num()));
+		Lines.Add(TEXT("\t};"));
+		Lines.Add(TEXT(""));
+	}
+}
+
+bool FOmniForgeCodeWriter::BuildSource(
+	const FOmniForgeResolved& Resolved,
+	FString& OutFileName,
+	FString& OutSource,
+	FString& OutError
+)
+{
+	OutFileName.Reset();
+	OutSource.Reset();
+	OutError.Reset();
+
+	const FOmniForgeResolvedProfile* ActionProfile = Resolved.Profiles.FindByPredicate(
+		[](const FOmniForgeResolvedProfile& Profile)
+		{
+			return Profile.SystemId == OmniForgeCodeWriter::ActionGateSystemId
+				&& Profile.SettingKey == OmniForgeCodeWriter::ActionProfileSettingKey;
+		}
+	);
+	if (!ActionProfile || Resolved.ActionDefinitions.Num() == 0)
+	{
+		OutError = TEXT("Resolved manifest has no ActionGate profile or action definitions to compile.");
+		return false;
+	}
+
+	const UEnum* PolicyEnum = StaticEnum<EOmniActionPolicy>();
+	const FString ScopeName = FString::Printf(
+		TEXT("%s_v%d"),
+		*OmniForgeCodeWriter::SanitizeIdentifier(Resolved.Namespace),
+		Resolved.BuildVersion
+	);
+	OutFileName = FString::Printf(TEXT("%s%s.h"), OmniForgeCodeWriter::FilePrefix, *ScopeName);
+
+	// Same index scheme as the cooked image: tags sorted by name, cancels as action indices, unknown cancels dropped.
+	TArray<FString> TagNames;
+	for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+	{
+		TagNames.Append(Action.BlockedBy);
+		TagNames.Append(Action.AppliesLocks);
+	}
+	TagNames.Sort();
+	TArray<FString> UniqueTagNames;
+	TMap<FString, uint32> TagIndexByName;
+	for (const FString& TagName : TagNames)
+	{
+		if (!TagIndexByName.Contains(TagName))
+		{
+			TagIndexByName.Add(TagName, static_cast<uint32>(UniqueTagNames.Num()));
+			UniqueTagNames.Add(TagName);
+		}
+	}
+
+	TArray<FString> ActionIds;
+	TMap<FName, uint32> ActionIndexById;
+	ActionIds.Reserve(Resolved.ActionDefinitions.Num());
+	for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+	{
+		ActionIndexById.Add(Action.ActionId, static_cast<uint32>(ActionIds.Num()));
+		ActionIds.Add(Action.ActionId.ToString());
+	}
+
+	TArray<uint32> Refs;
+	TArray<FString> ActionRows;
+	ActionRows.Reserve(Resolved.ActionDefinitions.Num());
+	for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+	{
+		const int64 PolicyValue = PolicyEnum ? PolicyEnum->GetValueByNameString(Action.Policy) : INDEX_NONE;
+		if (PolicyValue == INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Action '%s' has unknown policy '%s'."), *Action.ActionId.ToString(), *Action.Policy);
+			return false;
+		}
+
+		const uint32 BlockedFirst = static_cast<uint32>(Refs.Num());
+		for (const FString& Tag : Action.BlockedBy)
+		{
+			Refs.Add(TagIndexByName.FindChecked(Tag));
+		}
+		const uint32 CancelsFirst = static_cast<uint32>(Refs.Num());
+		for (const FName CancelId : Action.Cancels)
+		{
+			if (const uint32* CancelIndex = ActionIndexById.Find(CancelId))
+			{
+				Refs.Add(*CancelIndex);
+			}
+		}
+		const uint32 LocksFirst = static_cast<uint32>(Refs.Num());
+		for (const FString& Lock : Action.AppliesLocks)
+		{
+			Refs.Add(TagIndexByName.FindChecked(Lock));
+		}
+		const uint32 RefsEnd = static_cast<uint32>(Refs.Num());
+
+		ActionRows.Add(FString::Printf(
+			TEXT("\t\t{ %s, %s, EOmniActionPolicy::%s, %s, %s, %s },"),
+			*OmniForgeCodeWriter::QuoteLiteral(Action.ActionId.ToString()),
+			Action.bEnabled ? TEXT("true") : TEXT("false"),
+			*PolicyEnum->GetNameStringByValue(PolicyValue),
+			*OmniForgeCodeWriter::FormatRange(BlockedFirst, CancelsFirst - BlockedFirst),
+			*OmniForgeCodeWriter::FormatRange(CancelsFirst, LocksFirst - CancelsFirst),
+			*OmniForgeCodeWriter::FormatRange(LocksFirst, RefsEnd - LocksFirst)
+		));
+	}
+
+	TArray<FString> Lines;
+	Lines.Add(TEXT("// Generated by OmniForge. Do not edit: rerun omni.forge.run with code=<dir> after content changes."));
+	Lines.Add(FString::Printf(TEXT("// InputHash: %s"), *Resolved.InputHash));
+	Lines.Add(TEXT("#pragma once"));
+	Lines.Add(TEXT(""));
+	Lines.Add(TEXT("#include \"Systems/ActionGate/OmniCompiledActionTable.h\""));
+	Lines.Add(TEXT(""));
+	Lines.Add(FString::Printf(TEXT("namespace OmniCompiled::%s"), *ScopeName));
+	Lines.Add(TEXT("{"));
+
+	OmniForgeCodeWriter::AppendEnum(Lines, TEXT("EAction"), OmniForgeCodeWriter::MakeEnumerators(ActionIds));
+	OmniForgeCodeWriter::AppendEnum(Lines, TEXT("ETag"), OmniForgeCodeWriter::MakeEnumerators(UniqueTagNames));
+
+	if (UniqueTagNames.Num() > 0)
+	{
+		Lines.Add(TEXT("\tinline constexpr const TCHAR* TagNames[] ="));
+		Lines.Add(TEXT("\t{"));
+		for (const FString& TagName : UniqueTagNames)
+		{
+			Lines.Add(FString::Printf(TEXT("\t\t%s,"), *OmniForgeCodeWriter::QuoteLiteral(TagName)));
+		}
+		Lines.Add(TEXT("\t};"));
+		Lines.Add(TEXT(""));
+	}
+
+	if (Refs.Num() > 0)
+	{
+		Lines.Add(TEXT("\tinline constexpr uint32 Refs[] ="));
+		Lines.Add(TEXT("\t{"));
+		for (int32 First = 0; First < Refs.Num(); First += 16)
+		{
+			TArray<FString> Row;
+			for (int32 Index = First; Index < FMath::Min(First + 16, Refs.Num()); ++Index)
+			{
+				Row.Add(FString::Printf(TEXT("%u"), Refs[Index]));
+			}
+			Lines.Add(FString::Printf(TEXT("\t\t%s,"), *FString::Join(Row, TEXT(", "))));
+		}
+		Lines.Add(TEXT("\t};"));
+		Lines.Add(TEXT(""));
+	}
+
+	Lines.Add(TEXT("\tinline constexpr FOmniCompiledActionRecord Actions[] ="));
+	Lines.Add(TEXT("\t{"));
+	Lines.Append(ActionRows);
+	Lines.Add(TEXT("\t};"));
+	Lines.Add(TEXT(""));
+
+	Lines.Add(TEXT("\tinline constexpr FOmniCompiledActionTable Table ="));
+	Lines.Add(TEXT("\t{"));
+	Lines.Add(FString::Printf(TEXT("\t\t%s,"), *OmniForgeCodeWriter::QuoteLiteral(Resolved.Namespace)));
+	Lines.Add(FString::Printf(TEXT("\t\t%d,"), Resolved.BuildVersion));
+	Lines.Add(FString::Printf(TEXT("\t\t%s,"), *OmniForgeCodeWriter::QuoteLiteral(Resolved.InputHash)));
+	Lines.Add(FString::Printf(TEXT("\t\t%s,"), *OmniForgeCodeWriter::QuoteLiteral(ActionProfile->ProfileAssetPath)));
+	Lines.Add(FString::Printf(TEXT("\t\t%s,"), *OmniForgeCodeWriter::QuoteLiteral(ActionProfile->LibraryAssetPath)));
+	Lines.Add(TEXT("\t\tActions,"));
+	Lines.Add(TEXT("\t\tUE_ARRAY_COUNT(Actions),"));
+	Lines.Add(UniqueTagNames.Num() > 0 ? TEXT("\t\tTagNames,") : TEXT("\t\tnullptr,"));
+	Lines.Add(UniqueTagNames.Num() > 0 ? TEXT("\t\tUE_ARRAY_COUNT(TagNames),") : TEXT("\t\t0,"));
+	Lines.Add(Refs.Num() > 0 ? TEXT("\t\tRefs,") : TEXT("\t\tnullptr,"));
+	Lines.Add(Refs.Num() > 0 ? TEXT("\t\tUE_ARRAY_COUNT(Refs)") : TEXT("\t\t0"));
+	Lines.Add(TEXT("\t};"));
+	Lines.Add(TEXT(""));
+	Lines.Add(TEXT("\tstatic_assert(static_cast<uint32>(UE_ARRAY_COUNT(Actions)) == static_cast<uint32>(EAction::Count), \"Action table out of sync with EAction.\");"));
+	Lines.Add(TEXT(""));
+	Lines.Add(TEXT("\tinline const FOmniCompiledActionTableRegistrar Registrar(Table);"));
+	Lines.Add(TEXT("}"));
+	Lines.Add(TEXT(""));
+
+	OutSource = FString::Join(Lines, TEXT("\n"));
+	return true;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Forge/OmniForgeTypes.h"
+
+// Emits the ActionGate definitions of a resolved manifest as a C++ header (OmniCompiledActions_<Namespace>_v<Build>.h)
+// with constexpr index enums and static tables that register an FOmniCompiledActionTable when compiled into a module.
+class FOmniForgeCodeWriter
+{
+public:
+	static bool BuildSource(const FOmniForgeResolved& Resolved, FString& OutFileName, FString& OutSource, FString& OutError);
+};
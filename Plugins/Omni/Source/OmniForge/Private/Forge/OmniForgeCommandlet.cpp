@@ -0,0 +1,256 @@
+#include "Forge/OmniForgeCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Forge/OmniForgeRunner.h"
+#include "Manifest/OmniManifest.h"
+#include "Manifest/OmniOfficialManifest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOmniForgeBatch, Log, All);
+
+namespace OmniForgeCommandlet
+{
+	static constexpr TCHAR DefaultOutputFolder[] = TEXT("Omni/Batch");
+	static constexpr TCHAR BatchReportFile[] = TEXT("ForgeBatchReport.md");
+
+	static bool IsWildcard(const FString& Entry)
+	{
+		return Entry.Contains(TEXT("*")) || Entry.Contains(TEXT("?"));
+	}
+
+	static void ExpandWildcard(const FString& Pattern, TArray<FString>& OutManifests)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByClass(UOmniManifest::StaticClass()->GetClassPathName(), Assets, true);
+
+		TArray<FString> Matches;
+		for (const FAssetData& Asset : Assets)
+		{
+			const FString ObjectPath = Asset.GetSoftObjectPath().ToString();
+			if (ObjectPath.MatchesWildcard(Pattern) || Asset.PackageName.ToString().MatchesWildcard(Pattern))
+			{
+				Matches.Add(ObjectPath);
+			}
+		}
+
+		if (Matches.Num() == 0)
+		{
+			UE_LOG(LogOmniForgeBatch, Warning, TEXT("No UOmniManifest asset matches %s"), *Pattern);
+		}
+
+		Matches.Sort();
+		OutManifests.Append(Matches);
+	}
+
+	static TArray<FString> CollectManifests(const FString& ManifestsParam)
+	{
+		TArray<FString> Entries;
+		ManifestsParam.ParseIntoArray(Entries, TEXT(";"), true);
+
+		TArray<FString> Manifests;
+		for (FString& Entry : Entries)
+		{
+			Entry.TrimStartAndEndInline();
+			if (Entry.IsEmpty())
+			{
+				continue;
+			}
+
+			if (IsWildcard(Entry))
+			{
+				ExpandWildcard(Entry, Manifests);
+			}
+			else
+			{
+				Manifests.Add(Entry);
+			}
+		}
+
+		// Order is kept; duplicates would only race on the same output folder.
+		TArray<FString> Unique;
+		for (const FString& Manifest : Manifests)
+		{
+			Unique.AddUnique(Manifest);
+		}
+		return Unique;
+	}
+
+	static bool IsClassPath(const FString& Entry)
+	{
+		return Entry.StartsWith(TEXT("/Script/"));
+	}
+
+	static FString GetManifestName(const FString& Entry)
+	{
+		FString Name = FPackageName::ObjectPathToObjectName(Entry);
+		if (Name.IsEmpty())
+		{
+			Name = FPaths::GetBaseFilename(Entry);
+		}
+		return FPaths::MakeValidFileName(Name, TEXT('_'));
+	}
+
+	static FString BuildBatchReportMarkdown(
+		const TArray<FString>& Manifests,
+		const TArray<FString>& OutputDirs,
+		const TArray<FOmniForgeResult>& Results,
+		const int32 FailedCount
+	)
+	{
+		TArray<FString> Lines;
+		Lines.Add(TEXT("# OMNI Forge Batch Report"));
+		Lines.Add(TEXT(""));
+		Lines.Add(FString::Printf(TEXT("- Status: %s"), FailedCount == 0 ? TEXT("PASS") : TEXT("FAIL")));
+		Lines.Add(FString::Printf(TEXT("- Manifests: %d"), Results.Num()));
+		Lines.Add(FString::Printf(TEXT("- Failed: %d"), FailedCount));
+		Lines.Add(TEXT(""));
+		Lines.Add(TEXT("| Manifest | Status | Errors | Warnings | Systems | Actions | inputHash | Output |"));
+		Lines.Add(TEXT("|---|---|---|---|---|---|---|---|"));
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FOmniForgeReport& Report = Results[Index].Report;
+			Lines.Add(
+				FString::Printf(
+					TEXT("| `%s` | %s | %d | %d | %d | %d | %s | `%s` |"),
+					*Manifests[Index],
+					Report.bPassed ? TEXT("PASS") : TEXT("FAIL"),
+					Report.ErrorCount,
+					Report.WarningCount,
+					Report.SystemCount,
+					Report.ActionCount,
+					Report.InputHash.IsEmpty() ? TEXT("-") : *Report.InputHash,
+					*OutputDirs[Index]
+				)
+			);
+		}
+		Lines.Add(TEXT(""));
+
+		return FString::Join(Lines, TEXT("\n"));
+	}
+}
+
+UOmniForgeCommandlet::UOmniForgeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UOmniForgeCommandlet::Main(const FString& Params)
+{
+	FString ManifestsParam;
+	FParse::Value(*Params, TEXT("Manifests="), ManifestsParam, false);
+
+	TArray<FString> Manifests = OmniForgeCommandlet::CollectManifests(ManifestsParam);
+	if (ManifestsParam.IsEmpty())
+	{
+		// Same default as omni.forge.run: the official manifest class.
+		Manifests.Add(FSoftClassPath(UOmniOfficialManifest::StaticClass()).ToString());
+	}
+	if (Manifests.Num() == 0)
+	{
+		UE_LOG(LogOmniForgeBatch, Error, TEXT("No manifests found for -Manifests=%s"), *ManifestsParam);
+		return 1;
+	}
+
+	FString OutputRoot = FPaths::Combine(FPaths::ProjectSavedDir(), OmniForgeCommandlet::DefaultOutputFolder);
+	FParse::Value(*Params, TEXT("Output="), OutputRoot);
+	OutputRoot = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), OutputRoot);
+	FString CodeRoot;
+	if (FParse::Value(*Params, TEXT("Code="), CodeRoot))
+	{
+		CodeRoot = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), CodeRoot);
+	}
+
+	FOmniForgeInput Template;
+	FParse::Value(*Params, TEXT("Root="), Template.GenerationRoot);
+	FParse::Bool(*Params, TEXT("RequireContentAssets="), Template.bRequireContentAssets);
+	FParse::Bool(*Params, TEXT("Cache="), Template.bUseCache);
+	FParse::Bool(*Params, TEXT("Parallel="), Template.bParallelResolve);
+
+	TArray<FOmniForgeInput> Inputs;
+	TArray<FString> ManifestLabels;
+	TArray<FString> OutputDirs;
+	TSet<FString> UsedNames;
+	for (const FString& Manifest : Manifests)
+	{
+		FOmniForgeInput& Input = Inputs.Add_GetRef(Template);
+		if (OmniForgeCommandlet::IsClassPath(Manifest))
+		{
+			Input.ManifestClassPath = FSoftClassPath(Manifest);
+		}
+		else
+		{
+			Input.ManifestAssetPath = FSoftObjectPath(Manifest);
+		}
+		const FString Name = OmniForgeCommandlet::GetManifestName(Manifest);
+
+		// Two packages can hold manifests with the same object name; suffix so each keeps its own folder.
+		FString UniqueName = Name;
+		for (int32 Suffix = 2; UsedNames.Contains(UniqueName); ++Suffix)
+		{
+			UniqueName = FString::Printf(TEXT("%s_%d"), *Name, Suffix);
+		}
+		UsedNames.Add(UniqueName);
+
+		Input.OutputDirectory = FPaths::Combine(OutputRoot, UniqueName);
+		// One folder per manifest: outputs of different manifests are written concurrently.
+		if (!CodeRoot.IsEmpty())
+		{
+			Input.CodeOutputDirectory = FPaths::Combine(CodeRoot, UniqueName);
+		}
+		ManifestLabels.Add(Manifest);
+		OutputDirs.Add(Input.OutputDirectory);
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const TArray<FOmniForgeResult> Results = UOmniForgeRunner::RunBatch(Inputs);
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+	int32 FailedCount = 0;
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		const FOmniForgeReport& Report = Results[Index].Report;
+		if (!Results[Index].bSuccess)
+		{
+			++FailedCount;
+		}
+
+		UE_LOG(
+			LogOmniForgeBatch,
+			Display,
+			TEXT("%s: %s | Errors=%d Warnings=%d | Report=%s"),
+			*ManifestLabels[Index],
+			Report.bPassed ? TEXT("PASS") : TEXT("FAIL"),
+			Report.ErrorCount,
+			Report.WarningCount,
+			*Report.OutputReportPath
+		);
+	}
+
+	const FString BatchReportPath = FPaths::Combine(OutputRoot, OmniForgeCommandlet::BatchReportFile);
+	const FString Markdown = OmniForgeCommandlet::BuildBatchReportMarkdown(ManifestLabels, OutputDirs, Results, FailedCount);
+	if (!FFileHelper::SaveStringToFile(Markdown, *BatchReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogOmniForgeBatch, Error, TEXT("Failed to write file: %s"), *BatchReportPath);
+	}
+
+	UE_LOG(
+		LogOmniForgeBatch,
+		Display,
+		TEXT("Forged %d manifest(s): %d failed. Time=%.3fs Report=%s"),
+		Results.Num(),
+		FailedCount,
+		ElapsedSeconds,
+		*BatchReportPath
+	);
+
+	return FailedCount;
+}
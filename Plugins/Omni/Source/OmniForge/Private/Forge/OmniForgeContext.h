@@ -1,8 +1,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Forge/OmniForgeCache.h"
 #include "Forge/OmniForgeTypes.h"
 
+class FOmniForgeAssetCache;
 class UOmniManifest;
 
 struct FForgeContext
@@ -19,7 +21,14 @@ struct FForgeContext
 	FOmniForgeResolved Resolved;
 
 	FOmniForgeReport Report;
-	FString SavedOmniDir;
+	FOmniForgeCache Cache;
+	// Shared between contexts when several manifests run in one batch.
+	FOmniForgeAssetCache* Assets = nullptr;
+	FString OutputDir;
+	FString DisplayOutputDir;
 	FString ResolvedManifestOutputFile;
+	FString CookedManifestOutputFile;
 	bool bCanResolveAfterValidate = false;
+	// Batch item whose OutputDir belongs to an earlier item: it reports the error but writes and deletes nothing.
+	bool bOutputDirRejected = false;
 };
@@ -0,0 +1,241 @@
+#include "Forge/OmniForgeCookedWriter.h"
+
+#include "Containers/StringConv.h"
+#include "Manifest/OmniCookedManifest.h"
+
+namespace OmniForgeCookedWriter
+{
+	using namespace OmniCookedManifestFormat;
+
+	struct FImageBuilder
+	{
+		TArray<FStringEntry> Strings;
+		TArray<uint8> StringData;
+		TMap<FString, uint32> StringIndexByValue;
+		TArray<uint32> Refs;
+
+		uint32 AddString(const FString& Value)
+		{
+			if (const uint32* Existing = StringIndexByValue.Find(Value))
+			{
+				return *Existing;
+			}
+
+			const FTCHARToUTF8 Utf8(*Value, Value.Len());
+			FStringEntry& Entry = Strings.AddDefaulted_GetRef();
+			Entry.Offset = static_cast<uint32>(StringData.Num());
+			Entry.Length = static_cast<uint32>(Utf8.Length());
+			StringData.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			StringData.Add(0);
+
+			const uint32 Index = static_cast<uint32>(Strings.Num() - 1);
+			StringIndexByValue.Add(Value, Index);
+			return Index;
+		}
+
+		uint32 AddString(const FName Value)
+		{
+			return AddString(Value.ToString());
+		}
+
+		FRange AddRefs(const TArray<uint32>& Indices)
+		{
+			FRange Range;
+			Range.First = static_cast<uint32>(Refs.Num());
+			Range.Count = static_cast<uint32>(Indices.Num());
+			Refs.Append(Indices);
+			return Range;
+		}
+	};
+
+	static bool TryParsePolicy(const FString& Policy, uint8& OutPolicy)
+	{
+		const UEnum* PolicyEnum = StaticEnum<EOmniActionPolicy>();
+		const int64 Value = PolicyEnum ? PolicyEnum->GetValueByNameString(Policy) : INDEX_NONE;
+		if (Value == INDEX_NONE)
+		{
+			return false;
+		}
+
+		OutPolicy = static_cast<uint8>(Value);
+		return true;
+	}
+
+	template <typename RecordType>
+	static void AppendSection(TArray<uint8>& Image, FSection& OutSection, const TArray<RecordType>& Records)
+	{
+		Image.AddZeroed(Align(Image.Num(), SectionAlignment) - Image.Num());
+		OutSection.Offset = static_cast<uint32>(Image.Num());
+		OutSection.Count = static_cast<uint32>(Records.Num());
+		Image.Append(reinterpret_cast<const uint8*>(Records.GetData()), Records.Num() * sizeof(RecordType));
+	}
+}
+
+bool FOmniForgeCookedWriter::BuildImage(const FOmniForgeResolved& Resolved, TArray<uint8>& OutImage, FString& OutError)
+{
+	using namespace OmniCookedManifestFormat;
+
+	OutImage.Reset();
+	OutError.Reset();
+
+	OmniForgeCookedWriter::FImageBuilder Builder;
+	FHeader Header;
+	Header.Magic = OmniCookedManifestFormat::Magic;
+	Header.Version = OmniCookedManifestFormat::Version;
+	Header.HeaderSize = sizeof(FHeader);
+	Header.ForgeVersion = static_cast<uint32>(Resolved.ForgeVersion);
+	Header.BuildVersion = Resolved.BuildVersion;
+	Header.Namespace = Builder.AddString(Resolved.Namespace);
+	Header.GenerationRoot = Builder.AddString(Resolved.GenerationRoot);
+	Header.InputHash = Builder.AddString(Resolved.InputHash);
+
+	TMap<FName, uint32> SystemIndexById;
+	SystemIndexById.Reserve(Resolved.Systems.Num());
+	for (int32 SystemIndex = 0; SystemIndex < Resolved.Systems.Num(); ++SystemIndex)
+	{
+		SystemIndexById.Add(Resolved.Systems[SystemIndex].SystemId, static_cast<uint32>(SystemIndex));
+	}
+
+	TArray<FSystemRecord> Systems;
+	Systems.Reserve(Resolved.Systems.Num());
+	TArray<uint32> Indices;
+	for (const FOmniForgeResolvedSystem& System : Resolved.Systems)
+	{
+		Indices.Reset();
+		for (const FName Dependency : System.Dependencies)
+		{
+			const uint32* DependencyIndex = SystemIndexById.Find(Dependency);
+			if (!DependencyIndex)
+			{
+				OutError = FString::Printf(
+					TEXT("System '%s' depends on unknown system '%s'."),
+					*System.SystemId.ToString(),
+					*Dependency.ToString()
+				);
+				return false;
+			}
+			Indices.Add(*DependencyIndex);
+		}
+
+		FSystemRecord& Record = Systems.AddDefaulted_GetRef();
+		Record.SystemId = Builder.AddString(System.SystemId);
+		Record.ClassPath = Builder.AddString(System.SystemClassPath);
+		Record.Dependencies = Builder.AddRefs(Indices);
+	}
+
+	TArray<uint32> InitOrder;
+	InitOrder.Reserve(Resolved.InitializationOrder.Num());
+	for (const FName SystemId : Resolved.InitializationOrder)
+	{
+		const uint32* SystemIndex = SystemIndexById.Find(SystemId);
+		if (!SystemIndex)
+		{
+			OutError = FString::Printf(TEXT("Initialization order references unknown system '%s'."), *SystemId.ToString());
+			return false;
+		}
+		InitOrder.Add(*SystemIndex);
+	}
+
+	TArray<FProfileRecord> Profiles;
+	Profiles.Reserve(Resolved.Profiles.Num());
+	for (const FOmniForgeResolvedProfile& Profile : Resolved.Profiles)
+	{
+		const uint32* SystemIndex = SystemIndexById.Find(Profile.SystemId);
+		FProfileRecord& Record = Profiles.AddDefaulted_GetRef();
+		Record.SystemIndex = SystemIndex ? *SystemIndex : InvalidIndex;
+		Record.SettingKey = Builder.AddString(Profile.SettingKey);
+		Record.ProfileAssetPath = Builder.AddString(Profile.ProfileAssetPath);
+		Record.ProfileClassPath = Builder.AddString(Profile.ProfileClassPath);
+		Record.LibraryAssetPath = Builder.AddString(Profile.LibraryAssetPath);
+		Record.LibraryClassPath = Builder.AddString(Profile.LibraryClassPath);
+	}
+
+	// Tag indices follow sorted tag names so identical content always produces identical images.
+	TArray<FString> TagNames;
+	for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+	{
+		TagNames.Append(Action.BlockedBy);
+		TagNames.Append(Action.AppliesLocks);
+	}
+	TagNames.Sort();
+	TArray<uint32> Tags;
+	TMap<FString, uint32> TagIndexByName;
+	for (const FString& TagName : TagNames)
+	{
+		if (!TagIndexByName.Contains(TagName))
+		{
+			TagIndexByName.Add(TagName, static_cast<uint32>(Tags.Num()));
+			Tags.Add(Builder.AddString(TagName));
+		}
+	}
+
+	TMap<FName, uint32> ActionIndexById;
+	ActionIndexById.Reserve(Resolved.ActionDefinitions.Num());
+	for (int32 ActionIndex = 0; ActionIndex < Resolved.ActionDefinitions.Num(); ++ActionIndex)
+	{
+		ActionIndexById.Add(Resolved.ActionDefinitions[ActionIndex].ActionId, static_cast<uint32>(ActionIndex));
+	}
+
+	TArray<FActionRecord> Actions;
+	Actions.Reserve(Resolved.ActionDefinitions.Num());
+	for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+	{
+		FActionRecord& Record = Actions.AddDefaulted_GetRef();
+		Record.ActionId = Builder.AddString(Action.ActionId);
+		Record.bEnabled = Action.bEnabled ? 1 : 0;
+		if (!OmniForgeCookedWriter::TryParsePolicy(Action.Policy, Record.Policy))
+		{
+			OutError = FString::Printf(TEXT("Action '%s' has unknown policy '%s'."), *Action.ActionId.ToString(), *Action.Policy);
+			return false;
+		}
+
+		Indices.Reset();
+		for (const FString& Tag : Action.BlockedBy)
+		{
+			Indices.Add(TagIndexByName.FindChecked(Tag));
+		}
+		Record.BlockedBy = Builder.AddRefs(Indices);
+
+		// Unknown cancel targets are dropped, as the runtime does when it loads definitions.
+		Indices.Reset();
+		for (const FName CancelId : Action.Cancels)
+		{
+			if (const uint32* CancelIndex = ActionIndexById.Find(CancelId))
+			{
+				Indices.Add(*CancelIndex);
+			}
+		}
+		Record.Cancels = Builder.AddRefs(Indices);
+
+		Indices.Reset();
+		for (const FString& Lock : Action.AppliesLocks)
+		{
+			Indices.Add(TagIndexByName.FindChecked(Lock));
+		}
+		Record.AppliesLocks = Builder.AddRefs(Indices);
+	}
+
+	OutImage.AddZeroed(sizeof(FHeader));
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Strings, Builder.Strings);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.StringData, Builder.StringData);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Systems, Systems);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.InitOrder, InitOrder);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Profiles, Profiles);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Actions, Actions);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Tags, Tags);
+	OmniForgeCookedWriter::AppendSection(OutImage, Header.Refs, Builder.Refs);
+	if (Resolved.ActionGraph.Num() == Actions.Num())
+	{
+		OmniForgeCookedWriter::AppendSection(OutImage, Header.LockBlocks, Resolved.ActionGraph.GetLockBlocksBits());
+		OmniForgeCookedWriter::AppendSection(OutImage, Header.CancelClosure, Resolved.ActionGraph.GetCancelClosureBits());
+	}
+	else if (Actions.Num() > 0)
+	{
+		OutError = TEXT("Action graph was not built for the resolved action set.");
+		return false;
+	}
+
+	Header.FileSize = static_cast<uint32>(OutImage.Num());
+	FMemory::Memcpy(OutImage.GetData(), &Header, sizeof(FHeader));
+	return true;
+}
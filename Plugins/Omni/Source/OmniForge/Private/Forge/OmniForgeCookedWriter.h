@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Forge/OmniForgeTypes.h"
+
+// Serializes a resolved manifest into the cooked image the runtime maps through FOmniCookedManifest.
+class FOmniForgeCookedWriter
+{
+public:
+	static bool BuildImage(const FOmniForgeResolved& Resolved, TArray<uint8>& OutImage, FString& OutError);
+};
@@ -1,22 +1,34 @@
 #include "Forge/OmniForgeRunner.h"
+#include "Forge/OmniForgeAssetCache.h"
+#include "Forge/OmniForgeCodeWriter.h"
 #include "Forge/OmniForgeContext.h"
+#include "Forge/OmniForgeCookedWriter.h"
 
-#include "Containers/StringConv.h"
+#include "Async/ParallelFor.h"
 #include "GenericPlatform/GenericPlatformMisc.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
 #include "Library/OmniActionLibrary.h"
 #include "Library/OmniMovementLibrary.h"
 #include "Library/OmniStatusLibrary.h"
+#include "Manifest/OmniCookedManifest.h"
+#include "Manifest/OmniHashingWriter.h"
 #include "Manifest/OmniManifest.h"
+#include "Manifest/OmniManifestHash.h"
 #include "Manifest/OmniOfficialManifest.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
 #include "Misc/Paths.h"
-#include "Misc/SecureHash.h"
+#include "Misc/ScopeExit.h"
+#include "Modules/ModuleManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
 #include "Profile/OmniActionProfile.h"
 #include "Profile/OmniMovementProfile.h"
 #include "Profile/OmniStatusProfile.h"
 #include "Serialization/JsonWriter.h"
 #include "Systems/ActionGate/OmniActionGateTypes.h"
+#include "UObject/GarbageCollection.h"
 #include "UObject/SoftObjectPath.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogOmniForge, Log, All);
@@ -29,10 +41,20 @@ namespace OmniForge
 	static constexpr TCHAR SavedFolder[] = TEXT("Omni");
 	static constexpr TCHAR ResolvedManifestFile[] = TEXT("ResolvedManifest.json");
 	static constexpr TCHAR ReportFile[] = TEXT("ForgeReport.md");
-	static constexpr TCHAR DisplayResolvedManifestPath[] = TEXT("Saved/Omni/ResolvedManifest.json");
-	static constexpr TCHAR DisplayReportPath[] = TEXT("Saved/Omni/ForgeReport.md");
+	static constexpr TCHAR CacheFile[] = TEXT("ForgeCache.json");
+	// Rule code changes invalidate fragments through the module fingerprint in the entry key; bump for format changes.
+	static constexpr int32 CacheVersion = 5;
+	// Modules whose C++ decides what a system fragment contains.
+	static const TCHAR* const RuleModuleNames[] = { TEXT("OmniForge"), TEXT("OmniRuntime"), TEXT("OmniCore") };
+	static constexpr TCHAR DefaultDisplayOutputDir[] = TEXT("Saved/Omni");
 	static constexpr TCHAR DisallowedActionPrefix[] = TEXT("Input.");
 
+	// Canonical documents are hashed as condensed UTF-8; the resolved manifest keeps its pretty layout on disk.
+	using FCanonicalJsonWriter = TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>;
+	using FCanonicalJsonWriterFactory = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>;
+	using FResolvedJsonWriter = TJsonWriter<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>;
+	using FResolvedJsonWriterFactory = TJsonWriterFactory<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>;
+
 	enum class EProfileRuleKind : uint8
 	{
 		None,
@@ -49,6 +71,21 @@ namespace OmniForge
 		FString LibraryClassName;
 	};
 
+	// Assets loaded on the game thread before validation fans out to workers.
+	struct FPreloadedAssets
+	{
+		UObject* ProfileObject = nullptr;
+		UObject* LibraryObject = nullptr;
+		// Action profile ancestors, nearest first; cached fragments depend on their packages too.
+		TArray<FString> ParentProfilePaths;
+		// Action profiles: chain, effective library and merged definitions resolved on the game thread, so workers
+		// never reach ParentProfile/ActionLibrary LoadSynchronous.
+		bool bProfileChainValid = true;
+		FString ProfileChainError;
+		FSoftObjectPath ActionLibraryPath;
+		FOmniResolvedActionDefinitions ActionDefinitions;
+	};
+
 	static FString SeverityToString(const EOmniForgeErrorSeverity Severity)
 	{
 		return Severity == EOmniForgeErrorSeverity::Error ? TEXT("ERROR") : TEXT("WARNING");
@@ -297,79 +334,84 @@ namespace OmniForge
 		);
 	}
 
-	static bool BuildNormalizedInputJsonString(const FOmniForgeNormalized& Normalized, FString& OutJson)
+	static void WriteNormalizedSystem(const TSharedRef<FCanonicalJsonWriter>& Writer, const FOmniForgeNormalizedSystem& System)
 	{
-		OutJson.Reset();
-		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-
 		Writer->WriteObjectStart();
-		Writer->WriteValue(TEXT("namespace"), Normalized.Namespace);
-		Writer->WriteValue(TEXT("buildVersion"), Normalized.BuildVersion);
+		Writer->WriteValue(TEXT("systemId"), System.SystemId.ToString());
+		Writer->WriteValue(TEXT("systemClassPath"), System.SystemClassPath);
 
-		Writer->WriteArrayStart(TEXT("systems"));
-		for (const FOmniForgeNormalizedSystem& System : Normalized.Systems)
+		Writer->WriteArrayStart(TEXT("dependencies"));
+		for (const FName Dependency : System.Dependencies)
 		{
-			Writer->WriteObjectStart();
-			Writer->WriteValue(TEXT("systemId"), System.SystemId.ToString());
-			Writer->WriteValue(TEXT("systemClassPath"), System.SystemClassPath);
-
-			Writer->WriteArrayStart(TEXT("dependencies"));
-			for (const FName Dependency : System.Dependencies)
-			{
-				Writer->WriteValue(Dependency.ToString());
-			}
-			Writer->WriteArrayEnd();
-
-			TArray<FName> SettingKeys;
-			System.GetSettingKeys(SettingKeys);
-			SettingKeys.Sort(FNameLexicalLess());
+			Writer->WriteValue(Dependency.ToString());
+		}
+		Writer->WriteArrayEnd();
 
-			Writer->WriteObjectStart(TEXT("settings"));
-			for (const FName SettingKey : SettingKeys)
-			{
-				const FString* SettingValue = nullptr;
-				System.TryGetSettingPtr(SettingKey, SettingValue);
-				Writer->WriteValue(SettingKey.ToString(), SettingValue ? *SettingValue : FString());
-			}
-			Writer->WriteObjectEnd();
+		TArray<FName> SettingKeys;
+		System.GetSettingKeys(SettingKeys);
+		SettingKeys.Sort(FNameLexicalLess());
 
-			Writer->WriteObjectEnd();
+		Writer->WriteObjectStart(TEXT("settings"));
+		for (const FName SettingKey : SettingKeys)
+		{
+			const FString* SettingValue = nullptr;
+			System.TryGetSettingPtr(SettingKey, SettingValue);
+			Writer->WriteValue(SettingKey.ToString(), SettingValue ? *SettingValue : FString());
 		}
-		Writer->WriteArrayEnd();
 		Writer->WriteObjectEnd();
 
-		return Writer->Close();
+		Writer->WriteObjectEnd();
 	}
 
-	static bool ComputeNormalizedInputHash(const FOmniForgeNormalized& Normalized, FString& OutHash)
+	// Timestamps of the rule modules' binaries (the executable in monolithic builds), so any rebuild of the
+	// validation code misses the cache without anyone remembering to bump CacheVersion.
+	static FString ComputeRuleCodeFingerprint()
 	{
-		OutHash.Reset();
-
-		FString CanonicalInputJson;
-		if (!BuildNormalizedInputJsonString(Normalized, CanonicalInputJson))
+		FString Fingerprint;
+		for (const TCHAR* ModuleName : RuleModuleNames)
 		{
-			return false;
+			FString ModuleFile = FModuleManager::Get().GetModuleFilename(ModuleName);
+			if (ModuleFile.IsEmpty())
+			{
+				ModuleFile = FPlatformProcess::ExecutablePath();
+			}
+			Fingerprint += FString::Printf(TEXT("%s=%lld;"), ModuleName, IFileManager::Get().GetTimeStamp(*ModuleFile).GetTicks());
 		}
+		return Fingerprint;
+	}
 
-		FTCHARToUTF8 Utf8Data(*CanonicalInputJson);
-		if (Utf8Data.Length() < 0)
+	// Cache key of one system's validation: its normalized manifest entry plus everything else Resolve reads.
+	static bool ComputeSystemEntryKey(
+		const FOmniForgeNormalizedSystem& System,
+		const bool bRequireContentAssets,
+		const FString& RuleCodeFingerprint,
+		FString& OutKey
+	)
+	{
+		FOmniHashingWriter HashWriter(EOmniHashKind::Fast);
+		const TSharedRef<FCanonicalJsonWriter> Writer = FCanonicalJsonWriterFactory::Create(&HashWriter);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("cacheVersion"), CacheVersion);
+		Writer->WriteValue(TEXT("forgeVersion"), ForgeVersion);
+		Writer->WriteValue(TEXT("ruleCode"), RuleCodeFingerprint);
+		Writer->WriteArrayStart(TEXT("systemClassChain"));
+		for (const UClass* Class = FSoftClassPath(System.SystemClassPath).ResolveClass(); Class; Class = Class->GetSuperClass())
 		{
-			return false;
+			Writer->WriteValue(Class->GetPathName());
 		}
-		if (Utf8Data.Length() > MAX_uint32)
+		Writer->WriteArrayEnd();
+		Writer->WriteValue(TEXT("requireContentAssets"), bRequireContentAssets);
+		Writer->WriteIdentifierPrefix(TEXT("system"));
+		WriteNormalizedSystem(Writer, System);
+		Writer->WriteObjectEnd();
+		if (!Writer->Close())
 		{
+			OutKey.Reset();
 			return false;
 		}
 
-		uint8 HashBytes[FSHA1::DigestSize];
-		FSHA1::HashBuffer(
-			reinterpret_cast<const uint8*>(Utf8Data.Get()),
-			static_cast<uint32>(Utf8Data.Length()),
-			HashBytes
-		);
-
-		OutHash = BytesToHex(HashBytes, UE_ARRAY_COUNT(HashBytes));
-		return !OutHash.IsEmpty();
+		OutKey = FOmniHashingWriter::FastHashToHex(HashWriter.FinalizeFast());
+		return true;
 	}
 
 	static bool BuildInitializationOrder(
@@ -512,10 +554,113 @@ namespace OmniForge
 		return Action;
 	}
 
+	static FSoftObjectPath GetProfileLibraryPath(UObject* ProfileObject, const EProfileRuleKind Kind)
+	{
+		switch (Kind)
+		{
+		case EProfileRuleKind::Action:
+			if (UOmniActionProfile* ActionProfile = Cast<UOmniActionProfile>(ProfileObject))
+			{
+				return ActionProfile->GetEffectiveActionLibrary().ToSoftObjectPath();
+			}
+			break;
+		case EProfileRuleKind::Status:
+			if (UOmniStatusProfile* StatusProfile = Cast<UOmniStatusProfile>(ProfileObject))
+			{
+				return StatusProfile->StatusLibrary.ToSoftObjectPath();
+			}
+			break;
+		case EProfileRuleKind::Movement:
+			if (UOmniMovementProfile* MovementProfile = Cast<UOmniMovementProfile>(ProfileObject))
+			{
+				return MovementProfile->MovementLibrary.ToSoftObjectPath();
+			}
+			break;
+		default:
+			break;
+		}
+
+		return FSoftObjectPath();
+	}
+
+	// Game thread only. Also resolves the action profile chain, effective library and merged definitions, and the
+	// status/movement soft library pointers, so validation workers only read loaded objects.
+	static void PreloadProfileAssets(
+		const FOmniForgeNormalizedSystem& System,
+		const FExpectedProfileRule& Rule,
+		FOmniForgeAssetCache& Assets,
+		FPreloadedAssets& OutPreloaded
+	)
+	{
+		check(IsInGameThread());
+		OutPreloaded = FPreloadedAssets();
+
+		const FString* RawPath = nullptr;
+		if (!System.TryGetSettingPtr(Rule.SettingKey, RawPath) || !RawPath || RawPath->IsEmpty())
+		{
+			return;
+		}
+
+		const FString ProfilePath = NormalizeObjectPath(*RawPath);
+		const FSoftObjectPath SoftPath(ProfilePath);
+		if (!ProfilePath.StartsWith(TEXT("/Game/")) || SoftPath.IsNull())
+		{
+			return;
+		}
+
+		OutPreloaded.ProfileObject = Assets.Load(SoftPath);
+		UOmniActionProfile* ActionProfile = Cast<UOmniActionProfile>(OutPreloaded.ProfileObject);
+		if (ActionProfile)
+		{
+			for (const UOmniActionProfile* Profile = ActionProfile; Profile && !Profile->ParentProfile.IsNull(); )
+			{
+				const FSoftObjectPath ParentPath = Profile->ParentProfile.ToSoftObjectPath();
+				if (OutPreloaded.ParentProfilePaths.Contains(ParentPath.ToString())
+					|| OutPreloaded.ParentProfilePaths.Num() >= UOmniActionProfile::MaxParentDepth)
+				{
+					break;
+				}
+				OutPreloaded.ParentProfilePaths.Add(ParentPath.ToString());
+				Assets.Load(ParentPath);
+				Profile = Profile->ParentProfile.Get();
+			}
+
+			TArray<const UOmniActionProfile*> ProfileChain;
+			OutPreloaded.bProfileChainValid = ActionProfile->TryGetProfileChain(ProfileChain, OutPreloaded.ProfileChainError);
+			if (!OutPreloaded.bProfileChainValid)
+			{
+				return;
+			}
+			OutPreloaded.ActionLibraryPath = ActionProfile->GetEffectiveActionLibrary().ToSoftObjectPath();
+		}
+		const FSoftObjectPath LibraryPath = ActionProfile
+			? OutPreloaded.ActionLibraryPath
+			: GetProfileLibraryPath(OutPreloaded.ProfileObject, Rule.Kind);
+		if (LibraryPath.IsNull())
+		{
+			return;
+		}
+
+		OutPreloaded.LibraryObject = Assets.Load(LibraryPath);
+		if (ActionProfile && OutPreloaded.LibraryObject)
+		{
+			OutPreloaded.ActionDefinitions = ActionProfile->GetResolvedDefinitions();
+		}
+		else if (UOmniStatusProfile* StatusProfile = Cast<UOmniStatusProfile>(OutPreloaded.ProfileObject))
+		{
+			StatusProfile->StatusLibrary.Get();
+		}
+		else if (UOmniMovementProfile* MovementProfile = Cast<UOmniMovementProfile>(OutPreloaded.ProfileObject))
+		{
+			MovementProfile->MovementLibrary.Get();
+		}
+	}
+
 	static bool ValidateProfileAndLibraryForSystem(
 		const FOmniForgeNormalizedSystem& System,
 		const FExpectedProfileRule& Rule,
 		const bool bRequireContentAssets,
+		const FPreloadedAssets& Preloaded,
 		FOmniForgeResolvedProfile& OutProfile,
 		TArray<FOmniForgeResolvedAction>& OutActionDefinitions,
 		FOmniForgeReport& Report
@@ -586,7 +731,7 @@ namespace OmniForge
 			return false;
 		}
 
-		UObject* LoadedProfileObject = SoftPath.TryLoad();
+		UObject* LoadedProfileObject = Preloaded.ProfileObject;
 		if (!LoadedProfileObject)
 		{
 			Report.AddError(
@@ -627,7 +772,18 @@ namespace OmniForge
 				return false;
 			}
 
-			const FSoftObjectPath LibraryPath = ActionProfile->ActionLibrary.ToSoftObjectPath();
+			if (!Preloaded.bProfileChainValid)
+			{
+				Report.AddError(
+					TEXT("OMNI_FORGE_E015_INVALID_PROFILE_CONFIG"),
+					Preloaded.ProfileChainError,
+					BuildIssueLocation(System.SystemId, Rule.SettingKey),
+					TEXT("Point ParentProfile to an existing UOmniActionProfile and keep the chain acyclic.")
+				);
+				return false;
+			}
+
+			const FSoftObjectPath& LibraryPath = Preloaded.ActionLibraryPath;
 			OutProfile.LibraryAssetPath = LibraryPath.ToString();
 			if (LibraryPath.IsNull())
 			{
@@ -635,12 +791,12 @@ namespace OmniForge
 					TEXT("OMNI_FORGE_E012_NULL_LIBRARY"),
 					FString::Printf(TEXT("Profile '%s' has null ActionLibrary."), *GetNameSafe(ActionProfile)),
 					BuildIssueLocation(System.SystemId, Rule.SettingKey),
-					TEXT("Assign a UOmniActionLibrary to ActionLibrary.")
+					TEXT("Assign a UOmniActionLibrary to ActionLibrary on the profile or one of its parents.")
 				);
 				return false;
 			}
 
-			UObject* LoadedLibraryObject = LibraryPath.TryLoad();
+			UObject* LoadedLibraryObject = Preloaded.LibraryObject;
 			if (!LoadedLibraryObject)
 			{
 				Report.AddError(
@@ -674,8 +830,8 @@ namespace OmniForge
 			}
 			OutProfile.LibraryClassPath = ActionLibrary->GetClass()->GetPathName();
 
-			TArray<FOmniActionDefinition> Definitions;
-			ActionProfile->ResolveDefinitions(Definitions);
+			static const TArray<FOmniActionDefinition> NoDefinitions;
+			const TArray<FOmniActionDefinition>& Definitions = Preloaded.ActionDefinitions ? *Preloaded.ActionDefinitions : NoDefinitions;
 			if (Definitions.Num() == 0)
 			{
 				Report.AddError(
@@ -773,7 +929,7 @@ namespace OmniForge
 				return false;
 			}
 
-			UObject* LoadedLibraryObject = LibraryPath.TryLoad();
+			UObject* LoadedLibraryObject = Preloaded.LibraryObject;
 			if (!LoadedLibraryObject)
 			{
 				Report.AddError(
@@ -819,6 +975,18 @@ namespace OmniForge
 				return false;
 			}
 
+			FString SettingsError;
+			if (!ResolvedSettings.IsValid(SettingsError))
+			{
+				Report.AddError(
+					TEXT("OMNI_FORGE_E016_INVALID_SETTINGS"),
+					FString::Printf(TEXT("Status profile '%s' resolved invalid settings: %s"), *GetNameSafe(StatusProfile), *SettingsError),
+					BuildIssueLocation(System.SystemId, Rule.SettingKey),
+					TEXT("Fix the values in StatusLibrary and/or profile overrides.")
+				);
+				return false;
+			}
+
 			return true;
 		}
 
@@ -854,7 +1022,7 @@ namespace OmniForge
 				return false;
 			}
 
-			UObject* LoadedLibraryObject = LibraryPath.TryLoad();
+			UObject* LoadedLibraryObject = Preloaded.LibraryObject;
 			if (!LoadedLibraryObject)
 			{
 				Report.AddError(
@@ -900,6 +1068,18 @@ namespace OmniForge
 				return false;
 			}
 
+			FString SettingsError;
+			if (!ResolvedSettings.IsValid(SettingsError))
+			{
+				Report.AddError(
+					TEXT("OMNI_FORGE_E016_INVALID_SETTINGS"),
+					FString::Printf(TEXT("Movement profile '%s' resolved invalid settings: %s"), *GetNameSafe(MovementProfile), *SettingsError),
+					BuildIssueLocation(System.SystemId, Rule.SettingKey),
+					TEXT("Fix the values in MovementLibrary and/or profile overrides.")
+				);
+				return false;
+			}
+
 			return true;
 		}
 
@@ -1095,9 +1275,116 @@ namespace OmniForge
 		return true;
 	}
 
-	static bool Resolve(
+	static void AddPackageDependency(const FString& ObjectPath, FOmniForgeCache& Cache, FOmniForgeSystemFragment& Fragment)
+	{
+		if (!ObjectPath.StartsWith(TEXT("/Game/")))
+		{
+			return;
+		}
+
+		const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+		if (Fragment.Dependencies.ContainsByPredicate(
+			[&PackageName](const FOmniForgeCachedDependency& Existing)
+			{
+				return Existing.PackageName == PackageName;
+			}
+		))
+		{
+			return;
+		}
+
+		FOmniForgeCachedDependency& Dependency = Fragment.Dependencies.AddDefaulted_GetRef();
+		Dependency.PackageName = PackageName;
+		Dependency.Hash = Cache.HashPackage(PackageName);
+	}
+
+	struct FPendingSystem
+	{
+		const FOmniForgeNormalizedSystem* System = nullptr;
+		FExpectedProfileRule Rule;
+		FString EntryKey;
+		bool bRequireContentAssets = true;
+		bool bCacheable = false;
+		bool bCacheHit = false;
+		FPreloadedAssets Preloaded;
+		FOmniForgeSystemFragment Fragment;
+	};
+
+	// Cache lookups, then the game-thread loads for every system that still has to be validated.
+	static void PrepareResolve(
 		const FOmniForgeNormalized& Normalized,
 		const bool bRequireContentAssets,
+		FOmniForgeCache* Cache,
+		FOmniForgeAssetCache& Assets,
+		TArray<FPendingSystem>& OutPendingSystems
+	)
+	{
+		check(IsInGameThread());
+		OutPendingSystems.Reset();
+		OutPendingSystems.Reserve(Normalized.Systems.Num());
+		const FString RuleCodeFingerprint = Cache ? ComputeRuleCodeFingerprint() : FString();
+		for (const FOmniForgeNormalizedSystem& System : Normalized.Systems)
+		{
+			const FExpectedProfileRule Rule = GetExpectedProfileRule(System.SystemId);
+			if (Rule.Kind == EProfileRuleKind::None)
+			{
+				continue;
+			}
+
+			FPendingSystem& Pending = OutPendingSystems.AddDefaulted_GetRef();
+			Pending.System = &System;
+			Pending.Rule = Rule;
+			Pending.bRequireContentAssets = bRequireContentAssets;
+			Pending.bCacheable = Cache && ComputeSystemEntryKey(System, bRequireContentAssets, RuleCodeFingerprint, Pending.EntryKey);
+			Pending.bCacheHit = Pending.bCacheable && Cache->FindValid(System.SystemId, Pending.EntryKey) != nullptr;
+			if (!Pending.bCacheHit && bRequireContentAssets)
+			{
+				PreloadProfileAssets(System, Rule, Assets, Pending.Preloaded);
+			}
+		}
+	}
+
+	static void CollectValidationWork(TArray<FPendingSystem>& PendingSystems, TArray<FPendingSystem*>& OutWork)
+	{
+		for (FPendingSystem& Pending : PendingSystems)
+		{
+			if (!Pending.bCacheHit)
+			{
+				OutWork.Add(&Pending);
+			}
+		}
+	}
+
+	static void ValidatePendingSystems(const TArray<FPendingSystem*>& Work, const bool bParallel)
+	{
+		// Validation only reads the preloaded objects; keep GC from collecting them mid-flight.
+		FGCScopeGuard GCGuard;
+		ParallelFor(
+			Work.Num(),
+			[&Work](const int32 WorkIndex)
+			{
+				FPendingSystem& Pending = *Work[WorkIndex];
+				FOmniForgeReport ShardReport;
+				Pending.Fragment.SystemId = Pending.System->SystemId;
+				Pending.Fragment.EntryKey = Pending.EntryKey;
+				Pending.Fragment.bProfileOk = ValidateProfileAndLibraryForSystem(
+					*Pending.System,
+					Pending.Rule,
+					Pending.bRequireContentAssets,
+					Pending.Preloaded,
+					Pending.Fragment.Profile,
+					Pending.Fragment.Actions,
+					ShardReport
+				);
+				Pending.Fragment.Issues = MoveTemp(ShardReport.Errors);
+			},
+			bParallel && Work.Num() > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread
+		);
+	}
+
+	static bool FinishResolve(
+		TArray<FPendingSystem>& PendingSystems,
+		FOmniForgeCache* Cache,
 		TArray<FOmniForgeResolvedProfile>& OutProfiles,
 		TArray<FOmniForgeResolvedAction>& OutActionDefinitions,
 		FOmniForgeReport& Report
@@ -1106,34 +1393,46 @@ namespace OmniForge
 		OutProfiles.Reset();
 		OutActionDefinitions.Reset();
 
-		for (const FOmniForgeNormalizedSystem& System : Normalized.Systems)
+		for (FPendingSystem& Pending : PendingSystems)
 		{
-			const FExpectedProfileRule Rule = GetExpectedProfileRule(System.SystemId);
-			if (Rule.Kind == EProfileRuleKind::None)
+			if (Pending.bCacheHit || !Pending.bCacheable)
 			{
 				continue;
 			}
 
-			FOmniForgeResolvedProfile Profile;
-			TArray<FOmniForgeResolvedAction> Actions;
-			const bool bProfileOk = ValidateProfileAndLibraryForSystem(
-				System,
-				Rule,
-				bRequireContentAssets,
-				Profile,
-				Actions,
-				Report
-			);
-			if (!bProfileOk)
+			if (Pending.bRequireContentAssets)
+			{
+				AddPackageDependency(Pending.Fragment.Profile.ProfileAssetPath, *Cache, Pending.Fragment);
+				AddPackageDependency(Pending.Fragment.Profile.LibraryAssetPath, *Cache, Pending.Fragment);
+				for (const FString& ParentProfilePath : Pending.Preloaded.ParentProfilePaths)
+				{
+					AddPackageDependency(ParentProfilePath, *Cache, Pending.Fragment);
+				}
+			}
+			Cache->Store(MoveTemp(Pending.Fragment));
+		}
+
+		// Merge shards in manifest (SystemId) order so the report and outputs match a serial run.
+		for (const FPendingSystem& Pending : PendingSystems)
+		{
+			const FOmniForgeSystemFragment* Fragment = Pending.bCacheable ? Cache->Find(Pending.System->SystemId) : &Pending.Fragment;
+			if (!Fragment)
 			{
 				continue;
 			}
 
-			OutProfiles.Add(Profile);
-			for (FOmniForgeResolvedAction& Action : Actions)
+			for (const FOmniForgeError& Issue : Fragment->Issues)
 			{
-				OutActionDefinitions.Add(MoveTemp(Action));
+				Report.AddIssue(Issue.Severity, Issue.Code, Issue.Message, Issue.Location, Issue.Recommendation);
 			}
+
+			if (!Fragment->bProfileOk)
+			{
+				continue;
+			}
+
+			OutProfiles.Add(Fragment->Profile);
+			OutActionDefinitions.Append(Fragment->Actions);
 		}
 
 		OutProfiles.Sort(
@@ -1195,10 +1494,112 @@ namespace OmniForge
 		OutResolved.ActionsCount = OutResolved.ActionDefinitions.Num();
 	}
 
-	static bool BuildResolvedJsonString(const FOmniForgeResolved& Resolved, FString& OutJson)
+	static bool TryParseActionPolicy(const FString& Policy, EOmniActionPolicy& OutPolicy)
+	{
+		const UEnum* PolicyEnum = StaticEnum<EOmniActionPolicy>();
+		const int64 Value = PolicyEnum ? PolicyEnum->GetValueByNameString(Policy) : INDEX_NONE;
+		if (Value == INDEX_NONE)
+		{
+			return false;
+		}
+
+		OutPolicy = static_cast<EOmniActionPolicy>(Value);
+		return true;
+	}
+
+	static FString JoinActionIds(const FOmniForgeResolved& Resolved, const TArray<int32>& ActionIndices)
+	{
+		return FString::JoinBy(
+			ActionIndices,
+			TEXT(", "),
+			[&Resolved](const int32 ActionIndex)
+			{
+				return Resolved.ActionDefinitions[ActionIndex].ActionId.ToString();
+			}
+		);
+	}
+
+	// Whole-graph pass over the final action set: lock/cancel matrices for the outputs plus warnings for
+	// configurations that validate per action but misbehave together.
+	static void AnalyzeActionGraph(FOmniForgeResolved& Resolved, FOmniForgeReport& Report)
 	{
-		OutJson.Reset();
-		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+		TMap<FName, int32> ActionIndexById;
+		ActionIndexById.Reserve(Resolved.ActionDefinitions.Num());
+		for (int32 ActionIndex = 0; ActionIndex < Resolved.ActionDefinitions.Num(); ++ActionIndex)
+		{
+			ActionIndexById.Add(Resolved.ActionDefinitions[ActionIndex].ActionId, ActionIndex);
+		}
+
+		TArray<FOmniActionGraphNode> Nodes;
+		Nodes.Reserve(Resolved.ActionDefinitions.Num());
+		for (const FOmniForgeResolvedAction& Action : Resolved.ActionDefinitions)
+		{
+			FOmniActionGraphNode& Node = Nodes.AddDefaulted_GetRef();
+			TryParseActionPolicy(Action.Policy, Node.Policy);
+			for (const FString& Tag : Action.BlockedBy)
+			{
+				Node.BlockedBy.Add(FName(*Tag));
+			}
+			for (const FName CancelId : Action.Cancels)
+			{
+				if (const int32* CancelIndex = ActionIndexById.Find(CancelId))
+				{
+					Node.Cancels.Add(*CancelIndex);
+				}
+			}
+			for (const FString& Lock : Action.AppliesLocks)
+			{
+				Node.AppliesLocks.Add(FName(*Lock));
+			}
+		}
+
+		FOmniActionGraphIssues Issues;
+		FOmniActionGraph::Build(Nodes, Resolved.ActionGraph, &Issues);
+
+		const FString Location = BuildIssueLocation(TEXT("ActionGate"), TEXT("ActionProfileAssetPath"));
+		for (const TArray<int32>& Cycle : Issues.CancelCycles)
+		{
+			Report.AddWarning(
+				TEXT("OMNI_FORGE_W040_ACTION_CANCEL_CYCLE"),
+				FString::Printf(TEXT("Actions cancel each other in a cycle: %s."), *JoinActionIds(Resolved, Cycle)),
+				Location,
+				TEXT("Break the cycle in Cancels; keep mutual cancels to pairs of actions.")
+			);
+		}
+		for (const int32 ActionIndex : Issues.RestartLoops)
+		{
+			Report.AddWarning(
+				TEXT("OMNI_FORGE_W041_ACTION_RESTART_LOOP"),
+				FString::Printf(
+					TEXT("Action '%s' uses RestartIfActive but is blocked by its own locks or cancels itself through a cycle."),
+					*Resolved.ActionDefinitions[ActionIndex].ActionId.ToString()
+				),
+				Location,
+				TEXT("Use DenyIfActive/SucceedIfActive, or remove the self-blocking lock or cancel chain.")
+			);
+		}
+	}
+
+	static void WriteBitMatrix(FResolvedJsonWriter& Writer, const TCHAR* Name, const FOmniActionGraph& Graph, const TArray<uint64>& Bits)
+	{
+		const int32 WordsPerRow = FOmniActionGraph::GetWordsPerRow(Graph.Num());
+		Writer.WriteArrayStart(Name);
+		for (int32 Row = 0; Row < Graph.Num(); ++Row)
+		{
+			FString RowHex;
+			RowHex.Reserve(WordsPerRow * 16);
+			for (int32 WordIndex = 0; WordIndex < WordsPerRow; ++WordIndex)
+			{
+				RowHex += FString::Printf(TEXT("%016llx"), Bits[Row * WordsPerRow + WordIndex]);
+			}
+			Writer.WriteValue(RowHex);
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	static bool WriteResolvedJson(const FOmniForgeResolved& Resolved, FArchive& Stream)
+	{
+		const TSharedRef<FResolvedJsonWriter> Writer = FResolvedJsonWriterFactory::Create(&Stream);
 
 		Writer->WriteObjectStart();
 		Writer->WriteValue(TEXT("forgeVersion"), Resolved.ForgeVersion);
@@ -1281,11 +1682,21 @@ namespace OmniForge
 		}
 		Writer->WriteArrayEnd();
 
+		Writer->WriteObjectStart(TEXT("actionGraph"));
+		Writer->WriteValue(TEXT("wordsPerRow"), FOmniActionGraph::GetWordsPerRow(Resolved.ActionGraph.Num()));
+		WriteBitMatrix(*Writer, TEXT("lockBlocks"), Resolved.ActionGraph, Resolved.ActionGraph.GetLockBlocksBits());
+		WriteBitMatrix(*Writer, TEXT("cancelClosure"), Resolved.ActionGraph, Resolved.ActionGraph.GetCancelClosureBits());
+		Writer->WriteObjectEnd();
+
 		Writer->WriteObjectEnd();
 		return Writer->Close();
 	}
 
-	static FString BuildReportMarkdown(const FOmniForgeReport& Report)
+	static FString BuildReportMarkdown(
+		const FOmniForgeReport& Report,
+		const FString& DisplayOutputDir,
+		const FString& DisplayCookedManifestPath
+	)
 	{
 		TArray<FString> Lines;
 		Lines.Reserve(64 + Report.Errors.Num() * 2);
@@ -1331,13 +1742,38 @@ namespace OmniForge
 
 		Lines.Add(TEXT("## Outputs"));
 		Lines.Add(TEXT(""));
-		Lines.Add(FString::Printf(TEXT("- ResolvedManifest: `%s`"), DisplayResolvedManifestPath));
-		Lines.Add(FString::Printf(TEXT("- Report: `%s`"), DisplayReportPath));
+		Lines.Add(FString::Printf(TEXT("- ResolvedManifest: `%s/%s`"), *DisplayOutputDir, ResolvedManifestFile));
+		Lines.Add(FString::Printf(TEXT("- CookedManifest: `%s`"), *DisplayCookedManifestPath));
+		Lines.Add(FString::Printf(TEXT("- Report: `%s/%s`"), *DisplayOutputDir, ReportFile));
+		if (!Report.OutputCompiledActionsPath.IsEmpty())
+		{
+			Lines.Add(FString::Printf(TEXT("- CompiledActions: `%s`"), *ToDisplayPath(Report.OutputCompiledActionsPath)));
+		}
 		Lines.Add(TEXT(""));
 
 		return FString::Join(Lines, TEXT("\n"));
 	}
 
+	// Relative paths are taken from the project directory, not the engine binaries directory.
+	static FString ToFullProjectPath(const FString& Path)
+	{
+		FString FullPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path);
+		FPaths::NormalizeDirectoryName(FullPath);
+		return FullPath;
+	}
+
+	// Reports show project-relative paths so they stay comparable across machines.
+	static FString ToDisplayPath(const FString& FullPath)
+	{
+		FString RelativePath = FullPath;
+		if (FPaths::MakePathRelativeTo(RelativePath, *FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()))
+			&& !RelativePath.StartsWith(TEXT("..")))
+		{
+			return RelativePath;
+		}
+		return FullPath;
+	}
+
 	static bool SaveTextFile(const FString& FilePath, const FString& Content, FString& OutError)
 	{
 		OutError.Reset();
@@ -1351,8 +1787,25 @@ namespace OmniForge
 	}
 }
 
+static void InitializeOutputDir(FForgeContext& Context)
+{
+	if (Context.Input.OutputDirectory.IsEmpty())
+	{
+		Context.OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), OmniForge::SavedFolder);
+		Context.DisplayOutputDir = OmniForge::DefaultDisplayOutputDir;
+		// The default run feeds the runtime: the image goes where the registry maps it in packaged builds too.
+		Context.CookedManifestOutputFile = FPaths::ConvertRelativePathToFull(FOmniCookedManifest::GetDefaultFilePath());
+		return;
+	}
+
+	Context.OutputDir = OmniForge::ToFullProjectPath(Context.Input.OutputDirectory);
+	Context.DisplayOutputDir = OmniForge::ToDisplayPath(Context.OutputDir);
+	Context.CookedManifestOutputFile = FPaths::Combine(Context.OutputDir, OmniCookedManifestFormat::DefaultFileName);
+}
+
 static bool PhaseNormalize(FForgeContext& Context)
 {
+	InitializeOutputDir(Context);
 	Context.EffectiveInput = Context.Input;
 	Context.EffectiveInput.GenerationRoot = OmniForge::NormalizeRootPath(Context.Input.GenerationRoot);
 
@@ -1362,11 +1815,11 @@ static bool PhaseNormalize(FForgeContext& Context)
 	OmniForge::NormalizeManifest(Context.Manifest, Context.EffectiveInput, Context.Normalized);
 	if (!Context.Report.HasErrors())
 	{
-		if (!OmniForge::ComputeNormalizedInputHash(Context.Normalized, Context.Report.InputHash))
+		if (!Context.Manifest || !FOmniManifestHash::ComputeInputHash(*Context.Manifest, Context.Report.InputHash))
 		{
 			Context.Report.AddError(
 				TEXT("OMNI_FORGE_E099_INTERNAL"),
-				TEXT("Failed to compute normalized manifest SHA256."),
+				TEXT("Failed to compute normalized manifest hash."),
 				TEXT("Normalize"),
 				TEXT("Inspect normalized manifest serialization and hashing.")
 			);
@@ -1393,17 +1846,58 @@ static bool Validate(FForgeContext& Context)
 	return Context.bCanResolveAfterValidate;
 }
 
-static bool Resolve(FForgeContext& Context)
+static FString GetCacheFilePath(const FForgeContext& Context)
+{
+	return FPaths::Combine(Context.OutputDir, OmniForge::CacheFile);
+}
+
+static void BeginResolve(FForgeContext& Context, TArray<OmniForge::FPendingSystem>& OutPendingSystems)
+{
+	OutPendingSystems.Reset();
+	if (!Context.bCanResolveAfterValidate)
+	{
+		return;
+	}
+
+	const bool bUseCache = Context.EffectiveInput.bUseCache;
+	if (bUseCache)
+	{
+		Context.Cache.Load(GetCacheFilePath(Context));
+	}
+
+	OmniForge::PrepareResolve(
+		Context.Normalized,
+		Context.EffectiveInput.bRequireContentAssets,
+		bUseCache ? &Context.Cache : nullptr,
+		*Context.Assets,
+		OutPendingSystems
+	);
+}
+
+static bool EndResolve(FForgeContext& Context, TArray<OmniForge::FPendingSystem>& PendingSystems)
 {
 	if (Context.bCanResolveAfterValidate)
 	{
-		OmniForge::Resolve(
-			Context.Normalized,
-			Context.EffectiveInput.bRequireContentAssets,
+		const bool bUseCache = Context.EffectiveInput.bUseCache;
+		OmniForge::FinishResolve(
+			PendingSystems,
+			bUseCache ? &Context.Cache : nullptr,
 			Context.Profiles,
 			Context.Actions,
 			Context.Report
 		);
+
+		Context.Report.CacheHitCount = Context.Cache.GetHitCount();
+		Context.Report.CacheMissCount = Context.Cache.GetMissCount();
+		if (bUseCache)
+		{
+			const FString CacheFilePath = GetCacheFilePath(Context);
+			IFileManager::Get().MakeDirectory(*Context.OutputDir, true);
+			if (!Context.Cache.Save(CacheFilePath))
+			{
+				UE_LOG(LogOmniForge, Warning, TEXT("Failed to write Forge cache: %s"), *CacheFilePath);
+			}
+		}
 	}
 
 	if (!Context.Report.HasErrors())
@@ -1416,6 +1910,7 @@ static bool Resolve(FForgeContext& Context)
 			Context.Report.InputHash,
 			Context.Resolved
 		);
+		OmniForge::AnalyzeActionGraph(Context.Resolved, Context.Report);
 		Context.Report.SystemCount = Context.Resolved.SystemsCount;
 		Context.Report.ActionCount = Context.Resolved.ActionsCount;
 	}
@@ -1428,41 +1923,122 @@ static bool Resolve(FForgeContext& Context)
 	return !Context.Report.HasErrors();
 }
 
+static bool Resolve(FForgeContext& Context)
+{
+	TArray<OmniForge::FPendingSystem> PendingSystems;
+	BeginResolve(Context, PendingSystems);
+
+	TArray<OmniForge::FPendingSystem*> Work;
+	OmniForge::CollectValidationWork(PendingSystems, Work);
+	OmniForge::ValidatePendingSystems(Work, Context.EffectiveInput.bParallelResolve);
+
+	return EndResolve(Context, PendingSystems);
+}
+
 static bool PhaseGenerate(FForgeContext& Context)
 {
-	Context.SavedOmniDir = FPaths::Combine(FPaths::ProjectSavedDir(), OmniForge::SavedFolder);
-	IFileManager::Get().MakeDirectory(*Context.SavedOmniDir, true);
-	Context.Report.OutputReportPath = FPaths::Combine(Context.SavedOmniDir, OmniForge::ReportFile);
-	Context.Report.OutputResolvedManifestPath = FPaths::Combine(Context.SavedOmniDir, OmniForge::ResolvedManifestFile);
+	if (Context.bOutputDirRejected)
+	{
+		return false;
+	}
+
+	IFileManager::Get().MakeDirectory(*Context.OutputDir, true);
+	Context.Report.OutputReportPath = FPaths::Combine(Context.OutputDir, OmniForge::ReportFile);
+	Context.Report.OutputResolvedManifestPath = FPaths::Combine(Context.OutputDir, OmniForge::ResolvedManifestFile);
+	Context.Report.OutputCookedManifestPath = Context.CookedManifestOutputFile;
 	Context.ResolvedManifestOutputFile = Context.Report.OutputResolvedManifestPath;
 
 	if (!Context.Report.HasErrors())
 	{
-		FString JsonOutput;
+		// Streamed as UTF-8 through a small buffer straight into the file; the document never exists as a string.
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Context.Report.OutputResolvedManifestPath));
+		bool bSerialized = true;
+		if (FileWriter)
+		{
+			FOmniHashingWriter Stream(EOmniHashKind::None, FileWriter.Get());
+			bSerialized = OmniForge::WriteResolvedJson(Context.Resolved, Stream);
+			Stream.Flush();
+		}
+		const bool bWritten = FileWriter && FileWriter->Close();
+
+		if (!bSerialized)
 		{
-			if (!OmniForge::BuildResolvedJsonString(Context.Resolved, JsonOutput))
+			Context.Report.AddError(
+				TEXT("OMNI_FORGE_E099_INTERNAL"),
+				TEXT("Failed to serialize ResolvedManifest JSON."),
+				TEXT("Generate"),
+				TEXT("Inspect resolved manifest structure for unsupported fields.")
+			);
+		}
+		else if (!bWritten)
+		{
+			Context.Report.AddError(
+				TEXT("OMNI_FORGE_E099_INTERNAL"),
+				FString::Printf(TEXT("Failed to write file: %s"), *Context.Report.OutputResolvedManifestPath),
+				TEXT("Generate"),
+				FString::Printf(TEXT("Ensure %s is writable."), *Context.DisplayOutputDir)
+			);
+		}
+
+		if (!Context.Report.HasErrors())
+		{
+			TArray<uint8> CookedImage;
+			FString CookError;
+			if (!FOmniForgeCookedWriter::BuildImage(Context.Resolved, CookedImage, CookError))
 			{
 				Context.Report.AddError(
 					TEXT("OMNI_FORGE_E099_INTERNAL"),
-					TEXT("Failed to serialize ResolvedManifest JSON."),
+					FString::Printf(TEXT("Failed to build cooked manifest: %s"), *CookError),
 					TEXT("Generate"),
 					TEXT("Inspect resolved manifest structure for unsupported fields.")
 				);
 			}
+			else if (!FFileHelper::SaveArrayToFile(CookedImage, *Context.Report.OutputCookedManifestPath))
+			{
+				Context.Report.AddError(
+					TEXT("OMNI_FORGE_E099_INTERNAL"),
+					FString::Printf(TEXT("Failed to write file: %s"), *Context.Report.OutputCookedManifestPath),
+					TEXT("Generate"),
+					FString::Printf(TEXT("Ensure %s is writable."), *Context.DisplayOutputDir)
+				);
+			}
 		}
 
-		if (!Context.Report.HasErrors())
+		if (!Context.Report.HasErrors() && !Context.Input.CodeOutputDirectory.IsEmpty())
 		{
-			FString WriteError;
-			if (!OmniForge::SaveTextFile(Context.Report.OutputResolvedManifestPath, JsonOutput, WriteError))
+			FString CodeFileName;
+			FString CodeSource;
+			FString CodeError;
+			if (!FOmniForgeCodeWriter::BuildSource(Context.Resolved, CodeFileName, CodeSource, CodeError))
 			{
 				Context.Report.AddError(
 					TEXT("OMNI_FORGE_E099_INTERNAL"),
-					WriteError,
+					FString::Printf(TEXT("Failed to generate compiled action tables: %s"), *CodeError),
 					TEXT("Generate"),
-					TEXT("Ensure Saved/Omni is writable.")
+					TEXT("Only request code output for manifests with an ActionGate profile.")
 				);
 			}
+			else
+			{
+				const FString CodeDir = OmniForge::ToFullProjectPath(Context.Input.CodeOutputDirectory);
+				IFileManager::Get().MakeDirectory(*CodeDir, true);
+				Context.Report.OutputCompiledActionsPath = FPaths::Combine(CodeDir, CodeFileName);
+
+				// Rewriting an unchanged header would still trigger a rebuild of every module that includes it.
+				FString ExistingSource;
+				const bool bUnchanged = FFileHelper::LoadFileToString(ExistingSource, *Context.Report.OutputCompiledActionsPath)
+					&& ExistingSource == CodeSource;
+				FString WriteError;
+				if (!bUnchanged && !OmniForge::SaveTextFile(Context.Report.OutputCompiledActionsPath, CodeSource, WriteError))
+				{
+					Context.Report.AddError(
+						TEXT("OMNI_FORGE_E099_INTERNAL"),
+						WriteError,
+						TEXT("Generate"),
+						FString::Printf(TEXT("Ensure %s is writable."), *OmniForge::ToDisplayPath(CodeDir))
+					);
+				}
+			}
 		}
 	}
 
@@ -1472,10 +2048,13 @@ static bool PhaseGenerate(FForgeContext& Context)
 static void PhaseReport(FForgeContext& Context)
 {
 	Context.Report.bPassed = !Context.Report.HasErrors();
-	if (!Context.Report.bPassed)
+	if (!Context.Report.bPassed && !Context.bOutputDirRejected)
 	{
 		IFileManager::Get().Delete(*Context.ResolvedManifestOutputFile, false, true, true);
+		IFileManager::Get().Delete(*Context.CookedManifestOutputFile, false, true, true);
 		Context.Report.OutputResolvedManifestPath = TEXT("(not generated)");
+		Context.Report.OutputCookedManifestPath = TEXT("(not generated)");
+		Context.Report.OutputCompiledActionsPath.Reset();
 	}
 
 	Context.Report.Summary = Context.Report.bPassed
@@ -1490,8 +2069,13 @@ static void PhaseReport(FForgeContext& Context)
 			Context.Report.WarningCount
 		);
 
+	if (!Context.bOutputDirRejected)
 	{
-		const FString Markdown = OmniForge::BuildReportMarkdown(Context.Report);
+		const FString Markdown = OmniForge::BuildReportMarkdown(
+			Context.Report,
+			Context.DisplayOutputDir,
+			OmniForge::ToDisplayPath(Context.CookedManifestOutputFile)
+		);
 		FString WriteError;
 		if (!OmniForge::SaveTextFile(Context.Report.OutputReportPath, Markdown, WriteError))
 		{
@@ -1504,9 +2088,11 @@ static void PhaseReport(FForgeContext& Context)
 		UE_LOG(
 			LogOmniForge,
 			Log,
-			TEXT("Forge PASS. Systems=%d Actions=%d Resolved=%s Report=%s"),
+			TEXT("Forge PASS. Systems=%d Actions=%d CacheHits=%d CacheMisses=%d Resolved=%s Report=%s"),
 			Context.Report.SystemCount,
 			Context.Report.ActionCount,
+			Context.Report.CacheHitCount,
+			Context.Report.CacheMissCount,
 			*Context.Report.OutputResolvedManifestPath,
 			*Context.Report.OutputReportPath
 		);
@@ -1552,9 +2138,30 @@ static void PhaseReport(FForgeContext& Context)
 	}
 }
 
+static void AddPhaseStat(FForgeContext& Context, const TCHAR* PhaseName, const double Seconds)
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	FOmniForgePhaseStat& Stat = Context.Report.PhaseStats.AddDefaulted_GetRef();
+	Stat.Phase = PhaseName;
+	Stat.Seconds = Seconds;
+	Stat.UsedPhysicalBytes = MemoryStats.UsedPhysical;
+	Stat.PeakUsedPhysicalBytes = MemoryStats.PeakUsedPhysical;
+}
+
+template <typename PhaseFunc>
+static auto RunTimedPhase(FForgeContext& Context, const TCHAR* PhaseName, PhaseFunc&& Phase)
+{
+	const double StartSeconds = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		AddPhaseStat(Context, PhaseName, FPlatformTime::Seconds() - StartSeconds);
+	};
+	return Phase();
+}
+
 static FOmniForgeReport FinalizePipeline(FForgeContext& Context, FOmniForgeResolved* OutResolved)
 {
-	PhaseReport(Context);
+	RunTimedPhase(Context, TEXT("Report"), [&Context]() { PhaseReport(Context); });
 
 	if (OutResolved)
 	{
@@ -1575,35 +2182,37 @@ static FOmniForgeReport AbortPipeline(FForgeContext& Context, FOmniForgeResolved
 {
 	if (bResolveForCounts)
 	{
-		Resolve(Context);
+		RunTimedPhase(Context, TEXT("Resolve"), [&Context]() { return Resolve(Context); });
 	}
 
-	PhaseGenerate(Context);
+	RunTimedPhase(Context, TEXT("Generate"), [&Context]() { return PhaseGenerate(Context); });
 	return FinalizePipeline(Context, OutResolved);
 }
 
 static FOmniForgeReport RunInternal(const FOmniForgeInput& Input, FOmniForgeResolved* OutResolved)
 {
+	FOmniForgeAssetCache Assets;
 	FForgeContext Context;
 	Context.Input = Input;
+	Context.Assets = &Assets;
 	Context.Report.ForgeVersion = OmniForge::ForgeVersion;
 
-	if (!PhaseNormalize(Context))
+	if (!RunTimedPhase(Context, TEXT("Normalize"), [&Context]() { return PhaseNormalize(Context); }))
 	{
 		return AbortPipeline(Context, OutResolved, true);
 	}
 
-	if (!Validate(Context))
+	if (!RunTimedPhase(Context, TEXT("Validate"), [&Context]() { return Validate(Context); }))
 	{
 		return AbortPipeline(Context, OutResolved, true);
 	}
 
-	if (!Resolve(Context))
+	if (!RunTimedPhase(Context, TEXT("Resolve"), [&Context]() { return Resolve(Context); }))
 	{
 		return AbortPipeline(Context, OutResolved, false);
 	}
 
-	if (!PhaseGenerate(Context))
+	if (!RunTimedPhase(Context, TEXT("Generate"), [&Context]() { return PhaseGenerate(Context); }))
 	{
 		return FinalizePipeline(Context, OutResolved);
 	}
@@ -1624,3 +2233,113 @@ FOmniForgeResult UOmniForgeRunner::Run(const FOmniForgeInput& Input)
 
 	return Result;
 }
+
+TArray<FOmniForgeResult> UOmniForgeRunner::RunBatch(const TArray<FOmniForgeInput>& Inputs)
+{
+	check(IsInGameThread());
+
+	struct FBatchItem
+	{
+		FForgeContext Context;
+		TArray<OmniForge::FPendingSystem> PendingSystems;
+		double ResolveSeconds = 0.0;
+	};
+
+	FOmniForgeAssetCache Assets;
+	TArray<TUniquePtr<FBatchItem>> Items;
+	Items.Reserve(Inputs.Num());
+	// ForgeCache.json, the resolved manifest and the cooked image are per directory, so each may have one writer.
+	TMap<FString, int32> ItemIndexByOutputDir;
+
+	// Manifest lookup and profile loads touch UObjects and stay on the game thread.
+	for (const FOmniForgeInput& Input : Inputs)
+	{
+		FBatchItem& Item = *Items.Add_GetRef(MakeUnique<FBatchItem>());
+		Item.Context.Input = Input;
+		Item.Context.Assets = &Assets;
+		Item.Context.Report.ForgeVersion = OmniForge::ForgeVersion;
+
+		const bool bNormalized = RunTimedPhase(Item.Context, TEXT("Normalize"), [&Item]() { return PhaseNormalize(Item.Context); });
+		FString OutputDirKey = FPaths::ConvertRelativePathToFull(Item.Context.OutputDir);
+		FPaths::NormalizeDirectoryName(OutputDirKey);
+		if (const int32* OwnerIndex = ItemIndexByOutputDir.Find(OutputDirKey))
+		{
+			Item.Context.bOutputDirRejected = true;
+			Item.Context.Report.AddError(
+				TEXT("OMNI_FORGE_E007_DUPLICATE_OUTPUT_DIR"),
+				FString::Printf(
+					TEXT("Output directory %s is already used by batch item %d."),
+					*Item.Context.DisplayOutputDir,
+					*OwnerIndex
+				),
+				TEXT("Batch"),
+				TEXT("Give every manifest in the batch its own OutputDirectory.")
+			);
+		}
+		else
+		{
+			ItemIndexByOutputDir.Add(OutputDirKey, Items.Num() - 1);
+			if (bNormalized)
+			{
+				RunTimedPhase(Item.Context, TEXT("Validate"), [&Item]() { return Validate(Item.Context); });
+			}
+		}
+
+		const double ResolveStartSeconds = FPlatformTime::Seconds();
+		BeginResolve(Item.Context, Item.PendingSystems);
+		Item.ResolveSeconds = FPlatformTime::Seconds() - ResolveStartSeconds;
+	}
+
+	TArray<OmniForge::FPendingSystem*> Work;
+	bool bParallel = false;
+	for (const TUniquePtr<FBatchItem>& Item : Items)
+	{
+		OmniForge::CollectValidationWork(Item->PendingSystems, Work);
+		bParallel |= Item->Context.EffectiveInput.bParallelResolve;
+	}
+	const double ValidationStartSeconds = FPlatformTime::Seconds();
+	OmniForge::ValidatePendingSystems(Work, bParallel);
+	const double SharedValidationSeconds = FPlatformTime::Seconds() - ValidationStartSeconds;
+
+	for (const TUniquePtr<FBatchItem>& Item : Items)
+	{
+		const double ResolveStartSeconds = FPlatformTime::Seconds();
+		EndResolve(Item->Context, Item->PendingSystems);
+		Item->PendingSystems.Empty();
+		// Every manifest waited on the whole shared validation pass, so each Resolve includes it.
+		AddPhaseStat(
+			Item->Context,
+			TEXT("Resolve"),
+			Item->ResolveSeconds + SharedValidationSeconds + (FPlatformTime::Seconds() - ResolveStartSeconds)
+		);
+	}
+
+	TArray<FOmniForgeResult> Results;
+	Results.SetNum(Items.Num());
+
+	ParallelFor(
+		Items.Num(),
+		[&Items, &Results](const int32 ItemIndex)
+		{
+			FForgeContext& Context = Items[ItemIndex]->Context;
+			FOmniForgeResult& Result = Results[ItemIndex];
+			RunTimedPhase(Context, TEXT("Generate"), [&Context]() { return PhaseGenerate(Context); });
+			Result.Report = FinalizePipeline(Context, &Result.Resolved);
+			Result.bSuccess = Result.Report.bPassed;
+			Result.bHasResolvedManifest = Result.Report.bPassed;
+		},
+		bParallel && Items.Num() > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread
+	);
+
+	UE_LOG(
+		LogOmniForge,
+		Log,
+		TEXT("Forge batch finished. Manifests=%d Validated=%d AssetLoads=%d AssetHits=%d"),
+		Items.Num(),
+		Work.Num(),
+		Assets.GetLoadCount(),
+		Assets.GetHitCount()
+	);
+
+	return Results;
+}
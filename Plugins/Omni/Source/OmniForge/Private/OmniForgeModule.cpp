@@ -64,6 +64,21 @@ namespace OmniForgeConsole
 					Input.bRequireContentAssets = ParseBoolValue(Value, Input.bRequireContentAssets);
 					continue;
 				}
+				if (Key.Equals(TEXT("cache"), ESearchCase::IgnoreCase))
+				{
+					Input.bUseCache = ParseBoolValue(Value, Input.bUseCache);
+					continue;
+				}
+				if (Key.Equals(TEXT("parallel"), ESearchCase::IgnoreCase))
+				{
+					Input.bParallelResolve = ParseBoolValue(Value, Input.bParallelResolve);
+					continue;
+				}
+				if (Key.Equals(TEXT("code"), ESearchCase::IgnoreCase))
+				{
+					Input.CodeOutputDirectory = Value;
+					continue;
+				}
 			}
 			else if (Index == 0)
 			{
@@ -77,18 +92,19 @@ namespace OmniForgeConsole
 		UE_LOG(
 			LogTemp,
 			Log,
-			TEXT("[OmniForge] %s | Errors=%d Warnings=%d | Report=%s | Resolved=%s"),
+			TEXT("[OmniForge] %s | Errors=%d Warnings=%d | Report=%s | Resolved=%s | Cooked=%s"),
 			Report.bPassed ? TEXT("PASS") : TEXT("FAIL"),
 			Report.ErrorCount,
 			Report.WarningCount,
 			*Report.OutputReportPath,
-			*Report.OutputResolvedManifestPath
+			*Report.OutputResolvedManifestPath,
+			*Report.OutputCookedManifestPath
 		);
 	}
 
 	static FAutoConsoleCommandWithWorldAndArgs OmniForgeRunCommand(
 		TEXT("omni.forge.run"),
-		TEXT("Run OmniForge pipeline. Optional args: root=/Game/Data manifestAsset=/Game/... manifestClass=/Script/... requireContentAssets=0|1"),
+		TEXT("Run OmniForge pipeline. Optional args: root=/Game/Data manifestAsset=/Game/... manifestClass=/Script/... requireContentAssets=0|1 cache=0|1 parallel=0|1 code=<dir>"),
 		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleForgeRunCommand)
 	);
 }
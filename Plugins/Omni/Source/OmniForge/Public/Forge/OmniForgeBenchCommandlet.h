@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OmniForgeBenchCommandlet.generated.h"
+
+// Headless Forge/registry scale benchmark over synthetic content. Usage:
+//   -run=OmniForgeBench [-Systems=100] [-Actions=1000] [-Tags=64] [-CancelFanOut=2] [-DependencyDepth=8]
+//                       [-ProfileLayers=0] [-Iterations=3] [-Cache=0|1] [-Parallel=0|1] [-Registry=0|1] [-TrustCooked=0|1]
+//                       [-Output=<file.json>]
+// Writes per-phase wall time and process memory as JSON (default Saved/Omni/Bench/ForgeBench_<timestamp>.json).
+// RegistryInitialize maps the omnibin written by the same iteration; registryCookedManifest says whether it was trusted.
+// Returns 0 when every iteration passed.
+UCLASS()
+class OMNIFORGE_API UOmniForgeBenchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOmniForgeBenchCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OmniForgeCommandlet.generated.h"
+
+// Headless batch Forge. Usage:
+//   -run=OmniForge [-Manifests=<object path|/Script/class path|wildcard>;...] [-Output=<dir>] [-Root=/Game/Data]
+//                  [-RequireContentAssets=0|1] [-Cache=0|1] [-Parallel=0|1] [-Code=<dir>]
+// Each manifest writes its outputs to <Output>/<ManifestName>/ (compiled action headers to <Code>/<ManifestName>/)
+// and ForgeBatchReport.md summarizes the batch.
+// Returns the number of manifests that failed.
+UCLASS()
+class OMNIFORGE_API UOmniForgeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOmniForgeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -12,4 +12,9 @@ class OMNIFORGE_API UOmniForgeRunner : public UObject
 
 public:
 	static FOmniForgeResult Run(const FOmniForgeInput& Input);
+
+	// Runs several manifests in one pass: loads happen once on the game thread, validation and output
+	// generation of all manifests run concurrently. Results are in input order. Each manifest needs its own
+	// OutputDirectory: an item repeating an earlier item's directory fails with E007 and writes nothing.
+	static TArray<FOmniForgeResult> RunBatch(const TArray<FOmniForgeInput>& Inputs);
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Systems/ActionGate/OmniActionGraph.h"
 #include "UObject/SoftObjectPath.h"
 
 struct FOmniForgeInput
@@ -9,6 +10,14 @@ struct FOmniForgeInput
 	FSoftObjectPath ManifestAssetPath;
 	FSoftClassPath ManifestClassPath;
 	bool bRequireContentAssets = true;
+	// Outputs, report and ForgeCache.json go here; empty means Saved/Omni.
+	FString OutputDirectory;
+	// When set, Generate also writes the action tables as C++ (OmniCompiledActions_*.h) into this directory.
+	FString CodeOutputDirectory;
+	// Reuse per-system validation fragments from ForgeCache.json when their inputs are unchanged.
+	bool bUseCache = true;
+	// Validate systems on worker threads; assets are still loaded on the game thread beforehand.
+	bool bParallelResolve = true;
 };
 
 enum class EOmniForgeErrorSeverity : uint8
@@ -89,6 +98,18 @@ struct FOmniForgeResolved
 	TArray<FName> InitializationOrder;
 	TArray<FOmniForgeResolvedProfile> Profiles;
 	TArray<FOmniForgeResolvedAction> ActionDefinitions;
+	// Indexed like ActionDefinitions.
+	FOmniActionGraph ActionGraph;
+};
+
+// Wall time and process memory sampled after one pipeline phase. Not part of the written report, which must
+// stay deterministic; benchmarks read it from the returned report.
+struct FOmniForgePhaseStat
+{
+	FName Phase = NAME_None;
+	double Seconds = 0.0;
+	uint64 UsedPhysicalBytes = 0;
+	uint64 PeakUsedPhysicalBytes = 0;
 };
 
 struct FOmniForgeReport
@@ -99,12 +120,18 @@ struct FOmniForgeReport
 	FString Summary;
 	FString ManifestSource;
 	FString OutputResolvedManifestPath;
+	FString OutputCookedManifestPath;
 	FString OutputReportPath;
+	// Empty unless CodeOutputDirectory was set.
+	FString OutputCompiledActionsPath;
 	int32 ErrorCount = 0;
 	int32 WarningCount = 0;
 	int32 SystemCount = 0;
 	int32 ActionCount = 0;
+	int32 CacheHitCount = 0;
+	int32 CacheMissCount = 0;
 	TArray<FOmniForgeError> Errors;
+	TArray<FOmniForgePhaseStat> PhaseStats;
 
 	void AddIssue(
 		const EOmniForgeErrorSeverity Severity,
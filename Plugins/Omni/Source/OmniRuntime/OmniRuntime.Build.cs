@@ -22,6 +22,7 @@ public class OmniRuntime : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new[]
 			{
+				"Json",
 				"Slate",
 				"SlateCore"
 			}
@@ -0,0 +1,585 @@
+#include "Debug/OmniDebugMetrics.h"
+
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace OmniDebugMetrics
+{
+	static const double LatencyBucketsMs[] = { 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 25.0, 50.0, 100.0 };
+
+	static constexpr int32 MaxShardSlots = 256;
+	static constexpr int32 ShardPageSize = 32;
+	static constexpr int32 NumShardPages = MaxShardSlots / ShardPageSize;
+	static constexpr int32 MaxShardBuckets = 16;
+
+	static std::atomic<uint32> NextRegistryId{1};
+
+	struct FShardSlot
+	{
+		std::atomic<int64> IntDelta{0};
+		std::atomic<int64> GaugeInt{0};
+		std::atomic<double> GaugeFloat{0.0};
+		// Bit 0: GaugeInt pending, bit 1: GaugeFloat pending.
+		std::atomic<uint8> GaugePending{0};
+		// Histogram totals are cumulative and only change inside an odd ObserveSeq, so the merge reads count, sum and
+		// buckets as one snapshot and folds the difference to the Merged* baseline (game thread, under ShardLock).
+		std::atomic<uint32> ObserveSeq{0};
+		std::atomic<int64> ObserveCount{0};
+		std::atomic<double> ObserveSum{0.0};
+		std::atomic<double> ObserveMin{TNumericLimits<double>::Max()};
+		std::atomic<double> ObserveMax{TNumericLimits<double>::Lowest()};
+		std::atomic<uint32> BucketCounts[MaxShardBuckets] = {};
+		int64 MergedCount = 0;
+		double MergedSum = 0.0;
+		uint32 MergedBucketCounts[MaxShardBuckets] = {};
+	};
+
+	struct FShardPage
+	{
+		FShardSlot Slots[ShardPageSize];
+	};
+
+	// Written only by its owning thread; the game thread drains it under ShardLock. When the owner exits the shard is
+	// released, keeping its pending values, and handed to the next thread that updates the same registry.
+	struct FThreadShard
+	{
+		std::atomic<bool> bOwned{true};
+		std::atomic<bool> bRetired{false};
+		std::atomic<FShardPage*> Pages[NumShardPages] = {};
+
+		~FThreadShard()
+		{
+			for (std::atomic<FShardPage*>& Page : Pages)
+			{
+				delete Page.load(std::memory_order_relaxed);
+			}
+		}
+	};
+
+	using FThreadShardPtr = TSharedPtr<FThreadShard, ESPMode::ThreadSafe>;
+
+	struct FCachedShard
+	{
+		uint32 RegistryId = 0;
+		FThreadShard* Shard = nullptr;
+	};
+
+	struct FShardLease
+	{
+		uint32 RegistryId = 0;
+		FThreadShardPtr Shard;
+	};
+
+	struct FThreadShardLeases
+	{
+		TArray<FShardLease, TInlineAllocator<2>> Leases;
+
+		~FThreadShardLeases()
+		{
+			for (const FShardLease& Lease : Leases)
+			{
+				Lease.Shard->bOwned.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	static thread_local FCachedShard CachedShard;
+	static thread_local FThreadShardLeases ThreadLeases;
+
+	static void AtomicMin(std::atomic<double>& Target, const double Value)
+	{
+		double Expected = Target.load(std::memory_order_relaxed);
+		while (Value < Expected && !Target.compare_exchange_weak(Expected, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static void AtomicMax(std::atomic<double>& Target, const double Value)
+	{
+		double Expected = Target.load(std::memory_order_relaxed);
+		while (Value > Expected && !Target.compare_exchange_weak(Expected, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static void ReadObserveTotals(const FShardSlot& Pending, int64& OutCount, double& OutSum, uint32 (&OutBuckets)[MaxShardBuckets])
+	{
+		for (;;)
+		{
+			const uint32 SeqBefore = Pending.ObserveSeq.load(std::memory_order_acquire);
+			if (SeqBefore & 1)
+			{
+				FPlatformProcess::SleepNoStats(0.0f);
+				continue;
+			}
+
+			OutCount = Pending.ObserveCount.load(std::memory_order_relaxed);
+			OutSum = Pending.ObserveSum.load(std::memory_order_relaxed);
+			for (int32 BucketIndex = 0; BucketIndex < MaxShardBuckets; ++BucketIndex)
+			{
+				OutBuckets[BucketIndex] = Pending.BucketCounts[BucketIndex].load(std::memory_order_relaxed);
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Pending.ObserveSeq.load(std::memory_order_relaxed) == SeqBefore)
+			{
+				return;
+			}
+		}
+	}
+}
+
+struct FOmniMetricRegistry::FConcurrentState
+{
+	uint32 RegistryId = 0;
+	// Guards shard creation and merging only; steady-state worker updates never take it.
+	FCriticalSection ShardLock;
+	TArray<OmniDebugMetrics::FThreadShardPtr> Shards;
+	// Histogram bounds published per slot so workers can bucket without touching Slots.
+	std::atomic<const TArray<double>*> BucketBounds[OmniDebugMetrics::MaxShardSlots] = {};
+	TArray<TUniquePtr<TArray<double>>> RetainedBucketBounds;
+
+	OmniDebugMetrics::FShardSlot* FindShardSlot(const int32 Index)
+	{
+		using namespace OmniDebugMetrics;
+
+		if (Index < 0 || Index >= MaxShardSlots)
+		{
+			return nullptr;
+		}
+
+		if (CachedShard.RegistryId != RegistryId)
+		{
+			CachedShard.Shard = AcquireThreadShard();
+			CachedShard.RegistryId = RegistryId;
+		}
+
+		std::atomic<FShardPage*>& PageSlot = CachedShard.Shard->Pages[Index / ShardPageSize];
+		FShardPage* Page = PageSlot.load(std::memory_order_acquire);
+		if (!Page)
+		{
+			Page = new FShardPage();
+			PageSlot.store(Page, std::memory_order_release);
+		}
+		return &Page->Slots[Index % ShardPageSize];
+	}
+
+	OmniDebugMetrics::FThreadShard* AcquireThreadShard()
+	{
+		using namespace OmniDebugMetrics;
+
+		ThreadLeases.Leases.RemoveAllSwap(
+			[](const FShardLease& Lease)
+			{
+				return Lease.Shard->bRetired.load(std::memory_order_acquire);
+			}
+		);
+		for (const FShardLease& Lease : ThreadLeases.Leases)
+		{
+			if (Lease.RegistryId == RegistryId)
+			{
+				return Lease.Shard.Get();
+			}
+		}
+
+		FScopeLock Lock(&ShardLock);
+		FThreadShardPtr Shard;
+		for (const FThreadShardPtr& Candidate : Shards)
+		{
+			bool bExpectedOwned = false;
+			if (Candidate->bOwned.compare_exchange_strong(bExpectedOwned, true, std::memory_order_acquire))
+			{
+				Shard = Candidate;
+				break;
+			}
+		}
+		if (!Shard)
+		{
+			Shard = Shards.Add_GetRef(MakeShared<FThreadShard, ESPMode::ThreadSafe>());
+		}
+
+		ThreadLeases.Leases.Add(FShardLease{ RegistryId, Shard });
+		return Shard.Get();
+	}
+
+	~FConcurrentState()
+	{
+		// Shards still leased by live threads outlive the registry; retiring them lets those threads drop the lease.
+		for (const OmniDebugMetrics::FThreadShardPtr& Shard : Shards)
+		{
+			Shard->bRetired.store(true, std::memory_order_release);
+		}
+	}
+};
+
+FOmniMetricRegistry::FOmniMetricRegistry()
+	: Concurrent(MakeUnique<FConcurrentState>())
+{
+	Concurrent->RegistryId = OmniDebugMetrics::NextRegistryId.fetch_add(1, std::memory_order_relaxed);
+}
+
+FOmniMetricRegistry::~FOmniMetricRegistry() = default;
+
+FOmniMetricHandle FOmniMetricRegistry::RegisterCounter(const FName Key)
+{
+	return RegisterSlot(Key, EOmniMetricKind::Counter, EOmniMetricValueType::Int, nullptr);
+}
+
+FOmniMetricHandle FOmniMetricRegistry::RegisterGauge(const FName Key, const EOmniMetricValueType ValueType, const TCHAR* Unit)
+{
+	return RegisterSlot(Key, EOmniMetricKind::Gauge, ValueType, Unit);
+}
+
+FOmniMetricHandle FOmniMetricRegistry::RegisterHistogram(
+	const FName Key,
+	const TArrayView<const double> BucketUpperBounds,
+	const TCHAR* Unit
+)
+{
+	const FOmniMetricHandle Handle = RegisterSlot(Key, EOmniMetricKind::Histogram, EOmniMetricValueType::Float, Unit);
+	if (!Handle.IsValid())
+	{
+		return Handle;
+	}
+
+	FSlot& Slot = Slots[Handle.Index];
+	Slot.BucketUpperBounds = TArray<double>(BucketUpperBounds);
+	Slot.BucketUpperBounds.Sort();
+	Slot.BucketCounts.Init(0, Slot.BucketUpperBounds.Num() + 1);
+
+	if (Handle.Index < OmniDebugMetrics::MaxShardSlots)
+	{
+		const TArray<double>* PublishedBounds = Concurrent->RetainedBucketBounds.Add_GetRef(MakeUnique<TArray<double>>(Slot.BucketUpperBounds)).Get();
+		Concurrent->BucketBounds[Handle.Index].store(PublishedBounds, std::memory_order_release);
+	}
+	return Handle;
+}
+
+FOmniMetricHandle FOmniMetricRegistry::RegisterLatencyHistogram(const FName Key)
+{
+	return RegisterHistogram(Key, OmniDebugMetrics::LatencyBucketsMs, TEXT("ms"));
+}
+
+void FOmniMetricRegistry::Unregister(FOmniMetricHandle& Handle)
+{
+	if (Slots.IsValidIndex(Handle.Index))
+	{
+		Slots[Handle.Index].bActive = false;
+		++Revision;
+	}
+	Handle.Invalidate();
+}
+
+void FOmniMetricRegistry::Reset()
+{
+	for (FSlot& Slot : Slots)
+	{
+		Slot.bActive = false;
+	}
+	++Revision;
+}
+
+void FOmniMetricRegistry::Observe(const FOmniMetricHandle Handle, const double Value)
+{
+	if (!IsInGameThread())
+	{
+		ObserveConcurrent(Handle, Value);
+		return;
+	}
+
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return;
+	}
+
+	FSlot& Slot = Slots[Handle.Index];
+	++Revision;
+	if (Slot.Kind != EOmniMetricKind::Histogram)
+	{
+		Slot.FloatValue = Value;
+		return;
+	}
+
+	int32 BucketIndex = 0;
+	while (BucketIndex < Slot.BucketUpperBounds.Num() && Value > Slot.BucketUpperBounds[BucketIndex])
+	{
+		++BucketIndex;
+	}
+	++Slot.BucketCounts[BucketIndex];
+
+	Slot.Min = Slot.IntValue == 0 ? Value : FMath::Min(Slot.Min, Value);
+	Slot.Max = Slot.IntValue == 0 ? Value : FMath::Max(Slot.Max, Value);
+	Slot.Sum += Value;
+	++Slot.IntValue;
+}
+
+int32 FOmniMetricRegistry::Num() const
+{
+	int32 Count = 0;
+	for (const FSlot& Slot : Slots)
+	{
+		Count += Slot.bActive ? 1 : 0;
+	}
+	return Count;
+}
+
+FName FOmniMetricRegistry::GetKey(const FOmniMetricHandle Handle) const
+{
+	return Slots.IsValidIndex(Handle.Index) ? Slots[Handle.Index].Key : NAME_None;
+}
+
+FString FOmniMetricRegistry::FormatValue(const FOmniMetricHandle Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return FString();
+	}
+
+	const FSlot& Slot = Slots[Handle.Index];
+	switch (Slot.Kind)
+	{
+	case EOmniMetricKind::Counter:
+		return LexToString(Slot.IntValue);
+	case EOmniMetricKind::Histogram:
+		if (Slot.IntValue == 0)
+		{
+			return TEXT("n=0");
+		}
+		return FString::Printf(
+			TEXT("n=%lld avg=%.3f%s p50<=%.3f p95<=%.3f max=%.3f%s"),
+			Slot.IntValue,
+			Slot.Sum / static_cast<double>(Slot.IntValue),
+			*Slot.Unit,
+			EstimatePercentile(Slot, 0.5),
+			EstimatePercentile(Slot, 0.95),
+			Slot.Max,
+			*Slot.Unit
+		);
+	case EOmniMetricKind::Gauge:
+	default:
+		break;
+	}
+
+	switch (Slot.ValueType)
+	{
+	case EOmniMetricValueType::Bool:
+		return Slot.IntValue != 0 ? TEXT("True") : TEXT("False");
+	case EOmniMetricValueType::Float:
+		return FString::Printf(TEXT("%.1f%s"), Slot.FloatValue, *Slot.Unit);
+	case EOmniMetricValueType::Int:
+	default:
+		return FString::Printf(TEXT("%lld%s"), Slot.IntValue, *Slot.Unit);
+	}
+}
+
+void FOmniMetricRegistry::ForEachMetric(const TFunctionRef<void(FOmniMetricHandle Handle, FName Key)> Visitor) const
+{
+	MergeThreadShards();
+	for (int32 Index = 0; Index < Slots.Num(); ++Index)
+	{
+		if (Slots[Index].bActive)
+		{
+			FOmniMetricHandle Handle;
+			Handle.Index = Index;
+			Visitor(Handle, Slots[Index].Key);
+		}
+	}
+}
+
+FOmniMetricHandle FOmniMetricRegistry::RegisterSlot(
+	const FName Key,
+	const EOmniMetricKind Kind,
+	const EOmniMetricValueType ValueType,
+	const TCHAR* Unit
+)
+{
+	check(IsInGameThread());
+
+	FOmniMetricHandle Handle;
+	if (Key == NAME_None)
+	{
+		return Handle;
+	}
+
+	// Fold pending worker updates so they are not attributed to the re-registered slot.
+	MergeThreadShards();
+
+	if (const int32* ExistingIndex = IndexByKey.Find(Key))
+	{
+		Handle.Index = *ExistingIndex;
+	}
+	else
+	{
+		Handle.Index = Slots.AddDefaulted();
+		IndexByKey.Add(Key, Handle.Index);
+	}
+
+	FSlot& Slot = Slots[Handle.Index];
+	Slot = FSlot();
+	Slot.Key = Key;
+	Slot.Kind = Kind;
+	Slot.ValueType = ValueType;
+	Slot.Unit = Unit ? Unit : TEXT("");
+	Slot.bActive = true;
+	++Revision;
+
+	if (Handle.Index < OmniDebugMetrics::MaxShardSlots)
+	{
+		Concurrent->BucketBounds[Handle.Index].store(nullptr, std::memory_order_release);
+	}
+	return Handle;
+}
+
+double FOmniMetricRegistry::EstimatePercentile(const FSlot& Slot, const double Percentile)
+{
+	const uint64 TargetRank = static_cast<uint64>(FMath::CeilToDouble(Percentile * static_cast<double>(Slot.IntValue)));
+	uint64 Cumulative = 0;
+	for (int32 BucketIndex = 0; BucketIndex < Slot.BucketCounts.Num(); ++BucketIndex)
+	{
+		Cumulative += Slot.BucketCounts[BucketIndex];
+		if (Cumulative >= TargetRank)
+		{
+			return Slot.BucketUpperBounds.IsValidIndex(BucketIndex) ? Slot.BucketUpperBounds[BucketIndex] : Slot.Max;
+		}
+	}
+	return Slot.Max;
+}
+
+void FOmniMetricRegistry::MergeThreadShards() const
+{
+	using namespace OmniDebugMetrics;
+
+	FScopeLock Lock(&Concurrent->ShardLock);
+	const int32 NumMergeable = FMath::Min(Slots.Num(), MaxShardSlots);
+	for (const FThreadShardPtr& Shard : Concurrent->Shards)
+	{
+		for (int32 PageIndex = 0; PageIndex < NumShardPages; ++PageIndex)
+		{
+			FShardPage* Page = Shard->Pages[PageIndex].load(std::memory_order_acquire);
+			if (!Page)
+			{
+				continue;
+			}
+
+			const int32 FirstIndex = PageIndex * ShardPageSize;
+			for (int32 Offset = 0; Offset < ShardPageSize && FirstIndex + Offset < NumMergeable; ++Offset)
+			{
+				FShardSlot& Pending = Page->Slots[Offset];
+				FSlot& Slot = Slots[FirstIndex + Offset];
+
+				const int64 IntDelta = Pending.IntDelta.exchange(0, std::memory_order_relaxed);
+				if (IntDelta != 0)
+				{
+					Slot.IntValue += IntDelta;
+					++Revision;
+				}
+
+				const uint8 GaugePending = Pending.GaugePending.exchange(0, std::memory_order_acquire);
+				if (GaugePending & 1)
+				{
+					Slot.IntValue = Pending.GaugeInt.load(std::memory_order_relaxed);
+				}
+				if (GaugePending & 2)
+				{
+					Slot.FloatValue = Pending.GaugeFloat.load(std::memory_order_relaxed);
+				}
+				Revision += GaugePending != 0 ? 1 : 0;
+
+				int64 ObserveCount = 0;
+				double ObserveSum = 0.0;
+				uint32 BucketTotals[MaxShardBuckets];
+				ReadObserveTotals(Pending, ObserveCount, ObserveSum, BucketTotals);
+				if (ObserveCount == Pending.MergedCount)
+				{
+					continue;
+				}
+
+				const double ObservedMin = Pending.ObserveMin.exchange(TNumericLimits<double>::Max(), std::memory_order_relaxed);
+				const double ObservedMax = Pending.ObserveMax.exchange(TNumericLimits<double>::Lowest(), std::memory_order_relaxed);
+				Slot.Min = Slot.IntValue == 0 ? ObservedMin : FMath::Min(Slot.Min, ObservedMin);
+				Slot.Max = Slot.IntValue == 0 ? ObservedMax : FMath::Max(Slot.Max, ObservedMax);
+				Slot.Sum += ObserveSum - Pending.MergedSum;
+				Slot.IntValue += ObserveCount - Pending.MergedCount;
+				Pending.MergedCount = ObserveCount;
+				++Revision;
+				Pending.MergedSum = ObserveSum;
+
+				const int32 NumBuckets = FMath::Min(Slot.BucketCounts.Num(), MaxShardBuckets);
+				for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+				{
+					Slot.BucketCounts[BucketIndex] += BucketTotals[BucketIndex] - Pending.MergedBucketCounts[BucketIndex];
+					Pending.MergedBucketCounts[BucketIndex] = BucketTotals[BucketIndex];
+				}
+			}
+		}
+	}
+}
+
+uint32 FOmniMetricRegistry::GetRevision() const
+{
+	MergeThreadShards();
+	return Revision;
+}
+
+void FOmniMetricRegistry::IncrementConcurrent(const FOmniMetricHandle Handle, const int64 Delta)
+{
+	if (OmniDebugMetrics::FShardSlot* Pending = Concurrent->FindShardSlot(Handle.Index))
+	{
+		Pending->IntDelta.fetch_add(Delta, std::memory_order_relaxed);
+	}
+}
+
+void FOmniMetricRegistry::SetIntConcurrent(const FOmniMetricHandle Handle, const int64 Value)
+{
+	if (OmniDebugMetrics::FShardSlot* Pending = Concurrent->FindShardSlot(Handle.Index))
+	{
+		Pending->GaugeInt.store(Value, std::memory_order_relaxed);
+		Pending->GaugePending.fetch_or(1, std::memory_order_release);
+	}
+}
+
+void FOmniMetricRegistry::SetFloatConcurrent(const FOmniMetricHandle Handle, const double Value)
+{
+	if (OmniDebugMetrics::FShardSlot* Pending = Concurrent->FindShardSlot(Handle.Index))
+	{
+		Pending->GaugeFloat.store(Value, std::memory_order_relaxed);
+		Pending->GaugePending.fetch_or(2, std::memory_order_release);
+	}
+}
+
+void FOmniMetricRegistry::ObserveConcurrent(const FOmniMetricHandle Handle, const double Value)
+{
+	using namespace OmniDebugMetrics;
+
+	FShardSlot* Pending = Concurrent->FindShardSlot(Handle.Index);
+	if (!Pending)
+	{
+		return;
+	}
+
+	const TArray<double>* BucketUpperBounds = Concurrent->BucketBounds[Handle.Index].load(std::memory_order_acquire);
+	if (!BucketUpperBounds)
+	{
+		SetFloatConcurrent(Handle, Value);
+		return;
+	}
+
+	int32 BucketIndex = 0;
+	while (BucketIndex < BucketUpperBounds->Num() && Value > (*BucketUpperBounds)[BucketIndex])
+	{
+		++BucketIndex;
+	}
+	std::atomic<uint32>& BucketCount = Pending->BucketCounts[FMath::Min(BucketIndex, MaxShardBuckets - 1)];
+
+	// Single writer: plain load/store pairs are enough inside the sequence bracket.
+	const uint32 Seq = Pending->ObserveSeq.load(std::memory_order_relaxed);
+	Pending->ObserveSeq.store(Seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	BucketCount.store(BucketCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	AtomicMin(Pending->ObserveMin, Value);
+	AtomicMax(Pending->ObserveMax, Value);
+	Pending->ObserveSum.store(Pending->ObserveSum.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+	Pending->ObserveCount.store(Pending->ObserveCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	Pending->ObserveSeq.store(Seq + 2, std::memory_order_release);
+}
@@ -0,0 +1,196 @@
+#include "Debug/OmniDebugRecord.h"
+
+#include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace OmniDebugRecord
+{
+	// Writers intern under Mutex; readers only load Slots, which are published once and never change.
+	struct FFormatTable
+	{
+		static constexpr int32 MaxPatterns = 4096;
+
+		FCriticalSection Mutex;
+		TIndirectArray<FString> Patterns;
+		TMap<FString, uint16> IdsByPattern;
+		std::atomic<const TCHAR*> Slots[MaxPatterns] = {};
+
+		FFormatTable()
+		{
+			// Id 0 is reserved for unstructured entries that carry their own text.
+			Publish(TEXT("{0}"));
+		}
+
+		uint16 Publish(const FString& Pattern)
+		{
+			const uint16 NewId = static_cast<uint16>(Patterns.Add(new FString(Pattern)));
+			Slots[NewId].store(*Patterns[NewId], std::memory_order_release);
+			return NewId;
+		}
+	};
+
+	static FFormatTable& GetFormatTable()
+	{
+		static FFormatTable Table;
+		return Table;
+	}
+
+	static uint64 PackName(const FName Value)
+	{
+		return (static_cast<uint64>(Value.GetDisplayIndex().ToUnstableInt()) << 32) | static_cast<uint32>(Value.GetNumber());
+	}
+
+	static FName UnpackName(const uint64 Payload)
+	{
+		return FName::CreateFromDisplayId(
+			FNameEntryId::FromUnstableInt(static_cast<uint32>(Payload >> 32)),
+			static_cast<int32>(static_cast<uint32>(Payload))
+		);
+	}
+
+	static FString ArgToString(const EOmniDebugArgType Type, const uint64 Payload)
+	{
+		switch (Type)
+		{
+		case EOmniDebugArgType::Int:
+			return LexToString(static_cast<int64>(Payload));
+		case EOmniDebugArgType::Float:
+		{
+			double Value = 0.0;
+			FMemory::Memcpy(&Value, &Payload, sizeof(Value));
+			return FString::SanitizeFloat(Value);
+		}
+		case EOmniDebugArgType::Bool:
+			return Payload != 0 ? TEXT("True") : TEXT("False");
+		case EOmniDebugArgType::Name:
+			return UnpackName(Payload).ToString();
+		case EOmniDebugArgType::None:
+		default:
+			return FString();
+		}
+	}
+}
+
+FOmniDebugArg::FOmniDebugArg(const int32 Value)
+	: Payload(static_cast<uint64>(static_cast<int64>(Value)))
+	, Type(EOmniDebugArgType::Int)
+{
+}
+
+FOmniDebugArg::FOmniDebugArg(const int64 Value)
+	: Payload(static_cast<uint64>(Value))
+	, Type(EOmniDebugArgType::Int)
+{
+}
+
+FOmniDebugArg::FOmniDebugArg(const float Value)
+	: FOmniDebugArg(static_cast<double>(Value))
+{
+}
+
+FOmniDebugArg::FOmniDebugArg(const double Value)
+	: Type(EOmniDebugArgType::Float)
+{
+	FMemory::Memcpy(&Payload, &Value, sizeof(Value));
+}
+
+FOmniDebugArg::FOmniDebugArg(const bool Value)
+	: Payload(Value ? 1 : 0)
+	, Type(EOmniDebugArgType::Bool)
+{
+}
+
+FOmniDebugArg::FOmniDebugArg(const FName Value)
+	: Payload(OmniDebugRecord::PackName(Value))
+	, Type(EOmniDebugArgType::Name)
+{
+}
+
+FOmniDebugFormat::FOmniDebugFormat(const TCHAR* Pattern)
+	: Id(Intern(Pattern))
+{
+}
+
+FOmniDebugFormat::FOmniDebugFormat(const FString& Pattern)
+	: Id(Intern(Pattern))
+{
+}
+
+uint16 FOmniDebugFormat::Intern(const FString& Pattern)
+{
+	OmniDebugRecord::FFormatTable& Table = OmniDebugRecord::GetFormatTable();
+	FScopeLock Lock(&Table.Mutex);
+
+	if (const uint16* ExistingId = Table.IdsByPattern.Find(Pattern))
+	{
+		return *ExistingId;
+	}
+
+	if (!ensureMsgf(Table.Patterns.Num() < OmniDebugRecord::FFormatTable::MaxPatterns, TEXT("Omni debug format table is full; pattern '%s' falls back to raw text."), *Pattern))
+	{
+		return 0;
+	}
+
+	const uint16 NewId = Table.Publish(Pattern);
+	Table.IdsByPattern.Add(Pattern, NewId);
+	return NewId;
+}
+
+const TCHAR* FOmniDebugFormat::GetPattern(const uint16 FormatId)
+{
+	const TCHAR* Pattern = FormatId < OmniDebugRecord::FFormatTable::MaxPatterns
+		? OmniDebugRecord::GetFormatTable().Slots[FormatId].load(std::memory_order_acquire)
+		: nullptr;
+	return Pattern ? Pattern : TEXT("");
+}
+
+void FOmniDebugRecord::SetArgs(const std::initializer_list<FOmniDebugArg> Args)
+{
+	ArgCount = 0;
+	for (const FOmniDebugArg& Arg : Args)
+	{
+		if (!ensureMsgf(ArgCount < MaxArgs, TEXT("Omni debug record supports at most %d arguments."), MaxArgs))
+		{
+			break;
+		}
+
+		ArgPayloads[ArgCount] = Arg.Payload;
+		ArgTypes[ArgCount] = Arg.Type;
+		++ArgCount;
+	}
+}
+
+FString FOmniDebugRecord::RenderMessage(const FStringView Text) const
+{
+	if (FormatId == 0)
+	{
+		return FString(Text);
+	}
+
+	FStringFormatOrderedArguments OrderedArgs;
+	OrderedArgs.Reserve(ArgCount);
+	for (int32 ArgIndex = 0; ArgIndex < ArgCount; ++ArgIndex)
+	{
+		OrderedArgs.Add(OmniDebugRecord::ArgToString(ArgTypes[ArgIndex], ArgPayloads[ArgIndex]));
+	}
+
+	return FString::Format(FOmniDebugFormat::GetPattern(FormatId), OrderedArgs);
+}
+
+FString FOmniDebugRecord::RenderTimestampUtc() const
+{
+	return FDateTime(TimestampTicks).ToString(TEXT("%Y-%m-%d %H:%M:%S"));
+}
+
+FOmniDebugEntry FOmniDebugRecord::ToEntry(const FStringView Text) const
+{
+	FOmniDebugEntry Entry;
+	Entry.TimestampUtc = RenderTimestampUtc();
+	Entry.WorldTimeSeconds = WorldTimeSeconds;
+	Entry.Level = Level;
+	Entry.Category = Category;
+	Entry.Source = Source;
+	Entry.Message = RenderMessage(Text);
+	return Entry;
+}
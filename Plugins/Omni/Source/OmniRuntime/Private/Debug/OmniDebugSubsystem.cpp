@@ -11,12 +11,20 @@
 namespace OmniDebug
 {
 	static const FName CategoryName(TEXT("Debug"));
+	static constexpr int32 MinEntries = 10;
+	static constexpr int32 MaxEntriesLimit = 100000;
+	// Cap on records and metric updates waiting for the game thread; beyond it producers drop and count.
+	static constexpr int32 MaxStaged = 4096;
 }
 
 void UOmniDebugSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	MaxEntries = FMath::Clamp(MaxEntries, OmniDebug::MinEntries, OmniDebug::MaxEntriesLimit);
+	Entries.SetCapacity(MaxEntries);
+	EntryTexts.SetCapacity(MaxEntries);
+	RefreshEnabledLevelMask();
 	SyncDebugModeFromConsole();
 	AddEntry(EOmniDebugLevel::Event, OmniDebug::CategoryName, TEXT("OmniDebugSubsystem inicializado"), TEXT("OmniRuntime"));
 }
@@ -36,6 +44,7 @@ void UOmniDebugSubsystem::SetDebugMode(const EOmniDebugMode NewMode)
 	}
 
 	DebugMode = NewMode;
+	RefreshEnabledLevelMask();
 	++Revision;
 }
 
@@ -43,6 +52,7 @@ void UOmniDebugSubsystem::Tick(float DeltaTime)
 {
 	(void)DeltaTime;
 	SyncDebugModeFromConsole();
+	DrainStaged();
 
 	APlayerController* LocalPlayerController = ResolveLocalPlayerController(nullptr);
 	if (!LocalPlayerController || !LocalPlayerController->IsLocalController())
@@ -89,8 +99,9 @@ EOmniDebugMode UOmniDebugSubsystem::GetDebugMode() const
 
 void UOmniDebugSubsystem::SetMaxEntries(const int32 NewMaxEntries)
 {
-	MaxEntries = FMath::Max(10, NewMaxEntries);
-	TrimToMaxEntries();
+	MaxEntries = FMath::Clamp(NewMaxEntries, OmniDebug::MinEntries, OmniDebug::MaxEntriesLimit);
+	Entries.SetCapacity(MaxEntries);
+	EntryTexts.SetCapacity(MaxEntries);
 	++Revision;
 }
 
@@ -102,6 +113,7 @@ int32 UOmniDebugSubsystem::GetMaxEntries() const
 void UOmniDebugSubsystem::ClearEntries()
 {
 	Entries.Reset();
+	EntryTexts.Reset();
 	++Revision;
 }
 
@@ -115,32 +127,55 @@ int32 UOmniDebugSubsystem::GetRevision() const
 	return Revision;
 }
 
+bool UOmniDebugSubsystem::IsLevelEnabled(const EOmniDebugLevel Level) const
+{
+	return ShouldLog(Level);
+}
+
 void UOmniDebugSubsystem::AddEntry(const EOmniDebugLevel Level, const FName Category, const FString& Message, const FName Source)
 {
-	if (DebugMode == EOmniDebugMode::Off)
+	if (!IsInGameThread())
 	{
+		FStagedRecord Staged;
+		if (PrepareStagedRecord(Staged.Record, Level, Category, Source))
+		{
+			Staged.Text = Message;
+			StagedRecords.Enqueue(MoveTemp(Staged));
+		}
 		return;
 	}
-	if (DebugMode == EOmniDebugMode::Basic && Level == EOmniDebugLevel::Info)
+
+	if (FOmniDebugRecord* Record = PushRecord(Level, Category, Source))
 	{
-		return;
+		SetRecordText(*Record, CopyTemp(Message));
 	}
+}
 
-	FOmniDebugEntry Entry;
-	Entry.TimestampUtc = BuildTimestampUtc();
-	Entry.Level = Level;
-	Entry.Category = Category;
-	Entry.Source = Source;
-	Entry.Message = Message;
-
-	if (const UWorld* World = GetWorld())
+void UOmniDebugSubsystem::AddRecord(
+	const EOmniDebugLevel Level,
+	const FName Category,
+	const FOmniDebugFormat& Format,
+	const std::initializer_list<FOmniDebugArg> Args,
+	const FName Source
+)
+{
+	if (!IsInGameThread())
 	{
-		Entry.WorldTimeSeconds = World->GetTimeSeconds();
+		FStagedRecord Staged;
+		if (PrepareStagedRecord(Staged.Record, Level, Category, Source))
+		{
+			Staged.Record.FormatId = Format.Id;
+			Staged.Record.SetArgs(Args);
+			StagedRecords.Enqueue(MoveTemp(Staged));
+		}
+		return;
 	}
 
-	Entries.Add(MoveTemp(Entry));
-	TrimToMaxEntries();
-	++Revision;
+	if (FOmniDebugRecord* Record = PushRecord(Level, Category, Source))
+	{
+		Record->FormatId = Format.Id;
+		Record->SetArgs(Args);
+	}
 }
 
 void UOmniDebugSubsystem::LogInfo(const FName Category, const FString& Message, const FName Source)
@@ -165,30 +200,38 @@ void UOmniDebugSubsystem::LogEvent(const FName Category, const FString& Message,
 
 TArray<FOmniDebugEntry> UOmniDebugSubsystem::GetEntriesSnapshot() const
 {
-	return Entries;
+	return CopyRecentEntries(Entries.Num());
 }
 
-TArray<FOmniDebugEntry> UOmniDebugSubsystem::GetRecentEntries(const int32 MaxCount) const
+TArray<FOmniDebugEntry> UOmniDebugSubsystem::CopyRecentEntries(const int32 MaxCount) const
 {
-	if (MaxCount <= 0 || Entries.Num() == 0)
-	{
-		return {};
-	}
-
-	const int32 SafeCount = FMath::Min(MaxCount, Entries.Num());
-	const int32 StartIndex = Entries.Num() - SafeCount;
+	const FOmniDebugRecordRange Range = GetRecentRecords(MaxCount);
 
 	TArray<FOmniDebugEntry> Result;
-	Result.Reserve(SafeCount);
-
-	for (int32 Index = StartIndex; Index < Entries.Num(); ++Index)
+	Result.Reserve(Range.Num());
+	for (const FOmniDebugRecord& Record : Range)
 	{
-		Result.Add(Entries[Index]);
+		Result.Add(Record.ToEntry(FindRecordText(Record)));
 	}
 
 	return Result;
 }
 
+FOmniDebugRecordRange UOmniDebugSubsystem::GetRecentRecords(const int32 MaxCount) const
+{
+	return Entries.GetTail(MaxCount);
+}
+
+FString UOmniDebugSubsystem::RenderRecordMessage(const FOmniDebugRecord& Record) const
+{
+	return Record.RenderMessage(FindRecordText(Record));
+}
+
+uint64 UOmniDebugSubsystem::GetLastRecordSequence() const
+{
+	return LastRecordSequence;
+}
+
 void UOmniDebugSubsystem::SetMetric(const FName Key, const FString& Value)
 {
 	if (Key == NAME_None)
@@ -196,6 +239,12 @@ void UOmniDebugSubsystem::SetMetric(const FName Key, const FString& Value)
 		return;
 	}
 
+	if (!IsInGameThread())
+	{
+		StageMetric(Key, Value, false);
+		return;
+	}
+
 	FString* ExistingValue = LiveMetrics.Find(Key);
 	if (ExistingValue && *ExistingValue == Value)
 	{
@@ -213,6 +262,12 @@ void UOmniDebugSubsystem::RemoveMetric(const FName Key)
 		return;
 	}
 
+	if (!IsInGameThread())
+	{
+		StageMetric(Key, FString(), true);
+		return;
+	}
+
 	if (LiveMetrics.Remove(Key) > 0)
 	{
 		++Revision;
@@ -221,6 +276,12 @@ void UOmniDebugSubsystem::RemoveMetric(const FName Key)
 
 void UOmniDebugSubsystem::ClearMetrics()
 {
+	if (!IsInGameThread())
+	{
+		StageMetric(NAME_None, FString(), true);
+		return;
+	}
+
 	if (LiveMetrics.Num() == 0)
 	{
 		return;
@@ -233,7 +294,7 @@ void UOmniDebugSubsystem::ClearMetrics()
 TArray<FOmniDebugMetric> UOmniDebugSubsystem::GetMetricsSnapshot() const
 {
 	TArray<FOmniDebugMetric> Result;
-	Result.Reserve(LiveMetrics.Num());
+	Result.Reserve(LiveMetrics.Num() + MetricRegistry.Num());
 
 	for (const TPair<FName, FString>& Pair : LiveMetrics)
 	{
@@ -242,6 +303,15 @@ TArray<FOmniDebugMetric> UOmniDebugSubsystem::GetMetricsSnapshot() const
 		Metric.Value = Pair.Value;
 	}
 
+	MetricRegistry.ForEachMetric(
+		[this, &Result](const FOmniMetricHandle Handle, const FName Key)
+		{
+			FOmniDebugMetric& Metric = Result.AddDefaulted_GetRef();
+			Metric.Key = Key;
+			Metric.Value = MetricRegistry.FormatValue(Handle);
+		}
+	);
+
 	Result.Sort(
 		[](const FOmniDebugMetric& Left, const FOmniDebugMetric& Right)
 		{
@@ -252,6 +322,21 @@ TArray<FOmniDebugMetric> UOmniDebugSubsystem::GetMetricsSnapshot() const
 	return Result;
 }
 
+const TMap<FName, FString>& UOmniDebugSubsystem::GetLiveMetrics() const
+{
+	return LiveMetrics;
+}
+
+FOmniMetricRegistry& UOmniDebugSubsystem::GetMetricRegistry()
+{
+	return MetricRegistry;
+}
+
+const FOmniMetricRegistry& UOmniDebugSubsystem::GetMetricRegistry() const
+{
+	return MetricRegistry;
+}
+
 bool UOmniDebugSubsystem::ShowOverlay(APlayerController* PlayerController)
 {
 	if (ActiveOverlayWidget && ActiveOverlayWidget->IsInViewport())
@@ -320,17 +405,6 @@ void UOmniDebugSubsystem::SetOverlayWidgetClass(TSubclassOf<UOmniDebugOverlayWid
 	OverlayWidgetClass = NewOverlayWidgetClass;
 }
 
-void UOmniDebugSubsystem::TrimToMaxEntries()
-{
-	if (Entries.Num() <= MaxEntries)
-	{
-		return;
-	}
-
-	const int32 OverflowCount = Entries.Num() - MaxEntries;
-	Entries.RemoveAt(0, OverflowCount, EAllowShrinking::No);
-}
-
 void UOmniDebugSubsystem::SyncDebugModeFromConsole()
 {
 	IConsoleVariable* DebugModeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("omni.debug"));
@@ -363,9 +437,166 @@ EOmniDebugMode UOmniDebugSubsystem::ToDebugMode(const int32 ConsoleValue)
 	}
 }
 
-FString UOmniDebugSubsystem::BuildTimestampUtc()
+void UOmniDebugSubsystem::RefreshEnabledLevelMask()
+{
+	uint8 NewMask = 0;
+	for (const EOmniDebugLevel Level : { EOmniDebugLevel::Info, EOmniDebugLevel::Warning, EOmniDebugLevel::Error, EOmniDebugLevel::Event })
+	{
+		if (DebugMode == EOmniDebugMode::Off || (DebugMode == EOmniDebugMode::Basic && Level == EOmniDebugLevel::Info))
+		{
+			continue;
+		}
+
+		NewMask |= static_cast<uint8>(1u << static_cast<uint8>(Level));
+	}
+
+	// Producers on other threads read the mask without synchronising with the game thread.
+	EnabledLevelMask.store(NewMask, std::memory_order_relaxed);
+}
+
+FOmniDebugRecord* UOmniDebugSubsystem::PushRecord(const EOmniDebugLevel Level, const FName Category, const FName Source)
 {
-	return FDateTime::UtcNow().ToString(TEXT("%Y-%m-%d %H:%M:%S"));
+	if (!ShouldLog(Level))
+	{
+		return nullptr;
+	}
+
+	FOmniDebugRecord& Record = Entries.Push(FOmniDebugRecord());
+	Record.TimestampTicks = FDateTime::UtcNow().GetTicks();
+	Record.Level = Level;
+	Record.Category = Category;
+	Record.Source = Source;
+	if (const UWorld* World = GetWorld())
+	{
+		Record.WorldTimeSeconds = World->GetTimeSeconds();
+	}
+
+	++LastRecordSequence;
+	++Revision;
+	return &Record;
+}
+
+bool UOmniDebugSubsystem::PrepareStagedRecord(
+	FOmniDebugRecord& Record,
+	const EOmniDebugLevel Level,
+	const FName Category,
+	const FName Source
+)
+{
+	if (!ShouldLog(Level))
+	{
+		return false;
+	}
+
+	if (!ReserveStagedSlot())
+	{
+		return false;
+	}
+
+	// GetWorld() is not safe here; use the world time cached by the last drain.
+	Record.TimestampTicks = FDateTime::UtcNow().GetTicks();
+	Record.Level = Level;
+	Record.Category = Category;
+	Record.Source = Source;
+	Record.WorldTimeSeconds = CachedWorldTimeSeconds.load(std::memory_order_relaxed);
+	return true;
+}
+
+void UOmniDebugSubsystem::SetRecordText(FOmniDebugRecord& Record, FString&& Text)
+{
+	EntryTexts.Push(MoveTemp(Text));
+	Record.ArgPayloads[0] = ++LastEntryTextSequence;
+}
+
+FStringView UOmniDebugSubsystem::FindRecordText(const FOmniDebugRecord& Record) const
+{
+	if (Record.FormatId != 0)
+	{
+		return FStringView();
+	}
+
+	const uint64 OldestSequence = LastEntryTextSequence - EntryTexts.Num() + 1;
+	const uint64 Sequence = Record.ArgPayloads[0];
+	if (Sequence < OldestSequence || Sequence > LastEntryTextSequence)
+	{
+		return FStringView();
+	}
+
+	return EntryTexts[static_cast<int32>(Sequence - OldestSequence)];
+}
+
+bool UOmniDebugSubsystem::ReserveStagedSlot()
+{
+	if (StagedCount.fetch_add(1, std::memory_order_relaxed) >= OmniDebug::MaxStaged)
+	{
+		StagedCount.fetch_sub(1, std::memory_order_relaxed);
+		DroppedStagedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+void UOmniDebugSubsystem::StageMetric(const FName Key, const FString& Value, const bool bRemove)
+{
+	if (ReserveStagedSlot())
+	{
+		StagedMetrics.Enqueue(FStagedMetric{ Key, Value, bRemove });
+	}
+}
+
+void UOmniDebugSubsystem::DrainStaged()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		CachedWorldTimeSeconds.store(World->GetTimeSeconds(), std::memory_order_relaxed);
+	}
+
+	int32 NumDrained = 0;
+	while (TOptional<FStagedRecord> Staged = StagedRecords.Dequeue())
+	{
+		FOmniDebugRecord& Record = Entries.Push(MoveTemp(Staged->Record));
+		if (Record.FormatId == 0)
+		{
+			SetRecordText(Record, MoveTemp(Staged->Text));
+		}
+		++LastRecordSequence;
+		++NumDrained;
+	}
+
+	while (TOptional<FStagedMetric> Metric = StagedMetrics.Dequeue())
+	{
+		++NumDrained;
+		if (!Metric->bRemove)
+		{
+			SetMetric(Metric->Key, Metric->Value);
+		}
+		else if (Metric->Key == NAME_None)
+		{
+			ClearMetrics();
+		}
+		else
+		{
+			RemoveMetric(Metric->Key);
+		}
+	}
+
+	if (NumDrained > 0)
+	{
+		StagedCount.fetch_sub(NumDrained, std::memory_order_relaxed);
+		++Revision;
+	}
+
+	if (const int32 NumDropped = DroppedStagedCount.exchange(0, std::memory_order_relaxed))
+	{
+		AddEntry(
+			EOmniDebugLevel::Warning,
+			OmniDebug::CategoryName,
+			FString::Printf(TEXT("%d entradas de debug de outras threads descartadas (fila cheia)"), NumDropped),
+			TEXT("OmniRuntime")
+		);
+	}
+
+	MetricRegistry.MergeThreadShards();
 }
 
 APlayerController* UOmniDebugSubsystem::ResolveLocalPlayerController(APlayerController* Preferred) const
@@ -0,0 +1,149 @@
+#include "Debug/OmniDiagnosticGate.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOmniDiagnostic, Log, All);
+
+namespace OmniDiagnosticGate
+{
+	static constexpr int32 MaxTrackedKeys = 1024;
+
+	struct FPendingFlush
+	{
+		FName Category = NAME_None;
+		FName MessageId = NAME_None;
+		int32 SuppressedCount = 0;
+	};
+
+	static void LogPending(const TArray<FPendingFlush>& Pending)
+	{
+		for (const FPendingFlush& Entry : Pending)
+		{
+			UE_LOG(
+				LogOmniDiagnostic,
+				Log,
+				TEXT("[Omni] %s.%s: +%d repeticoes suprimidas sem nova ocorrencia."),
+				*Entry.Category.ToString(),
+				*Entry.MessageId.ToString(),
+				Entry.SuppressedCount
+			);
+		}
+	}
+
+	static TAutoConsoleVariable<float> CVarWindowSeconds(
+		TEXT("omni.diag.window"),
+		5.0f,
+		TEXT("Janela (segundos) em que diagnosticos repetidos do Omni sao agregados.\n0=Desliga a deduplicacao"),
+		ECVF_Default
+	);
+}
+
+FString FOmniDiagnosticDecision::GetSuppressedSuffix() const
+{
+	return SuppressedCount > 0 ? FString::Printf(TEXT(" (+%d repeticoes suprimidas)"), SuppressedCount) : FString();
+}
+
+FOmniDiagnosticGate& FOmniDiagnosticGate::Get()
+{
+	static FOmniDiagnosticGate Gate;
+	return Gate;
+}
+
+FOmniDiagnosticDecision FOmniDiagnosticGate::Check(const FName Category, const FName MessageId, const uint32 ArgsHash)
+{
+	FOmniDiagnosticDecision Decision;
+	const double WindowSeconds = OmniDiagnosticGate::CVarWindowSeconds.GetValueOnAnyThread();
+	if (WindowSeconds <= 0.0)
+	{
+		return Decision;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	const FKey Key{ Category, MessageId, ArgsHash };
+
+	FScopeLock ScopeLock(&Lock);
+	if (FState* State = States.Find(Key))
+	{
+		if (NowSeconds - State->WindowStartSeconds < WindowSeconds)
+		{
+			++State->SuppressedCount;
+			Decision.bEmit = false;
+			return Decision;
+		}
+
+		Decision.SuppressedCount = State->SuppressedCount;
+		State->WindowStartSeconds = NowSeconds;
+		State->SuppressedCount = 0;
+		return Decision;
+	}
+
+	if (States.Num() >= OmniDiagnosticGate::MaxTrackedKeys)
+	{
+		PruneExpired(NowSeconds, WindowSeconds);
+	}
+
+	States.Add(Key, FState{ NowSeconds, 0 });
+	return Decision;
+}
+
+void FOmniDiagnosticGate::FlushExpired()
+{
+	const double WindowSeconds = OmniDiagnosticGate::CVarWindowSeconds.GetValueOnAnyThread();
+	const double NowSeconds = FPlatformTime::Seconds();
+	TArray<OmniDiagnosticGate::FPendingFlush> Pending;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (auto It = States.CreateIterator(); It; ++It)
+		{
+			if (NowSeconds - It.Value().WindowStartSeconds < WindowSeconds)
+			{
+				continue;
+			}
+
+			if (It.Value().SuppressedCount > 0)
+			{
+				Pending.Add({ It.Key().Category, It.Key().MessageId, It.Value().SuppressedCount });
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	OmniDiagnosticGate::LogPending(Pending);
+}
+
+void FOmniDiagnosticGate::Reset()
+{
+	TArray<OmniDiagnosticGate::FPendingFlush> Pending;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (const TPair<FKey, FState>& Pair : States)
+		{
+			if (Pair.Value.SuppressedCount > 0)
+			{
+				Pending.Add({ Pair.Key.Category, Pair.Key.MessageId, Pair.Value.SuppressedCount });
+			}
+		}
+		States.Reset();
+	}
+
+	OmniDiagnosticGate::LogPending(Pending);
+}
+
+void FOmniDiagnosticGate::PruneExpired(const double NowSeconds, const double WindowSeconds)
+{
+	for (auto It = States.CreateIterator(); It; ++It)
+	{
+		if (NowSeconds - It.Value().WindowStartSeconds >= WindowSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Every key is still hot: forget all of them rather than grow without bound.
+	if (States.Num() >= OmniDiagnosticGate::MaxTrackedKeys)
+	{
+		States.Reset();
+	}
+}
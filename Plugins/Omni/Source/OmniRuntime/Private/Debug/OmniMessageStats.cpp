@@ -0,0 +1,197 @@
+#include "Debug/OmniMessageStats.h"
+
+namespace OmniMessageStats
+{
+	static const double BucketUpperBoundsMs[FOmniMessageStats::NumBucketBounds] =
+		{ 0.001, 0.002, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+
+	static uint32 HashKey(const EOmniMessageKind Kind, const FName TargetSystem, const FName MessageName)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(TargetSystem), GetTypeHash(MessageName)), static_cast<uint32>(Kind));
+	}
+}
+
+double FOmniMessageStatsSnapshot::EstimatePercentileMs(const double Percentile) const
+{
+	const uint64 TargetRank = static_cast<uint64>(FMath::CeilToDouble(Percentile * static_cast<double>(Calls)));
+	uint64 Cumulative = 0;
+	for (int32 BucketIndex = 0; BucketIndex < BucketCounts.Num(); ++BucketIndex)
+	{
+		Cumulative += BucketCounts[BucketIndex];
+		if (Cumulative >= TargetRank && Cumulative > 0)
+		{
+			return BucketIndex < FOmniMessageStats::NumBucketBounds ? OmniMessageStats::BucketUpperBoundsMs[BucketIndex] : MaxMs;
+		}
+	}
+
+	return MaxMs;
+}
+
+const TCHAR* FOmniMessageStatsSnapshot::LexKind(const EOmniMessageKind Kind)
+{
+	switch (Kind)
+	{
+	case EOmniMessageKind::Query:
+		return TEXT("Query");
+	case EOmniMessageKind::Event:
+		return TEXT("Event");
+	case EOmniMessageKind::Command:
+	default:
+		return TEXT("Command");
+	}
+}
+
+FOmniMessageStats::FOmniMessageStats()
+{
+	for (std::atomic<FEntry*>& Slot : Slots)
+	{
+		Slot.store(nullptr, std::memory_order_relaxed);
+	}
+
+	const double CyclesPerMs = 1.0 / (FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+	for (int32 Index = 0; Index < NumBucketBounds; ++Index)
+	{
+		BucketUpperBoundCycles[Index] = static_cast<uint64>(OmniMessageStats::BucketUpperBoundsMs[Index] * CyclesPerMs);
+	}
+}
+
+FOmniMessageStats::~FOmniMessageStats()
+{
+	for (std::atomic<FEntry*>& Slot : Slots)
+	{
+		delete Slot.exchange(nullptr, std::memory_order_acq_rel);
+	}
+}
+
+FOmniMessageStats::FEntry* FOmniMessageStats::FindOrAdd(const EOmniMessageKind Kind, const FName TargetSystem, const FName MessageName)
+{
+	const uint32 Hash = OmniMessageStats::HashKey(Kind, TargetSystem, MessageName);
+	FEntry* NewEntry = nullptr;
+	for (int32 Probe = 0; Probe < Capacity; ++Probe)
+	{
+		std::atomic<FEntry*>& Slot = Slots[(Hash + Probe) & (Capacity - 1)];
+		FEntry* Existing = Slot.load(std::memory_order_acquire);
+		if (!Existing)
+		{
+			if (!NewEntry)
+			{
+				NewEntry = new FEntry();
+				NewEntry->Kind = Kind;
+				NewEntry->TargetSystem = TargetSystem;
+				NewEntry->MessageName = MessageName;
+			}
+
+			if (Slot.compare_exchange_strong(Existing, NewEntry, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return NewEntry;
+			}
+		}
+
+		// Either occupied from the start or another producer won the CAS; Existing now holds the winner.
+		if (Existing->Kind == Kind && Existing->TargetSystem == TargetSystem && Existing->MessageName == MessageName)
+		{
+			delete NewEntry;
+			return Existing;
+		}
+	}
+
+	delete NewEntry;
+	return nullptr;
+}
+
+void FOmniMessageStats::RecordCall(FEntry* Entry, const uint64 Cycles, const bool bSuccess) const
+{
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->Calls.fetch_add(1, std::memory_order_relaxed);
+	if (!bSuccess)
+	{
+		Entry->Failures.fetch_add(1, std::memory_order_relaxed);
+	}
+	Entry->TotalCycles.fetch_add(Cycles, std::memory_order_relaxed);
+
+	uint64 PreviousMax = Entry->MaxCycles.load(std::memory_order_relaxed);
+	while (Cycles > PreviousMax && !Entry->MaxCycles.compare_exchange_weak(PreviousMax, Cycles, std::memory_order_relaxed))
+	{
+	}
+
+	int32 BucketIndex = 0;
+	while (BucketIndex < NumBucketBounds && Cycles > BucketUpperBoundCycles[BucketIndex])
+	{
+		++BucketIndex;
+	}
+	Entry->BucketCounts[BucketIndex].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FOmniMessageStats::RecordReject(FEntry* Entry)
+{
+	if (Entry)
+	{
+		Entry->ValidationRejects.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FOmniMessageStats::Reset()
+{
+	for (std::atomic<FEntry*>& Slot : Slots)
+	{
+		FEntry* Entry = Slot.load(std::memory_order_acquire);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		Entry->Calls.store(0, std::memory_order_relaxed);
+		Entry->Failures.store(0, std::memory_order_relaxed);
+		Entry->ValidationRejects.store(0, std::memory_order_relaxed);
+		Entry->TotalCycles.store(0, std::memory_order_relaxed);
+		Entry->MaxCycles.store(0, std::memory_order_relaxed);
+		for (std::atomic<uint64>& BucketCount : Entry->BucketCounts)
+		{
+			BucketCount.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+void FOmniMessageStats::GetSnapshot(TArray<FOmniMessageStatsSnapshot>& OutSnapshot) const
+{
+	OutSnapshot.Reset();
+	for (const std::atomic<FEntry*>& Slot : Slots)
+	{
+		const FEntry* Entry = Slot.load(std::memory_order_acquire);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		FOmniMessageStatsSnapshot& Snapshot = OutSnapshot.AddDefaulted_GetRef();
+		Snapshot.Kind = Entry->Kind;
+		Snapshot.TargetSystem = Entry->TargetSystem;
+		Snapshot.MessageName = Entry->MessageName;
+		Snapshot.Calls = Entry->Calls.load(std::memory_order_relaxed);
+		Snapshot.Failures = Entry->Failures.load(std::memory_order_relaxed);
+		Snapshot.ValidationRejects = Entry->ValidationRejects.load(std::memory_order_relaxed);
+		Snapshot.TotalMs = FPlatformTime::ToMilliseconds64(Entry->TotalCycles.load(std::memory_order_relaxed));
+		Snapshot.MaxMs = FPlatformTime::ToMilliseconds64(Entry->MaxCycles.load(std::memory_order_relaxed));
+		Snapshot.BucketCounts.SetNumUninitialized(NumBuckets);
+		for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+		{
+			Snapshot.BucketCounts[BucketIndex] = Entry->BucketCounts[BucketIndex].load(std::memory_order_relaxed);
+		}
+	}
+
+	OutSnapshot.Sort(
+		[](const FOmniMessageStatsSnapshot& Left, const FOmniMessageStatsSnapshot& Right)
+		{
+			return Left.TotalMs > Right.TotalMs;
+		}
+	);
+}
+
+TConstArrayView<double> FOmniMessageStats::GetBucketUpperBoundsMs()
+{
+	return MakeArrayView(OmniMessageStats::BucketUpperBoundsMs, NumBucketBounds);
+}
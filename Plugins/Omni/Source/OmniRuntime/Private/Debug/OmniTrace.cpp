@@ -0,0 +1,206 @@
+#include "Debug/OmniTrace.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<bool> FOmniTrace::bActive(false);
+
+namespace OmniTrace
+{
+	static constexpr int32 FlushThresholdBytes = 64 * 1024;
+
+	struct FSession
+	{
+		FCriticalSection Lock;
+		TUniquePtr<IFileHandle> FileHandle;
+		FString FilePath;
+		TArray<uint8> Buffer;
+		uint64 StartCycles = 0;
+		uint32 ProcessId = 0;
+		int64 EventCount = 0;
+	};
+
+	static FSession& GetSession()
+	{
+		static FSession Session;
+		return Session;
+	}
+
+	static void AppendJsonString(FString& Out, const TCHAR* Value)
+	{
+		Out.AppendChar(TEXT('"'));
+		for (const TCHAR* Char = Value; *Char; ++Char)
+		{
+			switch (*Char)
+			{
+			case TEXT('"'):
+				Out.Append(TEXT("\\\""));
+				break;
+			case TEXT('\\'):
+				Out.Append(TEXT("\\\\"));
+				break;
+			case TEXT('\n'):
+				Out.Append(TEXT("\\n"));
+				break;
+			case TEXT('\r'):
+				Out.Append(TEXT("\\r"));
+				break;
+			case TEXT('\t'):
+				Out.Append(TEXT("\\t"));
+				break;
+			default:
+				if (*Char < 0x20)
+				{
+					Out.Appendf(TEXT("\\u%04x"), static_cast<uint32>(*Char));
+				}
+				else
+				{
+					Out.AppendChar(*Char);
+				}
+				break;
+			}
+		}
+		Out.AppendChar(TEXT('"'));
+	}
+
+	static void AppendUtf8(TArray<uint8>& Buffer, const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text, Text.Len());
+		Buffer.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	static void FlushLocked(FSession& Session)
+	{
+		if (Session.FileHandle && Session.Buffer.Num() > 0)
+		{
+			Session.FileHandle->Write(Session.Buffer.GetData(), Session.Buffer.Num());
+		}
+		Session.Buffer.Reset();
+	}
+
+	static double CyclesToMicroseconds(const uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles) * 1000.0;
+	}
+}
+
+bool FOmniTrace::Start(const FString& FilePath, FString& OutError)
+{
+	Stop();
+
+	OmniTrace::FSession& Session = OmniTrace::GetSession();
+	FScopeLock ScopeLock(&Session.Lock);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+	Session.FileHandle.Reset(PlatformFile.OpenWrite(*FilePath, false, false));
+	if (!Session.FileHandle)
+	{
+		OutError = FString::Printf(TEXT("Could not open trace file for writing: %s"), *FilePath);
+		return false;
+	}
+
+	Session.FilePath = FilePath;
+	Session.StartCycles = FPlatformTime::Cycles64();
+	Session.ProcessId = FPlatformProcess::GetCurrentProcessId();
+	Session.EventCount = 0;
+	Session.Buffer.Reset();
+	OmniTrace::AppendUtf8(Session.Buffer, TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"));
+
+	bActive.store(true, std::memory_order_relaxed);
+	return true;
+}
+
+void FOmniTrace::Stop()
+{
+	OmniTrace::FSession& Session = OmniTrace::GetSession();
+	FScopeLock ScopeLock(&Session.Lock);
+	bActive.store(false, std::memory_order_relaxed);
+	if (!Session.FileHandle)
+	{
+		return;
+	}
+
+	OmniTrace::AppendUtf8(Session.Buffer, TEXT("\n]}\n"));
+	OmniTrace::FlushLocked(Session);
+	Session.FileHandle->Flush();
+	Session.FileHandle.Reset();
+}
+
+FString FOmniTrace::GetFilePath()
+{
+	OmniTrace::FSession& Session = OmniTrace::GetSession();
+	FScopeLock ScopeLock(&Session.Lock);
+	return Session.FilePath;
+}
+
+int64 FOmniTrace::GetEventCount()
+{
+	OmniTrace::FSession& Session = OmniTrace::GetSession();
+	FScopeLock ScopeLock(&Session.Lock);
+	return Session.EventCount;
+}
+
+void FOmniTrace::WriteCompleteEvent(
+	const TCHAR* Category,
+	const FName Name,
+	const uint64 StartCycles,
+	const uint64 EndCycles,
+	const TConstArrayView<TPair<FName, FString>> Args
+)
+{
+	// Formatting happens outside the lock; only the buffer append is serialized.
+	FString Line;
+	Line.Reserve(160);
+	Line.Append(TEXT("{\"ph\":\"X\",\"cat\":"));
+	OmniTrace::AppendJsonString(Line, Category);
+	Line.Append(TEXT(",\"name\":"));
+	OmniTrace::AppendJsonString(Line, *Name.ToString());
+
+	OmniTrace::FSession& Session = OmniTrace::GetSession();
+	const uint64 SessionStart = Session.StartCycles;
+	const uint64 ClampedStart = FMath::Max(StartCycles, SessionStart);
+	Line.Appendf(
+		TEXT(",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":%u"),
+		OmniTrace::CyclesToMicroseconds(ClampedStart - SessionStart),
+		OmniTrace::CyclesToMicroseconds(EndCycles >= ClampedStart ? EndCycles - ClampedStart : 0),
+		Session.ProcessId,
+		FPlatformTLS::GetCurrentThreadId()
+	);
+
+	if (Args.Num() > 0)
+	{
+		Line.Append(TEXT(",\"args\":{"));
+		for (int32 Index = 0; Index < Args.Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Line.AppendChar(TEXT(','));
+			}
+			OmniTrace::AppendJsonString(Line, *Args[Index].Key.ToString());
+			Line.AppendChar(TEXT(':'));
+			OmniTrace::AppendJsonString(Line, *Args[Index].Value);
+		}
+		Line.AppendChar(TEXT('}'));
+	}
+	Line.AppendChar(TEXT('}'));
+
+	FScopeLock ScopeLock(&Session.Lock);
+	if (!Session.FileHandle)
+	{
+		return;
+	}
+
+	if (Session.EventCount > 0)
+	{
+		OmniTrace::AppendUtf8(Session.Buffer, TEXT(",\n"));
+	}
+	OmniTrace::AppendUtf8(Session.Buffer, Line);
+	++Session.EventCount;
+
+	if (Session.Buffer.Num() >= OmniTrace::FlushThresholdBytes)
+	{
+		OmniTrace::FlushLocked(Session);
+	}
+}
@@ -0,0 +1,68 @@
+#include "Debug/UI/OmniDebugLineList.h"
+
+#include "Styling/CoreStyle.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+
+TArray<TSharedPtr<FOmniDebugLine>>& UOmniDebugLineList::GetLines()
+{
+	return Lines;
+}
+
+void UOmniDebugLineList::RequestRefresh(const bool bScrollToEnd)
+{
+	if (!ListView.IsValid())
+	{
+		return;
+	}
+
+	ListView->RequestListRefresh();
+	if (bScrollToEnd && Lines.Num() > 0)
+	{
+		ListView->ScrollToBottom();
+	}
+}
+
+void UOmniDebugLineList::SetFontSize(const int32 NewFontSize)
+{
+	FontSize = FMath::Max(8, NewFontSize);
+	if (ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+}
+
+void UOmniDebugLineList::ReleaseSlateResources(const bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+	ListView.Reset();
+}
+
+TSharedRef<SWidget> UOmniDebugLineList::RebuildWidget()
+{
+	ListView = SNew(SListView<TSharedPtr<FOmniDebugLine>>)
+		.ListItemsSource(&Lines)
+		.SelectionMode(ESelectionMode::None)
+		.OnGenerateRow_UObject(this, &UOmniDebugLineList::HandleGenerateRow);
+
+	return ListView.ToSharedRef();
+}
+
+TSharedRef<ITableRow> UOmniDebugLineList::HandleGenerateRow(
+	TSharedPtr<FOmniDebugLine> Line,
+	const TSharedRef<STableViewBase>& OwnerTable
+)
+{
+	return SNew(STableRow<TSharedPtr<FOmniDebugLine>>, OwnerTable)
+		.ShowSelection(false)
+		[
+			SNew(STextBlock)
+			.Font(FCoreStyle::GetDefaultFontStyle("Regular", FontSize))
+			.ColorAndOpacity(FLinearColor::White)
+			.Text_Lambda([Line]()
+			{
+				return Line.IsValid() ? Line->Text : FText::GetEmpty();
+			})
+		];
+}
@@ -2,10 +2,13 @@
 
 #include "Blueprint/WidgetTree.h"
 #include "Components/Border.h"
+#include "Components/HorizontalBox.h"
+#include "Components/HorizontalBoxSlot.h"
 #include "Components/TextBlock.h"
 #include "Components/VerticalBox.h"
 #include "Components/VerticalBoxSlot.h"
 #include "Debug/OmniDebugSubsystem.h"
+#include "Debug/UI/OmniDebugLineList.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -51,6 +54,7 @@ void UOmniDebugOverlayWidget::InitializeWithSubsystem(UOmniDebugSubsystem* InDeb
 {
 	DebugSubsystem = InDebugSubsystem;
 	LastSeenRevision = INDEX_NONE;
+	ResetLines();
 	RefreshNow();
 }
 
@@ -58,6 +62,7 @@ void UOmniDebugOverlayWidget::SetMaxVisibleEntries(const int32 NewMaxVisibleEntr
 {
 	MaxVisibleEntries = FMath::Max(1, NewMaxVisibleEntries);
 	LastSeenRevision = INDEX_NONE;
+	ResetLines();
 	RefreshNow();
 }
 
@@ -73,7 +78,7 @@ void UOmniDebugOverlayWidget::RefreshNow()
 		}
 	}
 
-	if (!HeaderText || !BodyText)
+	if (!HeaderText || !MetricsList || !LogList)
 	{
 		return;
 	}
@@ -81,18 +86,31 @@ void UOmniDebugOverlayWidget::RefreshNow()
 	if (!DebugSubsystem)
 	{
 		HeaderText->SetText(LOCTEXT("HeaderSubsystemUnavailable", "Omni Debug Overlay (Subsystem indisponivel)"));
-		BodyText->SetText(LOCTEXT("BodyNoDataSource", "Nenhuma fonte de dados encontrada."));
+		ResetLines();
+
+		TSharedPtr<FOmniDebugLine> PlaceholderLine = MakeShared<FOmniDebugLine>();
+		PlaceholderLine->Text = LOCTEXT("BodyNoDataSource", "Nenhuma fonte de dados encontrada.");
+		LogList->GetLines().Add(PlaceholderLine);
+		LogList->RequestRefresh(false);
 		return;
 	}
 
+	// Text metrics bump the subsystem revision, numeric ones the registry revision; skip formatting when neither moved.
 	const int32 CurrentRevision = DebugSubsystem->GetRevision();
+	const uint32 CurrentMetricRevision = DebugSubsystem->GetMetricRegistry().GetRevision();
+	if (CurrentRevision != LastSeenRevision || CurrentMetricRevision != LastSeenMetricRevision)
+	{
+		RefreshMetricLines();
+		LastSeenMetricRevision = CurrentMetricRevision;
+	}
+
 	if (CurrentRevision == LastSeenRevision)
 	{
 		return;
 	}
 
 	HeaderText->SetText(BuildHeaderText());
-	BodyText->SetText(BuildBodyText());
+	RefreshLogLines();
 	LastSeenRevision = CurrentRevision;
 }
 
@@ -127,7 +145,7 @@ void UOmniDebugOverlayWidget::NativeDestruct()
 
 void UOmniDebugOverlayWidget::EnsureWidgetTreeBuilt()
 {
-	if (!WidgetTree || (HeaderText && BodyText))
+	if (!WidgetTree || (HeaderText && MetricsList && LogList))
 	{
 		return;
 	}
@@ -147,21 +165,49 @@ void UOmniDebugOverlayWidget::EnsureWidgetTreeBuilt()
 	}
 	HeaderText->SetText(LOCTEXT("HeaderDefault", "Omni Painel de Debug"));
 
-	BodyText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("OmniDebugBody"));
-	BodyText->SetColorAndOpacity(FSlateColor(FLinearColor::White));
+	UTextBlock* MetricsHeaderText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("OmniDebugMetricsHeader"));
+	MetricsHeaderText->SetColorAndOpacity(FSlateColor(FLinearColor(0.3f, 0.95f, 0.4f, 1.0f)));
+	{
+		FSlateFontInfo MetricsHeaderFont = MetricsHeaderText->GetFont();
+		MetricsHeaderFont.Size = BodyFontSize;
+		MetricsHeaderText->SetFont(MetricsHeaderFont);
+	}
+	MetricsHeaderText->SetText(LOCTEXT("MetricsHeader", "[Metricas]"));
+
+	MetricsList = WidgetTree->ConstructWidget<UOmniDebugLineList>(UOmniDebugLineList::StaticClass(), TEXT("OmniDebugMetrics"));
+	MetricsList->SetFontSize(BodyFontSize);
+
+	LogList = WidgetTree->ConstructWidget<UOmniDebugLineList>(UOmniDebugLineList::StaticClass(), TEXT("OmniDebugLog"));
+	LogList->SetFontSize(BodyFontSize);
+
+	UVerticalBox* MetricsPanel = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("OmniDebugMetricsPanel"));
+	MetricsPanel->AddChildToVerticalBox(MetricsHeaderText);
+	if (UVerticalBoxSlot* MetricsListSlot = MetricsPanel->AddChildToVerticalBox(MetricsList))
 	{
-		FSlateFontInfo BodyFont = BodyText->GetFont();
-		BodyFont.Size = BodyFontSize;
-		BodyText->SetFont(BodyFont);
+		MetricsListSlot->SetSize(FSlateChildSize(ESlateSizeRule::Fill));
+	}
+
+	UHorizontalBox* BodyBox = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass(), TEXT("OmniDebugBody"));
+	if (UHorizontalBoxSlot* MetricsPanelSlot = BodyBox->AddChildToHorizontalBox(MetricsPanel))
+	{
+		MetricsPanelSlot->SetSize(FSlateChildSize(ESlateSizeRule::Fill));
+		MetricsPanelSlot->SetPadding(FMargin(0.0f, 0.0f, 12.0f, 0.0f));
+	}
+	if (UHorizontalBoxSlot* LogSlot = BodyBox->AddChildToHorizontalBox(LogList))
+	{
+		FSlateChildSize LogSize(ESlateSizeRule::Fill);
+		LogSize.Value = 2.0f;
+		LogSlot->SetSize(LogSize);
 	}
-	BodyText->SetAutoWrapText(false);
-	BodyText->SetText(LOCTEXT("BodyWaiting", "Aguardando logs..."));
 
 	if (UVerticalBoxSlot* HeaderSlot = VerticalBox->AddChildToVerticalBox(HeaderText))
 	{
 		HeaderSlot->SetPadding(FMargin(0.0f, 0.0f, 0.0f, 6.0f));
 	}
-	VerticalBox->AddChildToVerticalBox(BodyText);
+	if (UVerticalBoxSlot* BodySlot = VerticalBox->AddChildToVerticalBox(BodyBox))
+	{
+		BodySlot->SetSize(FSlateChildSize(ESlateSizeRule::Fill));
+	}
 
 	RootBorder->SetContent(VerticalBox);
 	WidgetTree->RootWidget = RootBorder;
@@ -183,55 +229,164 @@ FText UOmniDebugOverlayWidget::BuildHeaderText() const
 	);
 }
 
-FText UOmniDebugOverlayWidget::BuildBodyText() const
+void UOmniDebugOverlayWidget::ResetLines()
 {
-	if (!DebugSubsystem)
+	LastBuiltSequence = 0;
+	LastSeenMetricRevision = MAX_uint32;
+	TextMetricLines.Reset();
+	NumericMetricLines.Reset();
+
+	if (MetricsList)
+	{
+		MetricsList->GetLines().Reset();
+		MetricsList->RequestRefresh(false);
+	}
+	if (LogList)
+	{
+		LogList->GetLines().Reset();
+		LogList->RequestRefresh(false);
+	}
+}
+
+void UOmniDebugOverlayWidget::RefreshLogLines()
+{
+	// Record sequences are monotonic, so the visible window is [FirstSequence, LastSequence]: lines that fell
+	// out of it (evicted, cleared or beyond MaxVisibleEntries) are dropped and only newer records are formatted.
+	TArray<TSharedPtr<FOmniDebugLine>>& Lines = LogList->GetLines();
+	const uint64 LastSequence = DebugSubsystem->GetLastRecordSequence();
+	const int32 WindowCount = FMath::Min(DebugSubsystem->GetEntryCount(), MaxVisibleEntries);
+	const uint64 FirstSequence = LastSequence + 1 - static_cast<uint64>(WindowCount);
+
+	int32 NumExpired = 0;
+	while (NumExpired < Lines.Num() && Lines[NumExpired]->Id < FirstSequence)
 	{
-		return LOCTEXT("BodyNoSubsystem", "Subsystem de debug indisponivel.");
+		++NumExpired;
 	}
 
-	const TArray<FOmniDebugEntry> RecentEntries = DebugSubsystem->GetRecentEntries(MaxVisibleEntries);
-	const TArray<FOmniDebugMetric> Metrics = DebugSubsystem->GetMetricsSnapshot();
+	const uint64 FirstNewSequence = FMath::Max(LastBuiltSequence + 1, FirstSequence);
+	const int32 NumNew = LastSequence >= FirstNewSequence ? static_cast<int32>(LastSequence - FirstNewSequence + 1) : 0;
+	LastBuiltSequence = LastSequence;
+	if (NumExpired == 0 && NumNew == 0)
+	{
+		return;
+	}
 
-	FString Result;
+	Lines.RemoveAt(0, NumExpired, EAllowShrinking::No);
 
-	if (Metrics.Num() > 0)
+	uint64 Sequence = FirstNewSequence;
+	for (const FOmniDebugRecord& Record : DebugSubsystem->GetRecentRecords(NumNew))
 	{
-		Result += LOCTEXT("MetricsHeader", "[Metricas]").ToString();
-		Result += TEXT("\n");
+		TSharedPtr<FOmniDebugLine> Line = MakeShared<FOmniDebugLine>();
+		Line->Id = Sequence++;
+		Line->Text = BuildLogLineText(Record);
+		Lines.Add(MoveTemp(Line));
+	}
+
+	LogList->RequestRefresh(NumNew > 0);
+}
+
+void UOmniDebugOverlayWidget::RefreshMetricLines()
+{
+	++MetricSeenStamp;
+	bool bLayoutChanged = false;
 
-		for (const FOmniDebugMetric& Metric : Metrics)
+	for (const TPair<FName, FString>& Pair : DebugSubsystem->GetLiveMetrics())
+	{
+		UpdateMetricLine(TextMetricLines.FindOrAdd(Pair.Key), Pair.Key, Pair.Value, bLayoutChanged);
+	}
+
+	const FOmniMetricRegistry& MetricRegistry = DebugSubsystem->GetMetricRegistry();
+	MetricRegistry.ForEachMetric(
+		[this, &MetricRegistry, &bLayoutChanged](const FOmniMetricHandle Handle, const FName Key)
+		{
+			UpdateMetricLine(NumericMetricLines.FindOrAdd(Handle.Index), Key, MetricRegistry.FormatValue(Handle), bLayoutChanged);
+		}
+	);
+
+	for (auto It = TextMetricLines.CreateIterator(); It; ++It)
+	{
+		if (It.Value().SeenStamp != MetricSeenStamp)
 		{
-			Result += FString::Printf(TEXT("%s: %s\n"), *Metric.Key.ToString(), *Metric.Value);
+			It.RemoveCurrent();
+			bLayoutChanged = true;
 		}
+	}
+	for (auto It = NumericMetricLines.CreateIterator(); It; ++It)
+	{
+		if (It.Value().SeenStamp != MetricSeenStamp)
+		{
+			It.RemoveCurrent();
+			bLayoutChanged = true;
+		}
+	}
 
-		Result += TEXT("\n");
+	// Value-only changes reach the screen through the row's text binding; the list is only re-laid out
+	// when metrics appear or disappear.
+	if (!bLayoutChanged)
+	{
+		return;
 	}
 
-	if (RecentEntries.Num() == 0)
+	TArray<const FOmniDebugOverlayMetricLine*> SortedLines;
+	SortedLines.Reserve(TextMetricLines.Num() + NumericMetricLines.Num());
+	for (const TPair<FName, FOmniDebugOverlayMetricLine>& Pair : TextMetricLines)
+	{
+		SortedLines.Add(&Pair.Value);
+	}
+	for (const TPair<int32, FOmniDebugOverlayMetricLine>& Pair : NumericMetricLines)
 	{
-		if (Result.IsEmpty())
+		SortedLines.Add(&Pair.Value);
+	}
+	SortedLines.Sort(
+		[](const FOmniDebugOverlayMetricLine& Left, const FOmniDebugOverlayMetricLine& Right)
 		{
-			return LOCTEXT("BodyNoEntries", "Sem entradas.");
+			return FNameLexicalLess()(Left.Key, Right.Key);
 		}
+	);
 
-		return FText::FromString(Result);
+	TArray<TSharedPtr<FOmniDebugLine>>& Lines = MetricsList->GetLines();
+	Lines.Reset(SortedLines.Num());
+	for (const FOmniDebugOverlayMetricLine* MetricLine : SortedLines)
+	{
+		Lines.Add(MetricLine->Line);
 	}
+	MetricsList->RequestRefresh(false);
+}
+
+void UOmniDebugOverlayWidget::UpdateMetricLine(
+	FOmniDebugOverlayMetricLine& MetricLine,
+	const FName Key,
+	const FString& Value,
+	bool& bOutLayoutChanged
+) const
+{
+	MetricLine.SeenStamp = MetricSeenStamp;
 
-	for (const FOmniDebugEntry& Entry : RecentEntries)
+	const bool bNewLine = !MetricLine.Line.IsValid() || MetricLine.Key != Key;
+	if (bNewLine)
 	{
-		const FText LineText = FText::Format(
-			LOCTEXT("BodyLineFormat", "[{0}][{1}][{2}] {3}"),
-			FText::FromString(Entry.TimestampUtc),
-			OmniDebugOverlay::ToDebugLevelText(Entry.Level),
-			FText::FromName(Entry.Category),
-			FText::FromString(Entry.Message)
-		);
-		Result += LineText.ToString();
-		Result += TEXT("\n");
+		MetricLine.Key = Key;
+		MetricLine.Line = MakeShared<FOmniDebugLine>();
+		bOutLayoutChanged = true;
 	}
+	else if (MetricLine.Value == Value)
+	{
+		return;
+	}
+
+	MetricLine.Value = Value;
+	MetricLine.Line->Text = FText::FromString(FString::Printf(TEXT("%s: %s"), *Key.ToString(), *Value));
+}
 
-	return FText::FromString(Result);
+FText UOmniDebugOverlayWidget::BuildLogLineText(const FOmniDebugRecord& Record) const
+{
+	return FText::Format(
+		LOCTEXT("BodyLineFormat", "[{0}][{1}][{2}] {3}"),
+		FText::FromString(Record.RenderTimestampUtc()),
+		OmniDebugOverlay::ToDebugLevelText(Record.Level),
+		FText::FromName(Record.Category),
+		FText::FromString(DebugSubsystem->RenderRecordMessage(Record))
+	);
 }
 
 #undef LOCTEXT_NAMESPACE
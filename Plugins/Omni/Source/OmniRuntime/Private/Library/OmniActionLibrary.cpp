@@ -1,5 +1,21 @@
 #include "Library/OmniActionLibrary.h"
 
+#include "Profile/OmniActionProfile.h"
+
+void UOmniActionLibrary::PostLoad()
+{
+	Super::PostLoad();
+	UOmniActionProfile::InvalidateResolvedDefinitions();
+}
+
+#if WITH_EDITOR
+void UOmniActionLibrary::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	UOmniActionProfile::InvalidateResolvedDefinitions();
+}
+#endif
+
 UOmniDevActionLibrary::UOmniDevActionLibrary()
 {
 	if (Definitions.Num() > 0)
@@ -0,0 +1,314 @@
+#include "Manifest/OmniCookedManifest.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Systems/ActionGate/OmniActionGraph.h"
+
+namespace OmniCookedManifest
+{
+	static bool IsSectionInBounds(
+		const OmniCookedManifestFormat::FSection& Section,
+		const int64 ElementSize,
+		const int64 ImageSize
+	)
+	{
+		if (Section.Offset % OmniCookedManifestFormat::SectionAlignment != 0)
+		{
+			return false;
+		}
+
+		return static_cast<int64>(Section.Offset) + static_cast<int64>(Section.Count) * ElementSize <= ImageSize;
+	}
+}
+
+FOmniCookedManifest::FOmniCookedManifest() = default;
+
+FOmniCookedManifest::~FOmniCookedManifest()
+{
+	Close();
+}
+
+FString FOmniCookedManifest::GetDefaultFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), TEXT("Omni"), OmniCookedManifestFormat::DefaultFileName);
+}
+
+FString FOmniCookedManifest::ResolveFilePath(const FString& ConfiguredPath)
+{
+	if (ConfiguredPath.IsEmpty())
+	{
+		return GetDefaultFilePath();
+	}
+
+	return FPaths::IsRelative(ConfiguredPath) ? FPaths::Combine(FPaths::ProjectDir(), ConfiguredPath) : ConfiguredPath;
+}
+
+bool FOmniCookedManifest::Open(const FString& InFilePath, FString& OutError)
+{
+	Close();
+	OutError.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*InFilePath))
+	{
+		OutError = FString::Printf(TEXT("Cooked manifest not found: %s"), *InFilePath);
+		return false;
+	}
+
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*InFilePath);
+	if (MappedResult.HasValue())
+	{
+		MappedHandle = MappedResult.StealValue();
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		MappedHandle.Reset();
+		if (!FFileHelper::LoadFileToArray(LoadedBytes, *InFilePath, FILEREAD_Silent))
+		{
+			OutError = FString::Printf(TEXT("Failed to read cooked manifest: %s"), *InFilePath);
+			return false;
+		}
+
+		Data = LoadedBytes.GetData();
+		Size = LoadedBytes.Num();
+	}
+
+	if (!ValidateImage(OutError))
+	{
+		OutError = FString::Printf(TEXT("%s (%s)"), *OutError, *InFilePath);
+		Close();
+		return false;
+	}
+
+	Header = reinterpret_cast<const OmniCookedManifestFormat::FHeader*>(Data);
+	FilePath = InFilePath;
+	return true;
+}
+
+void FOmniCookedManifest::Close()
+{
+	Header = nullptr;
+	Data = nullptr;
+	Size = 0;
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	LoadedBytes.Empty();
+	FilePath.Reset();
+}
+
+bool FOmniCookedManifest::IsOpen() const
+{
+	return Header != nullptr;
+}
+
+bool FOmniCookedManifest::IsMemoryMapped() const
+{
+	return IsOpen() && MappedRegion.IsValid();
+}
+
+const FString& FOmniCookedManifest::GetFilePath() const
+{
+	return FilePath;
+}
+
+int64 FOmniCookedManifest::GetImageSize() const
+{
+	return Size;
+}
+
+uint32 FOmniCookedManifest::GetForgeVersion() const
+{
+	return Header ? Header->ForgeVersion : 0;
+}
+
+int32 FOmniCookedManifest::GetBuildVersion() const
+{
+	return Header ? Header->BuildVersion : 0;
+}
+
+FUtf8StringView FOmniCookedManifest::GetNamespace() const
+{
+	return Header ? GetString(Header->Namespace) : FUtf8StringView();
+}
+
+FUtf8StringView FOmniCookedManifest::GetGenerationRoot() const
+{
+	return Header ? GetString(Header->GenerationRoot) : FUtf8StringView();
+}
+
+FUtf8StringView FOmniCookedManifest::GetInputHash() const
+{
+	return Header ? GetString(Header->InputHash) : FUtf8StringView();
+}
+
+bool FOmniCookedManifest::MatchesInputHash(const FStringView InputHash) const
+{
+	const FUtf8StringView CookedHash = GetInputHash();
+	if (CookedHash.IsEmpty() || CookedHash.Len() != InputHash.Len())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < InputHash.Len(); ++Index)
+	{
+		if (FChar::ToLower(static_cast<TCHAR>(CookedHash[Index])) != FChar::ToLower(InputHash[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FUtf8StringView FOmniCookedManifest::GetString(const uint32 StringIndex) const
+{
+	const TConstArrayView<OmniCookedManifestFormat::FStringEntry> Strings =
+		GetSection<OmniCookedManifestFormat::FStringEntry>(Header ? Header->Strings : OmniCookedManifestFormat::FSection());
+	if (StringIndex >= static_cast<uint32>(Strings.Num()))
+	{
+		return FUtf8StringView();
+	}
+
+	const OmniCookedManifestFormat::FStringEntry& Entry = Strings[StringIndex];
+	if (static_cast<uint64>(Entry.Offset) + Entry.Length > Header->StringData.Count)
+	{
+		return FUtf8StringView();
+	}
+
+	return FUtf8StringView(
+		reinterpret_cast<const UTF8CHAR*>(Data + Header->StringData.Offset + Entry.Offset),
+		static_cast<int32>(Entry.Length)
+	);
+}
+
+FString FOmniCookedManifest::GetStringAsFString(const uint32 StringIndex) const
+{
+	const FUtf8StringView View = GetString(StringIndex);
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+FName FOmniCookedManifest::GetStringAsName(const uint32 StringIndex) const
+{
+	const FUtf8StringView View = GetString(StringIndex);
+	if (View.IsEmpty())
+	{
+		return NAME_None;
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+	return FName(Converted.Length(), Converted.Get());
+}
+
+TConstArrayView<OmniCookedManifestFormat::FSystemRecord> FOmniCookedManifest::GetSystems() const
+{
+	return Header ? GetSection<OmniCookedManifestFormat::FSystemRecord>(Header->Systems) : TConstArrayView<OmniCookedManifestFormat::FSystemRecord>();
+}
+
+TConstArrayView<uint32> FOmniCookedManifest::GetInitializationOrder() const
+{
+	return Header ? GetSection<uint32>(Header->InitOrder) : TConstArrayView<uint32>();
+}
+
+TConstArrayView<OmniCookedManifestFormat::FProfileRecord> FOmniCookedManifest::GetProfiles() const
+{
+	return Header ? GetSection<OmniCookedManifestFormat::FProfileRecord>(Header->Profiles) : TConstArrayView<OmniCookedManifestFormat::FProfileRecord>();
+}
+
+TConstArrayView<OmniCookedManifestFormat::FActionRecord> FOmniCookedManifest::GetActions() const
+{
+	return Header ? GetSection<OmniCookedManifestFormat::FActionRecord>(Header->Actions) : TConstArrayView<OmniCookedManifestFormat::FActionRecord>();
+}
+
+TConstArrayView<uint32> FOmniCookedManifest::GetTags() const
+{
+	return Header ? GetSection<uint32>(Header->Tags) : TConstArrayView<uint32>();
+}
+
+TConstArrayView<uint32> FOmniCookedManifest::GetRefs(const OmniCookedManifestFormat::FRange& Range) const
+{
+	const TConstArrayView<uint32> Refs = Header ? GetSection<uint32>(Header->Refs) : TConstArrayView<uint32>();
+	if (static_cast<uint64>(Range.First) + Range.Count > static_cast<uint64>(Refs.Num()))
+	{
+		return TConstArrayView<uint32>();
+	}
+
+	return Refs.Slice(static_cast<int32>(Range.First), static_cast<int32>(Range.Count));
+}
+
+TConstArrayView<uint64> FOmniCookedManifest::GetActionLockBlocks() const
+{
+	return Header ? GetSection<uint64>(Header->LockBlocks) : TConstArrayView<uint64>();
+}
+
+TConstArrayView<uint64> FOmniCookedManifest::GetActionCancelClosure() const
+{
+	return Header ? GetSection<uint64>(Header->CancelClosure) : TConstArrayView<uint64>();
+}
+
+bool FOmniCookedManifest::ValidateImage(FString& OutError) const
+{
+	using namespace OmniCookedManifestFormat;
+
+	if (!Data || Size < static_cast<int64>(sizeof(FHeader)))
+	{
+		OutError = TEXT("Cooked manifest is truncated");
+		return false;
+	}
+
+	const FHeader& ImageHeader = *reinterpret_cast<const FHeader*>(Data);
+	if (ImageHeader.Magic != OmniCookedManifestFormat::Magic)
+	{
+		OutError = TEXT("Not an Omni cooked manifest");
+		return false;
+	}
+	if (ImageHeader.Version != OmniCookedManifestFormat::Version || ImageHeader.HeaderSize != sizeof(FHeader))
+	{
+		OutError = FString::Printf(
+			TEXT("Unsupported cooked manifest version %d (expected %d)"),
+			ImageHeader.Version,
+			OmniCookedManifestFormat::Version
+		);
+		return false;
+	}
+	if (static_cast<int64>(ImageHeader.FileSize) != Size)
+	{
+		OutError = FString::Printf(TEXT("Cooked manifest size mismatch: header %u, file %lld"), ImageHeader.FileSize, Size);
+		return false;
+	}
+
+	const bool bSectionsInBounds =
+		OmniCookedManifest::IsSectionInBounds(ImageHeader.Strings, sizeof(FStringEntry), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.StringData, 1, Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.Systems, sizeof(FSystemRecord), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.InitOrder, sizeof(uint32), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.Profiles, sizeof(FProfileRecord), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.Actions, sizeof(FActionRecord), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.Tags, sizeof(uint32), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.Refs, sizeof(uint32), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.LockBlocks, sizeof(uint64), Size)
+		&& OmniCookedManifest::IsSectionInBounds(ImageHeader.CancelClosure, sizeof(uint64), Size);
+	if (!bSectionsInBounds)
+	{
+		OutError = TEXT("Cooked manifest section out of bounds");
+		return false;
+	}
+
+	const uint64 MatrixWords = static_cast<uint64>(ImageHeader.Actions.Count)
+		* FOmniActionGraph::GetWordsPerRow(static_cast<int32>(ImageHeader.Actions.Count));
+	if (ImageHeader.LockBlocks.Count != MatrixWords || ImageHeader.CancelClosure.Count != MatrixWords)
+	{
+		OutError = TEXT("Cooked manifest action graph does not match action count");
+		return false;
+	}
+
+	return true;
+}
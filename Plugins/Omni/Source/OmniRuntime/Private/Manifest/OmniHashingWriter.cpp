@@ -0,0 +1,97 @@
+#include "Manifest/OmniHashingWriter.h"
+
+FOmniHashingWriter::FOmniHashingWriter(const EOmniHashKind InHashKinds, FArchive* InDownstream)
+	: HashKinds(InHashKinds)
+	, Downstream(InDownstream)
+{
+	SetIsSaving(true);
+	SetIsPersistent(false);
+}
+
+void FOmniHashingWriter::Serialize(void* Data, const int64 Num)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	BytesWritten += Num;
+	if (Buffer.Num() + Num > BufferCapacity)
+	{
+		FlushBuffer();
+	}
+
+	if (Num >= BufferCapacity)
+	{
+		if (EnumHasAnyFlags(HashKinds, EOmniHashKind::Durable))
+		{
+			DurableHasher.Update(Data, static_cast<uint64>(Num));
+		}
+		if (EnumHasAnyFlags(HashKinds, EOmniHashKind::Fast))
+		{
+			FastHasher.Update(Data, static_cast<uint64>(Num));
+		}
+		if (Downstream)
+		{
+			Downstream->Serialize(Data, Num);
+		}
+		return;
+	}
+
+	Buffer.Append(static_cast<const uint8*>(Data), static_cast<int32>(Num));
+}
+
+void FOmniHashingWriter::Flush()
+{
+	FlushBuffer();
+	if (Downstream)
+	{
+		Downstream->Flush();
+	}
+}
+
+FString FOmniHashingWriter::GetArchiveName() const
+{
+	return TEXT("FOmniHashingWriter");
+}
+
+FString FOmniHashingWriter::FinalizeDurableHex()
+{
+	check(EnumHasAnyFlags(HashKinds, EOmniHashKind::Durable));
+	FlushBuffer();
+	return LexToString(DurableHasher.Finalize());
+}
+
+uint64 FOmniHashingWriter::FinalizeFast()
+{
+	check(EnumHasAnyFlags(HashKinds, EOmniHashKind::Fast));
+	FlushBuffer();
+	return FastHasher.Finalize().Hash;
+}
+
+FString FOmniHashingWriter::FastHashToHex(const uint64 Hash)
+{
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+void FOmniHashingWriter::FlushBuffer()
+{
+	if (Buffer.Num() == 0)
+	{
+		return;
+	}
+
+	if (EnumHasAnyFlags(HashKinds, EOmniHashKind::Durable))
+	{
+		DurableHasher.Update(Buffer.GetData(), static_cast<uint64>(Buffer.Num()));
+	}
+	if (EnumHasAnyFlags(HashKinds, EOmniHashKind::Fast))
+	{
+		FastHasher.Update(Buffer.GetData(), static_cast<uint64>(Buffer.Num()));
+	}
+	if (Downstream)
+	{
+		Downstream->Serialize(Buffer.GetData(), Buffer.Num());
+	}
+	Buffer.Reset();
+}
@@ -0,0 +1,131 @@
+#include "Manifest/OmniManifestHash.h"
+
+#include "Manifest/OmniHashingWriter.h"
+#include "Manifest/OmniManifest.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace OmniManifestHash
+{
+	struct FCanonicalSystem
+	{
+		FName SystemId = NAME_None;
+		FString SystemClassPath;
+		TArray<FName> Dependencies;
+		TArray<TPair<FName, FString>> SettingPairs;
+	};
+
+	static FString NormalizeSlashes(const FString& Input)
+	{
+		FString Result = Input;
+		Result.TrimStartAndEndInline();
+		Result.ReplaceInline(TEXT("\\"), TEXT("/"));
+		while (Result.Contains(TEXT("//")))
+		{
+			Result.ReplaceInline(TEXT("//"), TEXT("/"));
+		}
+		return Result;
+	}
+
+	static FName NormalizeNameToken(const FName InName)
+	{
+		if (InName == NAME_None)
+		{
+			return NAME_None;
+		}
+
+		FString Value = InName.ToString();
+		Value.TrimStartAndEndInline();
+		return Value.IsEmpty() ? NAME_None : FName(*Value);
+	}
+
+	static void BuildCanonicalSystems(const UOmniManifest& Manifest, TArray<FCanonicalSystem>& OutSystems)
+	{
+		for (const FOmniSystemManifestEntry& Entry : Manifest.Systems)
+		{
+			if (!Entry.bEnabled)
+			{
+				continue;
+			}
+
+			FCanonicalSystem& System = OutSystems.AddDefaulted_GetRef();
+			System.SystemId = NormalizeNameToken(Entry.SystemId);
+			System.SystemClassPath = Entry.SystemClass.ToSoftObjectPath().ToString();
+
+			for (const FName Dependency : Entry.Dependencies)
+			{
+				const FName NormalizedDependency = NormalizeNameToken(Dependency);
+				if (NormalizedDependency != NAME_None)
+				{
+					System.Dependencies.AddUnique(NormalizedDependency);
+				}
+			}
+			System.Dependencies.Sort(FNameLexicalLess());
+
+			for (const FName Key : Entry.GetSettingKeysSnapshot())
+			{
+				FString Value;
+				if (Entry.TryGetSetting(Key, Value))
+				{
+					System.SettingPairs.Emplace(Key, NormalizeSlashes(Value));
+				}
+			}
+		}
+
+		OutSystems.Sort(
+			[](const FCanonicalSystem& Left, const FCanonicalSystem& Right)
+			{
+				return FNameLexicalLess()(Left.SystemId, Right.SystemId);
+			}
+		);
+	}
+}
+
+bool FOmniManifestHash::ComputeInputHash(const UOmniManifest& Manifest, FString& OutHash)
+{
+	OutHash.Reset();
+
+	TArray<OmniManifestHash::FCanonicalSystem> Systems;
+	OmniManifestHash::BuildCanonicalSystems(Manifest, Systems);
+
+	// Canonical JSON is streamed as UTF-8 straight into the hasher.
+	FOmniHashingWriter HashWriter(EOmniHashKind::Durable);
+	const TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> Writer =
+		TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&HashWriter);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("namespace"), Manifest.Namespace.ToString().TrimStartAndEnd());
+	Writer->WriteValue(TEXT("buildVersion"), Manifest.BuildVersion);
+
+	Writer->WriteArrayStart(TEXT("systems"));
+	for (const OmniManifestHash::FCanonicalSystem& System : Systems)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("systemId"), System.SystemId.ToString());
+		Writer->WriteValue(TEXT("systemClassPath"), System.SystemClassPath);
+
+		Writer->WriteArrayStart(TEXT("dependencies"));
+		for (const FName Dependency : System.Dependencies)
+		{
+			Writer->WriteValue(Dependency.ToString());
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectStart(TEXT("settings"));
+		for (const TPair<FName, FString>& Setting : System.SettingPairs)
+		{
+			Writer->WriteValue(Setting.Key.ToString(), Setting.Value);
+		}
+		Writer->WriteObjectEnd();
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	if (!Writer->Close())
+	{
+		return false;
+	}
+
+	OutHash = HashWriter.FinalizeDurableHex();
+	return !OutHash.IsEmpty();
+}
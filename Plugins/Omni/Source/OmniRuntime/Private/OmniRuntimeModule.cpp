@@ -1,14 +1,20 @@
 #include "OmniRuntimeModule.h"
 
 #include "Debug/OmniDebugSubsystem.h"
+#include "Debug/OmniDiagnosticGate.h"
+#include "Debug/OmniTrace.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
+#include "Profile/OmniActionProfile.h"
 #include "Systems/Movement/OmniMovementSystem.h"
 #include "Systems/OmniSystemRegistrySubsystem.h"
 #include "Systems/Status/OmniStatusSystem.h"
+#include "UObject/UObjectGlobals.h"
 
 IMPLEMENT_MODULE(FOmniRuntimeModule, OmniRuntime)
 
@@ -117,6 +123,32 @@ namespace OmniRuntimeConsole
 		return Count;
 	}
 
+	static int32 ForEachRegistry(const TFunctionRef<void(UOmniSystemRegistrySubsystem*)>& Function)
+	{
+		if (!GEngine)
+		{
+			return 0;
+		}
+
+		int32 Count = 0;
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			UGameInstance* GameInstance = WorldContext.OwningGameInstance;
+			if (!GameInstance)
+			{
+				continue;
+			}
+
+			if (UOmniSystemRegistrySubsystem* Registry = GameInstance->GetSubsystem<UOmniSystemRegistrySubsystem>())
+			{
+				Function(Registry);
+				++Count;
+			}
+		}
+
+		return Count;
+	}
+
 	static void HandleOmniDebugToggleCommand()
 	{
 		const int32 AffectedSubsystems = ForEachDebugSubsystem(
@@ -141,6 +173,64 @@ namespace OmniRuntimeConsole
 		UE_LOG(LogTemp, Log, TEXT("[Omni] Entradas de debug limpas. Subsystems afetados: %d."), AffectedSubsystems);
 	}
 
+	static void HandleOmniDebugMaxEntriesCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() == 0)
+		{
+			ForEachDebugSubsystem(
+				[](UOmniDebugSubsystem* DebugSubsystem)
+				{
+					UE_LOG(
+						LogTemp,
+						Log,
+						TEXT("[Omni] Entradas de debug: %d/%d."),
+						DebugSubsystem->GetEntryCount(),
+						DebugSubsystem->GetMaxEntries()
+					);
+				}
+			);
+			return;
+		}
+
+		int32 NewMaxEntries = 0;
+		LexFromString(NewMaxEntries, *Args[0]);
+		const int32 AffectedSubsystems = ForEachDebugSubsystem(
+			[NewMaxEntries](UOmniDebugSubsystem* DebugSubsystem)
+			{
+				DebugSubsystem->SetMaxEntries(NewMaxEntries);
+			}
+		);
+
+		UE_LOG(LogTemp, Log, TEXT("[Omni] Capacidade de debug alterada para %d. Subsystems afetados: %d."), NewMaxEntries, AffectedSubsystems);
+	}
+
+	static void HandleOmniDebugDumpCommand(const TArray<FString>& Args)
+	{
+		int32 MaxCount = 50;
+		if (Args.Num() > 0)
+		{
+			LexFromString(MaxCount, *Args[0]);
+		}
+
+		ForEachDebugSubsystem(
+			[MaxCount](UOmniDebugSubsystem* DebugSubsystem)
+			{
+				for (const FOmniDebugRecord& Record : DebugSubsystem->GetRecentRecords(MaxCount))
+				{
+					UE_LOG(
+						LogTemp,
+						Log,
+						TEXT("[Omni][%s][%s][%s] %s"),
+						*Record.RenderTimestampUtc(),
+						*UEnum::GetDisplayValueAsText(Record.Level).ToString(),
+						*Record.Category.ToString(),
+						*DebugSubsystem->RenderRecordMessage(Record)
+					);
+				}
+			}
+		);
+	}
+
 	static void HandleOmniSprintCommand(const TArray<FString>& Args, UWorld* World)
 	{
 		(void)World;
@@ -231,6 +321,157 @@ namespace OmniRuntimeConsole
 		}
 	}
 
+	static void HandleOmniRecordStartCommand(const TArray<FString>& Args)
+	{
+		const FString RequestedPath = Args.Num() > 0 ? Args[0] : FString();
+		int32 RegistryIndex = 0;
+		ForEachRegistry(
+			[&RequestedPath, &RegistryIndex](UOmniSystemRegistrySubsystem* Registry)
+			{
+				// Com mais de uma instancia (PIE multiplayer), cada registry grava em um arquivo proprio.
+				FString FilePath = RequestedPath;
+				if (!FilePath.IsEmpty() && RegistryIndex > 0)
+				{
+					FilePath = FPaths::SetExtension(
+						FString::Printf(TEXT("%s_%d"), *FPaths::ChangeExtension(FilePath, TEXT("")), RegistryIndex),
+						FPaths::GetExtension(RequestedPath)
+					);
+				}
+				++RegistryIndex;
+
+				if (Registry->StartRecording(FilePath))
+				{
+					UE_LOG(LogTemp, Log, TEXT("[Omni] Gravacao iniciada: %s"), *Registry->GetRecordingFilePath());
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[Omni] Falha ao iniciar gravacao."));
+				}
+			}
+		);
+
+		if (RegistryIndex == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Omni] Nenhum registry encontrado para gravar."));
+		}
+	}
+
+	static void HandleOmniRecordStopCommand()
+	{
+		int32 StoppedCount = 0;
+		ForEachRegistry(
+			[&StoppedCount](UOmniSystemRegistrySubsystem* Registry)
+			{
+				if (!Registry->IsRecording())
+				{
+					return;
+				}
+
+				const FString FilePath = Registry->GetRecordingFilePath();
+				Registry->StopRecording();
+				UE_LOG(LogTemp, Log, TEXT("[Omni] Gravacao finalizada: %s"), *FilePath);
+				++StoppedCount;
+			}
+		);
+
+		if (StoppedCount == 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[Omni] Nenhuma gravacao ativa."));
+		}
+	}
+
+	static void HandleOmniStatsCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			const int32 AffectedRegistries = ForEachRegistry(
+				[](UOmniSystemRegistrySubsystem* Registry)
+				{
+					Registry->GetMessageStats().Reset();
+				}
+			);
+			UE_LOG(LogTemp, Log, TEXT("[Omni] Estatisticas de mensagens zeradas. Registries afetados: %d."), AffectedRegistries);
+			return;
+		}
+
+		int32 MaxRows = 30;
+		if (Args.Num() > 0)
+		{
+			LexFromString(MaxRows, *Args[0]);
+		}
+
+		ForEachRegistry(
+			[MaxRows](UOmniSystemRegistrySubsystem* Registry)
+			{
+				TArray<FOmniMessageStatsSnapshot> Snapshot;
+				Registry->GetMessageStats().GetSnapshot(Snapshot);
+				UE_LOG(LogTemp, Log, TEXT("[Omni] Estatisticas de mensagens (%d tipos, ordenado por tempo total):"), Snapshot.Num());
+
+				const int32 RowCount = MaxRows > 0 ? FMath::Min(MaxRows, Snapshot.Num()) : Snapshot.Num();
+				for (int32 Index = 0; Index < RowCount; ++Index)
+				{
+					const FOmniMessageStatsSnapshot& Row = Snapshot[Index];
+					UE_LOG(
+						LogTemp,
+						Log,
+						TEXT("[Omni] %-7s %s.%s calls=%llu fail=%llu reject=%llu total=%.3fms avg=%.4fms p50<=%.4fms p99<=%.4fms max=%.4fms"),
+						FOmniMessageStatsSnapshot::LexKind(Row.Kind),
+						Row.TargetSystem == NAME_None ? TEXT("*") : *Row.TargetSystem.ToString(),
+						*Row.MessageName.ToString(),
+						Row.Calls,
+						Row.Failures,
+						Row.ValidationRejects,
+						Row.TotalMs,
+						Row.GetAverageMs(),
+						Row.EstimatePercentileMs(0.5),
+						Row.EstimatePercentileMs(0.99),
+						Row.MaxMs
+					);
+				}
+			}
+		);
+	}
+
+	static void HandleOmniDiagResetCommand()
+	{
+		FOmniDiagnosticGate::Get().Reset();
+		UE_LOG(LogTemp, Log, TEXT("[Omni] Deduplicacao de diagnosticos reiniciada; a proxima ocorrencia de cada aviso sera emitida."));
+	}
+
+	static void HandleOmniTraceStartCommand(const TArray<FString>& Args)
+	{
+		const FString FilePath = Args.Num() > 0
+			? Args[0]
+			: FPaths::Combine(
+				FPaths::ProjectSavedDir(),
+				TEXT("Omni/Traces"),
+				FString::Printf(TEXT("OmniTrace_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")))
+			);
+
+		FString Error;
+		if (!FOmniTrace::Start(FilePath, Error))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Omni] Falha ao iniciar trace: %s"), *Error);
+			return;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[Omni] Trace iniciado: %s"), *FilePath);
+	}
+
+	static void HandleOmniTraceStopCommand()
+	{
+		if (!FOmniTrace::IsActive())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[Omni] Nenhum trace ativo."));
+			return;
+		}
+
+		const FString FilePath = FOmniTrace::GetFilePath();
+		const int64 EventCount = FOmniTrace::GetEventCount();
+		FOmniTrace::Stop();
+		UE_LOG(LogTemp, Log, TEXT("[Omni] Trace finalizado: %s (%lld eventos). Abra em chrome://tracing ou ui.perfetto.dev."), *FilePath, EventCount);
+	}
+
 	static FAutoConsoleCommand OmniDebugToggleCommand(
 		TEXT("omni.debug.toggle"),
 		TEXT("Alterna o overlay de debug do Omni."),
@@ -243,17 +484,92 @@ namespace OmniRuntimeConsole
 		FConsoleCommandDelegate::CreateStatic(&HandleOmniDebugClearCommand)
 	);
 
+	static FAutoConsoleCommand OmniDebugMaxEntriesCommand(
+		TEXT("omni.debug.maxentries"),
+		TEXT("Consulta ou altera a capacidade do buffer de debug do Omni. Uso: omni.debug.maxentries [N]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleOmniDebugMaxEntriesCommand)
+	);
+
+	static FAutoConsoleCommand OmniDebugDumpCommand(
+		TEXT("omni.debug.dump"),
+		TEXT("Imprime no log as entradas de debug mais recentes do Omni. Uso: omni.debug.dump [N]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleOmniDebugDumpCommand)
+	);
+
 	static FAutoConsoleCommandWithWorldAndArgs OmniSprintCommand(
 		TEXT("omni.sprint"),
 		TEXT("Controle de sprint do Omni. Uso: omni.sprint start|stop|toggle|auto [segundos]|status"),
 		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleOmniSprintCommand)
 	);
+
+	static FAutoConsoleCommand OmniStatsCommand(
+		TEXT("omni.stats"),
+		TEXT("Imprime chamadas, falhas, rejeicoes e tempo de handler por (sistema, mensagem), ordenado por tempo total. Uso: omni.stats [N]|reset"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleOmniStatsCommand)
+	);
+
+	static FAutoConsoleCommand OmniDiagResetCommand(
+		TEXT("omni.diag.reset"),
+		TEXT("Esquece os diagnosticos repetidos agregados pelo Omni (ver omni.diag.window)."),
+		FConsoleCommandDelegate::CreateStatic(&HandleOmniDiagResetCommand)
+	);
+
+	static FAutoConsoleCommand OmniTraceStartCommand(
+		TEXT("omni.trace.start"),
+		TEXT("Inicia o trace Chrome/Perfetto da camada Omni (ticks, mensagens, eventos, carga de profiles). Uso: omni.trace.start [arquivo.json]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleOmniTraceStartCommand)
+	);
+
+	static FAutoConsoleCommand OmniTraceStopCommand(
+		TEXT("omni.trace.stop"),
+		TEXT("Finaliza o trace da camada Omni e fecha o arquivo JSON."),
+		FConsoleCommandDelegate::CreateStatic(&HandleOmniTraceStopCommand)
+	);
+
+	static FAutoConsoleCommand OmniRecordStartCommand(
+		TEXT("omni.record.start"),
+		TEXT("Inicia a gravacao binaria das mensagens do registry Omni. Uso: omni.record.start [arquivo]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleOmniRecordStartCommand)
+	);
+
+	static FAutoConsoleCommand OmniRecordStopCommand(
+		TEXT("omni.record.stop"),
+		TEXT("Finaliza a gravacao do registry Omni e grava o indice de chunks."),
+		FConsoleCommandDelegate::CreateStatic(&HandleOmniRecordStopCommand)
+	);
 }
 
 void FOmniRuntimeModule::StartupModule()
 {
+	// Reports repeats still counted by the diagnostic gate once their window closes without a new occurrence.
+	DiagnosticFlushHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda(
+			[](float)
+			{
+				FOmniDiagnosticGate::Get().FlushExpired();
+				return true;
+			}
+		),
+		1.0f
+	);
+
+	// Hot-reloaded profile/library packages replace objects behind cached resolves without an edit event.
+	PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddLambda(
+		[](const EPackageReloadPhase Phase, FPackageReloadedEvent*)
+		{
+			if (Phase == EPackageReloadPhase::PostBatchPreGC)
+			{
+				UOmniActionProfile::InvalidateResolvedDefinitions();
+			}
+		}
+	);
 }
 
 void FOmniRuntimeModule::ShutdownModule()
 {
+	FTSTicker::GetCoreTicker().RemoveTicker(DiagnosticFlushHandle);
+	DiagnosticFlushHandle.Reset();
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+	PackageReloadedHandle.Reset();
+	FOmniTrace::Stop();
 }
@@ -1,40 +1,181 @@
 #include "Profile/OmniActionProfile.h"
 
+#include "Algo/Reverse.h"
 #include "Library/OmniActionLibrary.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogOmniActionProfile, Log, All);
+
+namespace OmniActionProfile
+{
+	// Bumped whenever a profile or library is edited, loaded or its package reloaded; cached resolves from older
+	// generations are stale. A load counts because a cached profile may point at an asset that just replaced its old copy.
+	static std::atomic<uint32> ContentGeneration{ 1 };
+
+	static FOmniResolvedActionDefinitions MergeChain(
+		const TArray<const UOmniActionProfile*>& Chain,
+		const UOmniActionLibrary* Library
+	)
+	{
+		int32 MaxDefinitions = Library ? Library->Definitions.Num() : 0;
+		for (const UOmniActionProfile* Profile : Chain)
+		{
+			MaxDefinitions += Profile->OverrideDefinitions.Num();
+		}
+
+		TSharedRef<TArray<FOmniActionDefinition>, ESPMode::ThreadSafe> Definitions =
+			MakeShared<TArray<FOmniActionDefinition>, ESPMode::ThreadSafe>();
+		Definitions->Reserve(MaxDefinitions);
+		TMap<FName, int32> IndexById;
+		IndexById.Reserve(MaxDefinitions);
+
+		// Library duplicates are kept as-is; overrides replace the first definition with their id.
+		if (Library)
+		{
+			for (const FOmniActionDefinition& Definition : Library->Definitions)
+			{
+				const int32 Index = Definitions->Add(Definition);
+				IndexById.FindOrAdd(Definition.ActionId, Index);
+			}
+		}
+
+		for (const UOmniActionProfile* Profile : Chain)
+		{
+			for (const FOmniActionDefinition& OverrideDefinition : Profile->OverrideDefinitions)
+			{
+				if (OverrideDefinition.ActionId == NAME_None)
+				{
+					continue;
+				}
+
+				if (const int32* ExistingIndex = IndexById.Find(OverrideDefinition.ActionId))
+				{
+					(*Definitions)[*ExistingIndex] = OverrideDefinition;
+				}
+				else
+				{
+					IndexById.Add(OverrideDefinition.ActionId, Definitions->Add(OverrideDefinition));
+				}
+			}
+		}
+
+		return Definitions;
+	}
+}
 
 void UOmniActionProfile::ResolveDefinitions(TArray<FOmniActionDefinition>& OutDefinitions) const
 {
 	OutDefinitions.Reset();
+	if (const FOmniResolvedActionDefinitions Definitions = GetResolvedDefinitions())
+	{
+		OutDefinitions = *Definitions;
+	}
+}
 
-	if (const UOmniActionLibrary* LoadedLibrary = ActionLibrary.LoadSynchronous())
+FOmniResolvedActionDefinitions UOmniActionProfile::GetResolvedDefinitions() const
+{
+	FScopeLock Lock(&ResolvedDefinitionsLock);
+	const uint32 Generation = OmniActionProfile::ContentGeneration.load();
+	if (ResolvedDefinitions.IsValid() && ResolvedGeneration == Generation)
 	{
-		OutDefinitions = LoadedLibrary->Definitions;
+		return ResolvedDefinitions;
 	}
 
-	for (const FOmniActionDefinition& OverrideDefinition : OverrideDefinitions)
+	TArray<const UOmniActionProfile*> Chain;
+	FString ChainError;
+	if (!TryGetProfileChain(Chain, ChainError))
 	{
-		if (OverrideDefinition.ActionId == NAME_None)
+		UE_LOG(LogOmniActionProfile, Warning, TEXT("%s Resolving with the chain found so far."), *ChainError);
+	}
+
+	ResolvedDefinitions = OmniActionProfile::MergeChain(Chain, GetEffectiveActionLibrary().LoadSynchronous());
+	ResolvedGeneration = Generation;
+	return ResolvedDefinitions;
+}
+
+bool UOmniActionProfile::TryGetProfileChain(TArray<const UOmniActionProfile*>& OutChain, FString& OutError) const
+{
+	OutChain.Reset();
+	OutError.Reset();
+
+	bool bComplete = true;
+	for (const UOmniActionProfile* Profile = this; Profile; )
+	{
+		if (OutChain.Contains(Profile))
+		{
+			OutError = FString::Printf(TEXT("Action profile '%s' has a cycle in its ParentProfile chain."), *GetNameSafe(this));
+			bComplete = false;
+			break;
+		}
+		if (OutChain.Num() >= MaxParentDepth)
 		{
-			continue;
+			OutError = FString::Printf(
+				TEXT("Action profile '%s' has more than %d ParentProfile levels."),
+				*GetNameSafe(this),
+				MaxParentDepth
+			);
+			bComplete = false;
+			break;
 		}
 
-		const int32 ExistingIndex = OutDefinitions.IndexOfByPredicate(
-			[&OverrideDefinition](const FOmniActionDefinition& CurrentDefinition)
-			{
-				return CurrentDefinition.ActionId == OverrideDefinition.ActionId;
-			}
-		);
+		OutChain.Add(Profile);
+		if (Profile->ParentProfile.IsNull())
+		{
+			break;
+		}
 
-		if (ExistingIndex != INDEX_NONE)
+		const UOmniActionProfile* Parent = Profile->ParentProfile.LoadSynchronous();
+		if (!Parent)
 		{
-			OutDefinitions[ExistingIndex] = OverrideDefinition;
+			OutError = FString::Printf(
+				TEXT("Action profile '%s' references missing ParentProfile '%s'."),
+				*GetNameSafe(Profile),
+				*Profile->ParentProfile.ToString()
+			);
+			bComplete = false;
 		}
-		else
+		Profile = Parent;
+	}
+
+	Algo::Reverse(OutChain);
+	return bComplete;
+}
+
+TSoftObjectPtr<UOmniActionLibrary> UOmniActionProfile::GetEffectiveActionLibrary() const
+{
+	TArray<const UOmniActionProfile*> Chain;
+	FString ChainError;
+	TryGetProfileChain(Chain, ChainError);
+	for (int32 Index = Chain.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Chain[Index]->ActionLibrary.IsNull())
 		{
-			OutDefinitions.Add(OverrideDefinition);
+			return Chain[Index]->ActionLibrary;
 		}
 	}
+	return ActionLibrary;
+}
+
+void UOmniActionProfile::InvalidateResolvedDefinitions()
+{
+	++OmniActionProfile::ContentGeneration;
+}
+
+void UOmniActionProfile::PostLoad()
+{
+	Super::PostLoad();
+	InvalidateResolvedDefinitions();
+}
+
+#if WITH_EDITOR
+void UOmniActionProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	InvalidateResolvedDefinitions();
 }
+#endif
 
 UOmniDevActionProfile::UOmniDevActionProfile()
 {
@@ -0,0 +1,313 @@
+#include "Recording/OmniRecorder.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Recording/OmniRecordingFormat.h"
+
+namespace OmniRecorder
+{
+	static constexpr int32 ChunkTargetBytes = 64 * 1024;
+
+	static uint8 MakeMessageHeader(const EOmniRecordKind Kind, const bool bExternal, const bool bDuringTick)
+	{
+		return static_cast<uint8>(Kind)
+			| (bExternal ? OmniRecordingFormat::ExternalFlag : 0)
+			| (bDuringTick ? OmniRecordingFormat::DuringTickFlag : 0);
+	}
+}
+
+FOmniRecorder::FOmniRecorder() = default;
+
+FOmniRecorder::~FOmniRecorder()
+{
+	Close();
+}
+
+bool FOmniRecorder::Open(const FString& InFilePath, FString& OutError)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(InFilePath));
+	FileHandle.Reset(PlatformFile.OpenWrite(*InFilePath, false, false));
+	if (!FileHandle)
+	{
+		OutError = FString::Printf(TEXT("Could not open recording file for writing: %s"), *InFilePath);
+		return false;
+	}
+
+	FilePath = InFilePath;
+	RecordCount = 0;
+	BytesWritten = 0;
+	ChunkIndex.Reset();
+
+	TArray<uint8> Header;
+	OmniRecordingFormat::WriteFixed(Header, OmniRecordingFormat::FileMagic);
+	OmniRecordingFormat::WriteFixed(Header, OmniRecordingFormat::Version);
+	OmniRecordingFormat::WriteFixed(Header, static_cast<uint16>(0));
+	OmniRecordingFormat::WriteFixed(Header, FDateTime::UtcNow().GetTicks());
+	WriteToFile(Header);
+	return true;
+}
+
+void FOmniRecorder::Close()
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	FlushFrame();
+	FlushChunk();
+
+	TArray<uint8> Trailer;
+	const int64 IndexOffset = FileHandle->Tell();
+	OmniRecordingFormat::WriteFixed(Trailer, OmniRecordingFormat::IndexMagic);
+	OmniRecordingFormat::WriteFixed(Trailer, static_cast<uint32>(ChunkIndex.Num()));
+	for (const FOmniRecordingChunkInfo& Chunk : ChunkIndex)
+	{
+		OmniRecordingFormat::WriteFixed(Trailer, Chunk.FirstTick);
+		OmniRecordingFormat::WriteFixed(Trailer, Chunk.LastTick);
+		OmniRecordingFormat::WriteFixed(Trailer, Chunk.Offset);
+		OmniRecordingFormat::WriteFixed(Trailer, static_cast<uint32>(Chunk.FrameCount));
+	}
+	OmniRecordingFormat::WriteFixed(Trailer, IndexOffset);
+	OmniRecordingFormat::WriteFixed(Trailer, OmniRecordingFormat::EndMagic);
+	WriteToFile(Trailer);
+
+	FileHandle->Flush();
+	FileHandle.Reset();
+}
+
+bool FOmniRecorder::IsOpen() const
+{
+	return FileHandle.IsValid();
+}
+
+const FString& FOmniRecorder::GetFilePath() const
+{
+	return FilePath;
+}
+
+void FOmniRecorder::RecordBegin(const int64 TickIndex, const double SimTime, const TMap<FName, FString>& Metadata)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const uint8 Kind = static_cast<uint8>(EOmniRecordKind::Begin);
+	BeginRecord(TickIndex, Kind | OmniRecordingFormat::ExternalFlag);
+	OmniRecordingFormat::WriteFixed(FrameBuffer, SimTime);
+	WriteArguments(Kind, 0, Metadata);
+}
+
+void FOmniRecorder::RecordTick(const int64 TickIndex, const float DeltaTime, const double SimTime)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const bool bSameDelta = bHasLastDeltaTime && LastDeltaTime == DeltaTime;
+	BeginRecord(
+		TickIndex,
+		static_cast<uint8>(EOmniRecordKind::Tick) | OmniRecordingFormat::ExternalFlag | (bSameDelta ? OmniRecordingFormat::SameDeltaFlag : 0)
+	);
+	if (!bSameDelta)
+	{
+		OmniRecordingFormat::WriteFixed(FrameBuffer, DeltaTime);
+		LastDeltaTime = DeltaTime;
+		bHasLastDeltaTime = true;
+	}
+	OmniRecordingFormat::WriteFixed(FrameBuffer, SimTime);
+}
+
+void FOmniRecorder::RecordCommand(const int64 TickIndex, const FOmniCommandMessage& Command, const bool bExternal, const bool bDuringTick)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const uint8 Kind = static_cast<uint8>(EOmniRecordKind::Command);
+	BeginRecord(TickIndex, OmniRecorder::MakeMessageHeader(EOmniRecordKind::Command, bExternal, bDuringTick));
+	WriteNameRef(Command.SourceSystem);
+	WriteNameRef(Command.TargetSystem);
+	WriteArguments(Kind, WriteNameRef(Command.CommandName), Command.Arguments);
+}
+
+void FOmniRecorder::RecordQuery(const int64 TickIndex, const FOmniQueryMessage& Query, const bool bExternal, const bool bDuringTick)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const uint8 Kind = static_cast<uint8>(EOmniRecordKind::Query);
+	BeginRecord(TickIndex, OmniRecorder::MakeMessageHeader(EOmniRecordKind::Query, bExternal, bDuringTick));
+	WriteNameRef(Query.SourceSystem);
+	WriteNameRef(Query.TargetSystem);
+	WriteArguments(Kind, WriteNameRef(Query.QueryName), Query.Arguments);
+}
+
+void FOmniRecorder::RecordEvent(const int64 TickIndex, const FOmniEventMessage& Event, const bool bExternal, const bool bDuringTick)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const uint8 Kind = static_cast<uint8>(EOmniRecordKind::Event);
+	BeginRecord(TickIndex, OmniRecorder::MakeMessageHeader(EOmniRecordKind::Event, bExternal, bDuringTick));
+	WriteNameRef(Event.SourceSystem);
+	WriteArguments(Kind, WriteNameRef(Event.EventName), Event.Payload);
+}
+
+void FOmniRecorder::RecordStateHash(const int64 TickIndex, const FName SystemId, const uint64 Hash)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	BeginRecord(TickIndex, static_cast<uint8>(EOmniRecordKind::StateHash));
+	WriteNameRef(SystemId);
+	OmniRecordingFormat::WriteFixed(FrameBuffer, Hash);
+}
+
+int64 FOmniRecorder::GetRecordCount() const
+{
+	return RecordCount;
+}
+
+int64 FOmniRecorder::GetBytesWritten() const
+{
+	return BytesWritten;
+}
+
+int32 FOmniRecorder::GetChunkCount() const
+{
+	return ChunkIndex.Num();
+}
+
+void FOmniRecorder::BeginRecord(const int64 TickIndex, const uint8 Header)
+{
+	if (bHasOpenFrame && TickIndex != FrameTick)
+	{
+		FlushFrame();
+	}
+
+	if (!bHasOpenFrame)
+	{
+		bHasOpenFrame = true;
+		FrameTick = TickIndex;
+		FrameRecordCount = 0;
+		FrameBuffer.Reset();
+	}
+
+	FrameBuffer.Add(Header);
+	++FrameRecordCount;
+	++RecordCount;
+}
+
+uint32 FOmniRecorder::WriteNameRef(const FName Name)
+{
+	// 0 introduces a new name (inline string, next id); N > 0 references chunk name id N - 1.
+	if (const uint32* ExistingId = ChunkNameIds.Find(Name))
+	{
+		OmniRecordingFormat::WriteVarUInt(FrameBuffer, static_cast<uint64>(*ExistingId) + 1);
+		return *ExistingId;
+	}
+
+	const uint32 NewId = static_cast<uint32>(ChunkNameIds.Num());
+	ChunkNameIds.Add(Name, NewId);
+	OmniRecordingFormat::WriteVarUInt(FrameBuffer, 0);
+	OmniRecordingFormat::WriteUtf8(FrameBuffer, Name.ToString(), 0);
+	return NewId;
+}
+
+void FOmniRecorder::WriteArguments(const uint8 Kind, const uint32 MessageNameId, const TMap<FName, FString>& Arguments)
+{
+	// Values equal to the previous value of the same (kind, message, key) in this chunk are written as a single 0.
+	OmniRecordingFormat::WriteVarUInt(FrameBuffer, static_cast<uint64>(Arguments.Num()));
+	for (const TPair<FName, FString>& Argument : Arguments)
+	{
+		const uint32 KeyId = WriteNameRef(Argument.Key);
+		FString& LastValue = LastArgumentValues.FindOrAdd(OmniRecordingFormat::MakeArgumentKey(Kind, MessageNameId, KeyId));
+		if (!LastValue.IsEmpty() && LastValue == Argument.Value)
+		{
+			OmniRecordingFormat::WriteVarUInt(FrameBuffer, 0);
+			continue;
+		}
+
+		OmniRecordingFormat::WriteUtf8(FrameBuffer, Argument.Value, 1);
+		LastValue = Argument.Value;
+	}
+}
+
+void FOmniRecorder::FlushFrame()
+{
+	if (!bHasOpenFrame)
+	{
+		return;
+	}
+
+	if (ChunkFrameCount == 0)
+	{
+		ChunkFirstTick = FrameTick;
+		PreviousFrameTick = FrameTick;
+	}
+
+	OmniRecordingFormat::WriteVarInt(ChunkBuffer, FrameTick - PreviousFrameTick);
+	OmniRecordingFormat::WriteVarUInt(ChunkBuffer, static_cast<uint64>(FrameRecordCount));
+	ChunkBuffer.Append(FrameBuffer);
+	PreviousFrameTick = FrameTick;
+	ChunkLastTick = FrameTick;
+	++ChunkFrameCount;
+	bHasOpenFrame = false;
+
+	if (ChunkBuffer.Num() >= OmniRecorder::ChunkTargetBytes)
+	{
+		FlushChunk();
+	}
+}
+
+void FOmniRecorder::FlushChunk()
+{
+	if (ChunkFrameCount == 0 || !FileHandle)
+	{
+		return;
+	}
+
+	FOmniRecordingChunkInfo& Chunk = ChunkIndex.AddDefaulted_GetRef();
+	Chunk.FirstTick = ChunkFirstTick;
+	Chunk.LastTick = ChunkLastTick;
+	Chunk.Offset = FileHandle->Tell();
+	Chunk.FrameCount = ChunkFrameCount;
+
+	TArray<uint8> Header;
+	Header.Reserve(OmniRecordingFormat::ChunkHeaderSize);
+	OmniRecordingFormat::WriteFixed(Header, OmniRecordingFormat::ChunkMagic);
+	OmniRecordingFormat::WriteFixed(Header, static_cast<uint32>(ChunkBuffer.Num()));
+	OmniRecordingFormat::WriteFixed(Header, ChunkFirstTick);
+	OmniRecordingFormat::WriteFixed(Header, ChunkLastTick);
+	OmniRecordingFormat::WriteFixed(Header, static_cast<uint32>(ChunkFrameCount));
+	WriteToFile(Header);
+	WriteToFile(ChunkBuffer);
+
+	ChunkBuffer.Reset();
+	ChunkNameIds.Reset();
+	LastArgumentValues.Reset();
+	bHasLastDeltaTime = false;
+	ChunkFrameCount = 0;
+}
+
+void FOmniRecorder::WriteToFile(const TArray<uint8>& Bytes)
+{
+	if (FileHandle && Bytes.Num() > 0 && FileHandle->Write(Bytes.GetData(), Bytes.Num()))
+	{
+		BytesWritten += Bytes.Num();
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Omni recordings are written in native little-endian byte order.");
+
+// File layout (all fixed-width fields little-endian):
+//   FileHeader  : Magic u32 | Version u16 | Reserved u16 | CreatedUtcTicks i64
+//   Chunk*      : Magic u32 | PayloadSize u32 | FirstTick i64 | LastTick i64 | FrameCount u32 | Payload
+//   Index       : Magic u32 | Count u32 | { FirstTick i64 | LastTick i64 | Offset i64 | FrameCount u32 }*
+//   Footer      : IndexOffset i64 | Magic u32
+// Record bodies by kind:
+//   Tick      : [DeltaTime f32 unless SameDelta] | SimTime f64
+//   Command   : Source | Target | Name | Args       Query: same      Event: Source | Name | Args
+//   StateHash : System | Hash u64
+//   Begin     : SimTime f64 | Args (session metadata)
+// Chunk payloads are self-contained (own name table and delta state) so any chunk decodes on its own.
+// A file without index/footer (crash, still open) is recovered by scanning chunk headers.
+namespace OmniRecordingFormat
+{
+	static constexpr uint32 FileMagic = 0x43524D4F; // "OMRC"
+	static constexpr uint32 ChunkMagic = 0x4B48434F; // "OCHK"
+	static constexpr uint32 IndexMagic = 0x5844494F; // "OIDX"
+	static constexpr uint32 EndMagic = 0x444E454F; // "OEND"
+	static constexpr uint16 Version = 2;
+
+	static constexpr int64 FileHeaderSize = 16;
+	static constexpr int64 ChunkHeaderSize = 28;
+	static constexpr int64 IndexEntrySize = 28;
+	static constexpr int64 FooterSize = 12;
+
+	static constexpr uint8 KindMask = 0x07;
+	static constexpr uint8 ExternalFlag = 0x08;
+	// Tick records only: delta time equals the previous tick record in the chunk and is omitted.
+	static constexpr uint8 SameDeltaFlag = 0x10;
+	// Command/Query/Event records only: sent while the registry was ticking systems.
+	static constexpr uint8 DuringTickFlag = 0x20;
+
+	inline uint64 MakeArgumentKey(const uint8 Kind, const uint32 MessageNameId, const uint32 KeyNameId)
+	{
+		return (static_cast<uint64>(Kind) << 56) | (static_cast<uint64>(MessageNameId) << 28) | KeyNameId;
+	}
+
+	template <typename ValueType>
+	void WriteFixed(TArray<uint8>& Out, const ValueType Value)
+	{
+		const int32 Offset = Out.AddUninitialized(sizeof(ValueType));
+		FMemory::Memcpy(Out.GetData() + Offset, &Value, sizeof(ValueType));
+	}
+
+	inline void WriteVarUInt(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	inline void WriteVarInt(TArray<uint8>& Out, const int64 Value)
+	{
+		WriteVarUInt(Out, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	inline void WriteUtf8(TArray<uint8>& Out, const FString& Value, const uint64 LengthBias)
+	{
+		const FTCHARToUTF8 Utf8(*Value, Value.Len());
+		WriteVarUInt(Out, static_cast<uint64>(Utf8.Length()) + LengthBias);
+		Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	struct FByteReader
+	{
+		const uint8* Data = nullptr;
+		int64 Size = 0;
+		int64 Position = 0;
+		bool bError = false;
+
+		FByteReader(const uint8* InData, const int64 InSize)
+			: Data(InData)
+			, Size(InSize)
+		{
+		}
+
+		bool IsAtEnd() const
+		{
+			return Position >= Size;
+		}
+
+		template <typename ValueType>
+		ValueType ReadFixed()
+		{
+			ValueType Value{};
+			if (Position + static_cast<int64>(sizeof(ValueType)) > Size)
+			{
+				bError = true;
+				return Value;
+			}
+
+			FMemory::Memcpy(&Value, Data + Position, sizeof(ValueType));
+			Position += sizeof(ValueType);
+			return Value;
+		}
+
+		uint64 ReadVarUInt()
+		{
+			uint64 Value = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				if (Position >= Size)
+				{
+					bError = true;
+					return 0;
+				}
+
+				const uint8 Byte = Data[Position++];
+				Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0)
+				{
+					return Value;
+				}
+			}
+
+			bError = true;
+			return 0;
+		}
+
+		int64 ReadVarInt()
+		{
+			const uint64 Encoded = ReadVarUInt();
+			return static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+		}
+
+		FString ReadUtf8(const int64 ByteLength)
+		{
+			if (ByteLength < 0 || Position + ByteLength > Size)
+			{
+				bError = true;
+				return FString();
+			}
+
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Position), static_cast<int32>(ByteLength));
+			Position += ByteLength;
+			return FString(Converted.Length(), Converted.Get());
+		}
+	};
+}
@@ -0,0 +1,398 @@
+#include "Recording/OmniRecording.h"
+
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformFileManager.h"
+#include "Recording/OmniRecordingFormat.h"
+
+namespace OmniRecordingReader
+{
+	static bool ReadExact(IFileHandle& FileHandle, const int64 Offset, const int64 Size, TArray<uint8>& OutBytes)
+	{
+		OutBytes.SetNumUninitialized(static_cast<int32>(Size));
+		return FileHandle.Seek(Offset) && FileHandle.Read(OutBytes.GetData(), Size);
+	}
+
+	static bool ReadNameRef(OmniRecordingFormat::FByteReader& Reader, TArray<FName>& NameTable, uint32& OutId)
+	{
+		const uint64 Ref = Reader.ReadVarUInt();
+		if (Ref == 0)
+		{
+			const int64 Length = static_cast<int64>(Reader.ReadVarUInt());
+			const FString NameString = Reader.ReadUtf8(Length);
+			OutId = static_cast<uint32>(NameTable.Add(FName(*NameString)));
+			return !Reader.bError;
+		}
+
+		OutId = static_cast<uint32>(Ref - 1);
+		return !Reader.bError && NameTable.IsValidIndex(static_cast<int32>(OutId));
+	}
+
+	static bool ReadArguments(
+		OmniRecordingFormat::FByteReader& Reader,
+		TArray<FName>& NameTable,
+		TMap<uint64, FString>& LastValues,
+		const uint8 Kind,
+		const uint32 MessageNameId,
+		FOmniRecordedMessage& OutRecord
+	)
+	{
+		const uint64 Count = Reader.ReadVarUInt();
+		for (uint64 Index = 0; Index < Count && !Reader.bError; ++Index)
+		{
+			uint32 KeyId = 0;
+			if (!ReadNameRef(Reader, NameTable, KeyId))
+			{
+				return false;
+			}
+
+			FString& LastValue = LastValues.FindOrAdd(OmniRecordingFormat::MakeArgumentKey(Kind, MessageNameId, KeyId));
+			const uint64 LengthPlusOne = Reader.ReadVarUInt();
+			if (LengthPlusOne > 0)
+			{
+				LastValue = Reader.ReadUtf8(static_cast<int64>(LengthPlusOne - 1));
+			}
+			OutRecord.SetArgument(NameTable[KeyId], LastValue);
+		}
+
+		return !Reader.bError;
+	}
+}
+
+void FOmniRecordedMessage::SetArgument(const FName Key, const FString& Value)
+{
+	Arguments.Add(Key, Value);
+}
+
+bool FOmniRecordedMessage::TryGetArgument(const FName Key, FString& OutValue) const
+{
+	if (const FString* Value = Arguments.Find(Key))
+	{
+		OutValue = *Value;
+		return true;
+	}
+
+	return false;
+}
+
+FOmniCommandMessage FOmniRecordedMessage::ToCommand() const
+{
+	FOmniCommandMessage Command;
+	Command.SourceSystem = SourceSystem;
+	Command.TargetSystem = TargetSystem;
+	Command.CommandName = MessageName;
+	Command.Arguments = Arguments;
+	return Command;
+}
+
+FOmniQueryMessage FOmniRecordedMessage::ToQuery() const
+{
+	FOmniQueryMessage Query;
+	Query.SourceSystem = SourceSystem;
+	Query.TargetSystem = TargetSystem;
+	Query.QueryName = MessageName;
+	Query.Arguments = Arguments;
+	return Query;
+}
+
+FOmniEventMessage FOmniRecordedMessage::ToEvent() const
+{
+	FOmniEventMessage Event;
+	Event.SourceSystem = SourceSystem;
+	Event.EventName = MessageName;
+	Event.Payload = Arguments;
+	return Event;
+}
+
+FOmniRecordingReader::FOmniRecordingReader() = default;
+
+FOmniRecordingReader::~FOmniRecordingReader() = default;
+
+bool FOmniRecordingReader::Open(const FString& FilePath, FString& OutError)
+{
+	Close();
+
+	FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!FileHandle)
+	{
+		OutError = FString::Printf(TEXT("Could not open recording file: %s"), *FilePath);
+		return false;
+	}
+
+	FileSize = FileHandle->Size();
+	TArray<uint8> HeaderBytes;
+	if (FileSize < OmniRecordingFormat::FileHeaderSize
+		|| !OmniRecordingReader::ReadExact(*FileHandle, 0, OmniRecordingFormat::FileHeaderSize, HeaderBytes))
+	{
+		OutError = FString::Printf(TEXT("Recording file is truncated: %s"), *FilePath);
+		Close();
+		return false;
+	}
+
+	OmniRecordingFormat::FByteReader Header(HeaderBytes.GetData(), HeaderBytes.Num());
+	const uint32 Magic = Header.ReadFixed<uint32>();
+	const uint16 Version = Header.ReadFixed<uint16>();
+	if (Magic != OmniRecordingFormat::FileMagic || Version != OmniRecordingFormat::Version)
+	{
+		OutError = FString::Printf(TEXT("Not an Omni recording (or unsupported version %u): %s"), Version, *FilePath);
+		Close();
+		return false;
+	}
+
+	if (!ReadIndexFromFooter() && !RebuildIndexByScanning(OutError))
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FOmniRecordingReader::Close()
+{
+	FileHandle.Reset();
+	FileSize = 0;
+	Chunks.Reset();
+}
+
+bool FOmniRecordingReader::IsOpen() const
+{
+	return FileHandle.IsValid();
+}
+
+const TArray<FOmniRecordingChunkInfo>& FOmniRecordingReader::GetChunks() const
+{
+	return Chunks;
+}
+
+int32 FOmniRecordingReader::FindChunkForTick(const int64 TickIndex) const
+{
+	const int32 ChunkIndex = Algo::LowerBoundBy(Chunks, TickIndex, &FOmniRecordingChunkInfo::LastTick);
+	if (!Chunks.IsValidIndex(ChunkIndex) || Chunks[ChunkIndex].FirstTick > TickIndex)
+	{
+		return INDEX_NONE;
+	}
+
+	return ChunkIndex;
+}
+
+bool FOmniRecordingReader::ReadChunk(const int32 ChunkIndex, TArray<FOmniRecordedFrame>& OutFrames, FString& OutError)
+{
+	if (!FileHandle || !Chunks.IsValidIndex(ChunkIndex))
+	{
+		OutError = FString::Printf(TEXT("Invalid recording chunk %d."), ChunkIndex);
+		return false;
+	}
+
+	const FOmniRecordingChunkInfo& Chunk = Chunks[ChunkIndex];
+	TArray<uint8> HeaderBytes;
+	if (!OmniRecordingReader::ReadExact(*FileHandle, Chunk.Offset, OmniRecordingFormat::ChunkHeaderSize, HeaderBytes))
+	{
+		OutError = FString::Printf(TEXT("Could not read header of chunk %d."), ChunkIndex);
+		return false;
+	}
+
+	OmniRecordingFormat::FByteReader Header(HeaderBytes.GetData(), HeaderBytes.Num());
+	const uint32 Magic = Header.ReadFixed<uint32>();
+	const uint32 PayloadSize = Header.ReadFixed<uint32>();
+	const int64 FirstTick = Header.ReadFixed<int64>();
+	TArray<uint8> Payload;
+	if (Magic != OmniRecordingFormat::ChunkMagic
+		|| !OmniRecordingReader::ReadExact(*FileHandle, Chunk.Offset + OmniRecordingFormat::ChunkHeaderSize, PayloadSize, Payload))
+	{
+		OutError = FString::Printf(TEXT("Chunk %d is corrupt or truncated."), ChunkIndex);
+		return false;
+	}
+
+	TArray<FName> NameTable;
+	TMap<uint64, FString> LastValues;
+	float LastDeltaTime = 0.0f;
+	int64 TickIndex = FirstTick;
+
+	OmniRecordingFormat::FByteReader Reader(Payload.GetData(), Payload.Num());
+	OutFrames.Reserve(OutFrames.Num() + Chunk.FrameCount);
+	while (!Reader.IsAtEnd() && !Reader.bError)
+	{
+		FOmniRecordedFrame& Frame = OutFrames.AddDefaulted_GetRef();
+		TickIndex += Reader.ReadVarInt();
+		Frame.TickIndex = TickIndex;
+
+		const uint64 RecordCount = Reader.ReadVarUInt();
+		Frame.Records.Reserve(static_cast<int32>(RecordCount));
+		for (uint64 RecordIndex = 0; RecordIndex < RecordCount && !Reader.bError; ++RecordIndex)
+		{
+			FOmniRecordedMessage& Record = Frame.Records.AddDefaulted_GetRef();
+			const uint8 RecordHeader = Reader.ReadFixed<uint8>();
+			const uint8 Kind = RecordHeader & OmniRecordingFormat::KindMask;
+			Record.Kind = static_cast<EOmniRecordKind>(Kind);
+			Record.bExternal = (RecordHeader & OmniRecordingFormat::ExternalFlag) != 0;
+
+			if (Record.Kind == EOmniRecordKind::Tick)
+			{
+				if ((RecordHeader & OmniRecordingFormat::SameDeltaFlag) == 0)
+				{
+					LastDeltaTime = Reader.ReadFixed<float>();
+				}
+				Record.DeltaTime = LastDeltaTime;
+				Record.SimTime = Reader.ReadFixed<double>();
+				continue;
+			}
+
+			uint32 NameId = 0;
+			if (Record.Kind == EOmniRecordKind::Begin)
+			{
+				Record.SimTime = Reader.ReadFixed<double>();
+				OmniRecordingReader::ReadArguments(Reader, NameTable, LastValues, Kind, 0, Record);
+				continue;
+			}
+
+			if (Record.Kind == EOmniRecordKind::StateHash)
+			{
+				if (!OmniRecordingReader::ReadNameRef(Reader, NameTable, NameId))
+				{
+					Reader.bError = true;
+					break;
+				}
+				Record.TargetSystem = NameTable[NameId];
+				Record.StateHash = Reader.ReadFixed<uint64>();
+				continue;
+			}
+
+			if (Kind > static_cast<uint8>(EOmniRecordKind::Event))
+			{
+				Reader.bError = true;
+				break;
+			}
+
+			Record.bDuringTick = (RecordHeader & OmniRecordingFormat::DuringTickFlag) != 0;
+			bool bValid = OmniRecordingReader::ReadNameRef(Reader, NameTable, NameId);
+			Record.SourceSystem = bValid ? NameTable[NameId] : NAME_None;
+			if (bValid && Record.Kind != EOmniRecordKind::Event)
+			{
+				bValid = OmniRecordingReader::ReadNameRef(Reader, NameTable, NameId);
+				Record.TargetSystem = bValid ? NameTable[NameId] : NAME_None;
+			}
+			bValid = bValid && OmniRecordingReader::ReadNameRef(Reader, NameTable, NameId);
+			if (!bValid)
+			{
+				Reader.bError = true;
+				break;
+			}
+
+			Record.MessageName = NameTable[NameId];
+			OmniRecordingReader::ReadArguments(Reader, NameTable, LastValues, Kind, NameId, Record);
+		}
+	}
+
+	if (Reader.bError)
+	{
+		OutError = FString::Printf(TEXT("Chunk %d payload could not be decoded."), ChunkIndex);
+		return false;
+	}
+
+	return true;
+}
+
+bool FOmniRecordingReader::ReadAllFrames(TArray<FOmniRecordedFrame>& OutFrames, FString& OutError)
+{
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		if (!ReadChunk(ChunkIndex, OutFrames, OutError))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FOmniRecordingReader::ReadIndexFromFooter()
+{
+	if (FileSize < OmniRecordingFormat::FileHeaderSize + OmniRecordingFormat::FooterSize)
+	{
+		return false;
+	}
+
+	TArray<uint8> FooterBytes;
+	if (!OmniRecordingReader::ReadExact(*FileHandle, FileSize - OmniRecordingFormat::FooterSize, OmniRecordingFormat::FooterSize, FooterBytes))
+	{
+		return false;
+	}
+
+	OmniRecordingFormat::FByteReader Footer(FooterBytes.GetData(), FooterBytes.Num());
+	const int64 IndexOffset = Footer.ReadFixed<int64>();
+	if (Footer.ReadFixed<uint32>() != OmniRecordingFormat::EndMagic
+		|| IndexOffset < OmniRecordingFormat::FileHeaderSize
+		|| IndexOffset + 8 > FileSize - OmniRecordingFormat::FooterSize)
+	{
+		return false;
+	}
+
+	TArray<uint8> IndexBytes;
+	if (!OmniRecordingReader::ReadExact(*FileHandle, IndexOffset, FileSize - OmniRecordingFormat::FooterSize - IndexOffset, IndexBytes))
+	{
+		return false;
+	}
+
+	OmniRecordingFormat::FByteReader Index(IndexBytes.GetData(), IndexBytes.Num());
+	const uint32 Magic = Index.ReadFixed<uint32>();
+	const uint32 Count = Index.ReadFixed<uint32>();
+	if (Magic != OmniRecordingFormat::IndexMagic || static_cast<int64>(Count) * OmniRecordingFormat::IndexEntrySize + 8 != IndexBytes.Num())
+	{
+		return false;
+	}
+
+	Chunks.Reset(Count);
+	for (uint32 EntryIndex = 0; EntryIndex < Count; ++EntryIndex)
+	{
+		FOmniRecordingChunkInfo& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.FirstTick = Index.ReadFixed<int64>();
+		Chunk.LastTick = Index.ReadFixed<int64>();
+		Chunk.Offset = Index.ReadFixed<int64>();
+		Chunk.FrameCount = static_cast<int32>(Index.ReadFixed<uint32>());
+	}
+
+	return !Index.bError;
+}
+
+bool FOmniRecordingReader::RebuildIndexByScanning(FString& OutError)
+{
+	Chunks.Reset();
+
+	int64 Offset = OmniRecordingFormat::FileHeaderSize;
+	TArray<uint8> HeaderBytes;
+	while (Offset + OmniRecordingFormat::ChunkHeaderSize <= FileSize)
+	{
+		if (!OmniRecordingReader::ReadExact(*FileHandle, Offset, OmniRecordingFormat::ChunkHeaderSize, HeaderBytes))
+		{
+			break;
+		}
+
+		OmniRecordingFormat::FByteReader Header(HeaderBytes.GetData(), HeaderBytes.Num());
+		if (Header.ReadFixed<uint32>() != OmniRecordingFormat::ChunkMagic)
+		{
+			break;
+		}
+
+		const uint32 PayloadSize = Header.ReadFixed<uint32>();
+		if (Offset + OmniRecordingFormat::ChunkHeaderSize + PayloadSize > FileSize)
+		{
+			// Partially written tail chunk; everything before it is still usable.
+			break;
+		}
+
+		FOmniRecordingChunkInfo& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.Offset = Offset;
+		Chunk.FirstTick = Header.ReadFixed<int64>();
+		Chunk.LastTick = Header.ReadFixed<int64>();
+		Chunk.FrameCount = static_cast<int32>(Header.ReadFixed<uint32>());
+		Offset += OmniRecordingFormat::ChunkHeaderSize + PayloadSize;
+	}
+
+	if (Chunks.Num() == 0 && FileSize > OmniRecordingFormat::FileHeaderSize)
+	{
+		OutError = TEXT("Recording has no readable chunks.");
+		return false;
+	}
+
+	return true;
+}
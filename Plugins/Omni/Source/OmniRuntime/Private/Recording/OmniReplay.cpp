@@ -0,0 +1,230 @@
+#include "Recording/OmniReplay.h"
+
+#include "Manifest/OmniManifest.h"
+#include "Recording/OmniStateHash.h"
+#include "Systems/OmniClockSubsystem.h"
+#include "Systems/OmniRuntimeSystem.h"
+#include "Systems/OmniSystemRegistrySubsystem.h"
+
+namespace OmniReplay
+{
+	static const FName MetaManifest(TEXT("Manifest"));
+	static const FName MetaManifestClass(TEXT("ManifestClass"));
+}
+
+FString FOmniReplayResult::Describe() const
+{
+	if (!Error.IsEmpty())
+	{
+		return FString::Printf(TEXT("Replay failed: %s"), *Error);
+	}
+
+	if (bDiverged)
+	{
+		return FString::Printf(
+			TEXT("DIVERGED at tick %lld, system '%s' (expected %016llx, got %016llx). Ticks=%lld Messages=%lld Hashes=%lld Time=%.3fs"),
+			DivergedTick,
+			*DivergedSystem.ToString(),
+			ExpectedHash,
+			ActualHash,
+			TicksReplayed,
+			MessagesReplayed,
+			HashesCompared,
+			ElapsedSeconds
+		);
+	}
+
+	return FString::Printf(
+		TEXT("OK. Ticks=%lld Messages=%lld Hashes=%lld Time=%.3fs"),
+		TicksReplayed,
+		MessagesReplayed,
+		HashesCompared,
+		ElapsedSeconds
+	);
+}
+
+FOmniReplayHarness::FOmniReplayHarness(UOmniSystemRegistrySubsystem& InRegistry, UOmniClockSubsystem& InClock)
+	: Registry(InRegistry)
+	, Clock(InClock)
+{
+}
+
+bool FOmniReplayHarness::Run(FOmniRecordingReader& Reader, FOmniReplayResult& OutResult, UOmniManifest* ManifestOverride)
+{
+	OutResult = FOmniReplayResult();
+	const double StartSeconds = FPlatformTime::Seconds();
+	const bool bPreviousManualStepping = Clock.IsManualStepping();
+	Clock.SetManualStepping(true);
+
+	bool bStarted = false;
+	TArray<FOmniRecordedFrame> Frames;
+	for (int32 ChunkIndex = 0; ChunkIndex < Reader.GetChunks().Num() && !OutResult.bDiverged; ++ChunkIndex)
+	{
+		Frames.Reset();
+		if (!Reader.ReadChunk(ChunkIndex, Frames, OutResult.Error))
+		{
+			break;
+		}
+
+		for (const FOmniRecordedFrame& Frame : Frames)
+		{
+			const TArray<FOmniRecordedMessage>& Records = Frame.Records;
+			for (int32 RecordIndex = 0; RecordIndex < Records.Num() && !OutResult.bDiverged; ++RecordIndex)
+			{
+				const FOmniRecordedMessage& Record = Records[RecordIndex];
+				if (Record.Kind == EOmniRecordKind::Begin)
+				{
+					if (!RestartSession(Record, ManifestOverride, OutResult.Error))
+					{
+						break;
+					}
+					bStarted = true;
+					continue;
+				}
+
+				if (!bStarted)
+				{
+					OutResult.Error = TEXT("Recording has no Begin record before its first frame.");
+					break;
+				}
+
+				switch (Record.Kind)
+				{
+				case EOmniRecordKind::Tick:
+					// Input sampled inside the recorded tick was consumed before the sampling system acted;
+					// nothing samples input headless, so inject it ahead of the tick.
+					for (int32 NextIndex = RecordIndex + 1; NextIndex < Records.Num() && Records[NextIndex].Kind != EOmniRecordKind::Tick; ++NextIndex)
+					{
+						if (IsReplayedInput(Records[NextIndex]) && Records[NextIndex].bDuringTick)
+						{
+							ReplayMessage(Records[NextIndex]);
+							++OutResult.MessagesReplayed;
+						}
+					}
+					Clock.StepTo(Record.SimTime);
+					Registry.Tick(Record.DeltaTime);
+					++OutResult.TicksReplayed;
+					break;
+
+				case EOmniRecordKind::StateHash:
+					if (!MatchesStateHash(Frame.TickIndex, Record, OutResult))
+					{
+						OutResult.bDiverged = true;
+					}
+					break;
+
+				default:
+					if (IsReplayedInput(Record) && !Record.bDuringTick)
+					{
+						ReplayMessage(Record);
+						++OutResult.MessagesReplayed;
+					}
+					break;
+				}
+			}
+
+			if (OutResult.bDiverged || !OutResult.Error.IsEmpty())
+			{
+				break;
+			}
+		}
+
+		if (!OutResult.Error.IsEmpty())
+		{
+			break;
+		}
+	}
+
+	Clock.SetManualStepping(bPreviousManualStepping);
+	OutResult.ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+	return OutResult.Error.IsEmpty();
+}
+
+bool FOmniReplayHarness::RestartSession(const FOmniRecordedMessage& BeginRecord, UOmniManifest* ManifestOverride, FString& OutError)
+{
+	UOmniManifest* Manifest = ManifestOverride;
+	if (!Manifest)
+	{
+		FString ManifestPath;
+		if (BeginRecord.TryGetArgument(OmniReplay::MetaManifest, ManifestPath) && !ManifestPath.IsEmpty())
+		{
+			Manifest = LoadObject<UOmniManifest>(nullptr, *ManifestPath);
+		}
+	}
+	if (!Manifest)
+	{
+		FString ManifestClassPath;
+		UClass* ManifestClass = BeginRecord.TryGetArgument(OmniReplay::MetaManifestClass, ManifestClassPath)
+			? LoadClass<UOmniManifest>(nullptr, *ManifestClassPath)
+			: nullptr;
+		if (ManifestClass)
+		{
+			Manifest = NewObject<UOmniManifest>(&Registry, ManifestClass, NAME_None, RF_Transient);
+		}
+	}
+	if (!Manifest)
+	{
+		OutError = TEXT("Could not resolve the recorded manifest; pass one explicitly.");
+		return false;
+	}
+
+	// Systems are rebuilt on a clock already positioned at the recorded start time, as in the session.
+	Registry.ShutdownSystems();
+	Clock.ResetClock();
+	Clock.StepTo(BeginRecord.SimTime);
+	if (!Registry.InitializeFromManifest(Manifest))
+	{
+		OutError = FString::Printf(TEXT("Registry failed to initialize from manifest %s."), *GetNameSafe(Manifest));
+		return false;
+	}
+
+	return true;
+}
+
+void FOmniReplayHarness::ReplayMessage(const FOmniRecordedMessage& Record)
+{
+	switch (Record.Kind)
+	{
+	case EOmniRecordKind::Command:
+		Registry.DispatchCommand(Record.ToCommand());
+		break;
+
+	case EOmniRecordKind::Query:
+		{
+			FOmniQueryMessage Query = Record.ToQuery();
+			Registry.ExecuteQuery(Query);
+		}
+		break;
+
+	case EOmniRecordKind::Event:
+		Registry.BroadcastEvent(Record.ToEvent());
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool FOmniReplayHarness::MatchesStateHash(const int64 TickIndex, const FOmniRecordedMessage& Record, FOmniReplayResult& OutResult) const
+{
+	++OutResult.HashesCompared;
+
+	UOmniRuntimeSystem* System = Registry.GetSystemById(Record.TargetSystem);
+	const uint64 ActualHash = System ? FOmniStateHashWriter::HashSystemState(*System) : 0;
+	if (System && ActualHash == Record.StateHash)
+	{
+		return true;
+	}
+
+	OutResult.DivergedTick = TickIndex;
+	OutResult.DivergedSystem = Record.TargetSystem;
+	OutResult.ExpectedHash = Record.StateHash;
+	OutResult.ActualHash = ActualHash;
+	return false;
+}
+
+bool FOmniReplayHarness::IsReplayedInput(const FOmniRecordedMessage& Record)
+{
+	return Record.bExternal
+		&& (Record.Kind == EOmniRecordKind::Command || Record.Kind == EOmniRecordKind::Query || Record.Kind == EOmniRecordKind::Event);
+}
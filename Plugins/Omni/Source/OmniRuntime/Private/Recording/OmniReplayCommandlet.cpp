@@ -0,0 +1,241 @@
+#include "Recording/OmniReplayCommandlet.h"
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Manifest/OmniManifest.h"
+#include "Manifest/OmniOfficialManifest.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Recording/OmniReplay.h"
+#include "Systems/OmniClockSubsystem.h"
+#include "Systems/OmniSystemMessageSchemas.h"
+#include "Systems/OmniSystemRegistrySubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOmniReplay, Log, All);
+
+namespace OmniReplayCommandlet
+{
+	static const TCHAR* RecordingWildcard = TEXT("*.omnirec");
+	static const TCHAR* StatusEvaluationCVar = TEXT("omni.status.evaluation");
+	static const FName SelfCheckSourceId(TEXT("ReplaySelfCheck"));
+	static const FName MovementSystemId(TEXT("Movement"));
+	static constexpr double SelfCheckTickSeconds = 1.0 / 60.0;
+	static constexpr double SelfCheckSprintSeconds = 12.0;
+	static constexpr double SelfCheckTotalSeconds = 16.0;
+
+	static TArray<FString> CollectRecordings(const FString& RecordingPath)
+	{
+		TArray<FString> Files;
+		if (IFileManager::Get().DirectoryExists(*RecordingPath))
+		{
+			IFileManager::Get().FindFilesRecursive(Files, *RecordingPath, RecordingWildcard, true, false);
+			Files.Sort();
+		}
+		else
+		{
+			Files.Add(RecordingPath);
+		}
+
+		return Files;
+	}
+
+	static void DispatchSprintRequested(UOmniSystemRegistrySubsystem& Registry, const bool bRequested)
+	{
+		FOmniSetSprintRequestedCommandSchema CommandSchema;
+		CommandSchema.SourceSystem = SelfCheckSourceId;
+		CommandSchema.bRequested = bRequested;
+		Registry.DispatchCommand(FOmniSetSprintRequestedCommandSchema::ToMessage(CommandSchema));
+	}
+
+	// Records a scripted session whose state changes come from clock timers: sprint held through repeated
+	// exhaustion, so Movement start retries and lazy Status threshold timers fire, then released to recover.
+	static bool RecordSelfCheckSession(
+		UOmniSystemRegistrySubsystem& Registry,
+		UOmniClockSubsystem& Clock,
+		UOmniManifest* Manifest,
+		const FString& FilePath,
+		FString& OutError
+	)
+	{
+		Clock.SetManualStepping(true);
+		Clock.ResetClock();
+		if (!Registry.InitializeFromManifest(Manifest))
+		{
+			OutError = FString::Printf(TEXT("Registry failed to initialize from manifest %s."), *GetNameSafe(Manifest));
+			return false;
+		}
+		if (!Registry.GetSystemById(MovementSystemId))
+		{
+			OutError = TEXT("Self-check needs the Movement system in the manifest.");
+			return false;
+		}
+		if (!Registry.StartRecording(FilePath))
+		{
+			OutError = FString::Printf(TEXT("Could not record to %s."), *FilePath);
+			return false;
+		}
+
+		DispatchSprintRequested(Registry, true);
+		bool bSprintRequested = true;
+		const int32 TickCount = FMath::CeilToInt32(SelfCheckTotalSeconds / SelfCheckTickSeconds);
+		for (int32 TickIndex = 1; TickIndex <= TickCount; ++TickIndex)
+		{
+			const double SimTime = TickIndex * SelfCheckTickSeconds;
+			if (bSprintRequested && SimTime > SelfCheckSprintSeconds)
+			{
+				DispatchSprintRequested(Registry, false);
+				bSprintRequested = false;
+			}
+			Clock.StepTo(SimTime);
+			Registry.Tick(static_cast<float>(SelfCheckTickSeconds));
+		}
+
+		Registry.StopRecording();
+		return true;
+	}
+}
+
+UOmniReplayCommandlet::UOmniReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOmniReplayCommandlet::Main(const FString& Params)
+{
+	const bool bSelfCheck = FParse::Param(*Params, TEXT("SelfCheck"));
+	FString RecordingPath;
+	if (!FParse::Value(*Params, TEXT("Recording="), RecordingPath) && !bSelfCheck)
+	{
+		UE_LOG(
+			LogOmniReplay,
+			Error,
+			TEXT("Usage: -run=OmniReplay (-Recording=<file.omnirec|folder> | -SelfCheck [-Recording=<file.omnirec>]) [-Manifest=<object path>]")
+		);
+		return 1;
+	}
+
+	UOmniManifest* ManifestOverride = nullptr;
+	FString ManifestPath;
+	if (FParse::Value(*Params, TEXT("Manifest="), ManifestPath) && !ManifestPath.IsEmpty())
+	{
+		ManifestOverride = LoadObject<UOmniManifest>(nullptr, *ManifestPath);
+		if (!ManifestOverride)
+		{
+			UE_LOG(LogOmniReplay, Error, TEXT("Manifest not found: %s"), *ManifestPath);
+			return 1;
+		}
+	}
+
+	if (bSelfCheck && RecordingPath.IsEmpty())
+	{
+		RecordingPath = FPaths::Combine(
+			FPaths::ProjectSavedDir(),
+			TEXT("Omni/Recordings"),
+			FString::Printf(TEXT("SelfCheck_%s.omnirec"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")))
+		);
+	}
+
+	TArray<FString> Files;
+	if (!bSelfCheck)
+	{
+		Files = OmniReplayCommandlet::CollectRecordings(FPaths::ConvertRelativePathToFull(RecordingPath));
+		if (Files.Num() == 0)
+		{
+			UE_LOG(LogOmniReplay, Error, TEXT("No recordings found at %s"), *RecordingPath);
+			return 1;
+		}
+	}
+
+	// One standalone game instance is reused: each recording's Begin record rebuilds the systems and clock.
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->AddToRoot();
+	GameInstance->InitializeStandalone();
+
+	UOmniSystemRegistrySubsystem* Registry = GameInstance->GetSubsystem<UOmniSystemRegistrySubsystem>();
+	UOmniClockSubsystem* Clock = GameInstance->GetSubsystem<UOmniClockSubsystem>();
+	if (!Registry || !Clock)
+	{
+		UE_LOG(LogOmniReplay, Error, TEXT("Omni registry/clock subsystems are not available in the standalone game instance."));
+		GameInstance->Shutdown();
+		GameInstance->RemoveFromRoot();
+		return 1;
+	}
+
+	// Lazy Status evaluation is read at system initialization; it stays on for the replay's re-initialization.
+	IConsoleVariable* StatusEvaluation = IConsoleManager::Get().FindConsoleVariable(OmniReplayCommandlet::StatusEvaluationCVar);
+	const int32 PreviousStatusEvaluation = StatusEvaluation ? StatusEvaluation->GetInt() : 0;
+	if (bSelfCheck)
+	{
+		if (!ManifestOverride)
+		{
+			ManifestOverride = Registry->GetActiveManifest()
+				? Registry->GetActiveManifest()
+				: NewObject<UOmniOfficialManifest>(Registry, NAME_None, RF_Transient);
+		}
+		if (StatusEvaluation)
+		{
+			StatusEvaluation->Set(1, ECVF_SetByCode);
+		}
+
+		const FString SelfCheckFile = FPaths::ConvertRelativePathToFull(RecordingPath);
+		FString Error;
+		if (!OmniReplayCommandlet::RecordSelfCheckSession(*Registry, *Clock, ManifestOverride, SelfCheckFile, Error))
+		{
+			UE_LOG(LogOmniReplay, Error, TEXT("Self-check recording failed: %s"), *Error);
+			if (StatusEvaluation)
+			{
+				StatusEvaluation->Set(PreviousStatusEvaluation, ECVF_SetByCode);
+			}
+			GameInstance->Shutdown();
+			GameInstance->RemoveFromRoot();
+			return 1;
+		}
+		Files.Add(SelfCheckFile);
+	}
+
+	FOmniReplayHarness Harness(*Registry, *Clock);
+	int32 FailedCount = 0;
+	double TotalSeconds = 0.0;
+	int64 TotalTicks = 0;
+	for (const FString& File : Files)
+	{
+		FOmniRecordingReader Reader;
+		FOmniReplayResult Result;
+		if (!Reader.Open(File, Result.Error) || !Harness.Run(Reader, Result, ManifestOverride) || Result.bDiverged)
+		{
+			++FailedCount;
+			UE_LOG(LogOmniReplay, Error, TEXT("%s: %s"), *File, *Result.Describe());
+		}
+		else
+		{
+			UE_LOG(LogOmniReplay, Display, TEXT("%s: %s"), *File, *Result.Describe());
+		}
+
+		TotalSeconds += Result.ElapsedSeconds;
+		TotalTicks += Result.TicksReplayed;
+	}
+
+	UE_LOG(
+		LogOmniReplay,
+		Display,
+		TEXT("Replayed %d recording(s): %d failed. Ticks=%lld Time=%.3fs (%.0f ticks/s)"),
+		Files.Num(),
+		FailedCount,
+		TotalTicks,
+		TotalSeconds,
+		TotalSeconds > 0.0 ? TotalTicks / TotalSeconds : 0.0
+	);
+
+	if (bSelfCheck && StatusEvaluation)
+	{
+		StatusEvaluation->Set(PreviousStatusEvaluation, ECVF_SetByCode);
+	}
+	GameInstance->Shutdown();
+	GameInstance->RemoveFromRoot();
+	return FailedCount;
+}
@@ -0,0 +1,43 @@
+#include "Recording/OmniStateHash.h"
+
+#include "Systems/OmniRuntimeSystem.h"
+
+FOmniStateHashWriter::FOmniStateHashWriter()
+{
+	SetIsSaving(true);
+	SetIsPersistent(false);
+}
+
+void FOmniStateHashWriter::Serialize(void* Data, const int64 Num)
+{
+	Builder.Update(Data, static_cast<uint64>(Num));
+}
+
+FArchive& FOmniStateHashWriter::operator<<(FName& Value)
+{
+	FString NameString = Value.ToString();
+	return *this << NameString;
+}
+
+FArchive& FOmniStateHashWriter::operator<<(UObject*& Value)
+{
+	FString PathName = GetPathNameSafe(Value);
+	return *this << PathName;
+}
+
+FString FOmniStateHashWriter::GetArchiveName() const
+{
+	return TEXT("FOmniStateHashWriter");
+}
+
+uint64 FOmniStateHashWriter::GetHash() const
+{
+	return Builder.Finalize().Hash;
+}
+
+uint64 FOmniStateHashWriter::HashSystemState(UOmniRuntimeSystem& System)
+{
+	FOmniStateHashWriter Writer;
+	System.SaveState(Writer);
+	return Writer.GetHash();
+}
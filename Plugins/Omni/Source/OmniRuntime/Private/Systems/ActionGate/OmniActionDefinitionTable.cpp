@@ -0,0 +1,212 @@
+#include "Systems/ActionGate/OmniActionDefinitionTable.h"
+
+#include "Misc/ScopeLock.h"
+#include "Recording/OmniStateHash.h"
+
+namespace OmniActionDefinitionTable
+{
+	using FWeakTable = TWeakPtr<const FOmniActionDefinitionTable, ESPMode::ThreadSafe>;
+
+	static TMap<uint64, FWeakTable>& GetTables()
+	{
+		static TMap<uint64, FWeakTable> Tables;
+		return Tables;
+	}
+
+	static FCriticalSection& GetLock()
+	{
+		static FCriticalSection Lock;
+		return Lock;
+	}
+
+	static void HashTags(FOmniStateHashWriter& Writer, const FGameplayTagContainer& Tags)
+	{
+		int32 TagCount = Tags.Num();
+		Writer << TagCount;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			FName TagName = Tag.GetTagName();
+			Writer << TagName;
+		}
+	}
+
+	// Field order matters to the gate (first blocking tag reported, cancel order), so it is hashed as is.
+	static uint64 HashDefinitions(const TArray<FOmniActionDefinition>& Definitions)
+	{
+		FOmniStateHashWriter Writer;
+		int32 DefinitionCount = Definitions.Num();
+		Writer << DefinitionCount;
+		for (const FOmniActionDefinition& Definition : Definitions)
+		{
+			FName ActionId = Definition.ActionId;
+			bool bEnabled = Definition.bEnabled;
+			uint8 Policy = static_cast<uint8>(Definition.Policy);
+			TArray<FName> Cancels = Definition.Cancels;
+			Writer << ActionId;
+			Writer << bEnabled;
+			Writer << Policy;
+			HashTags(Writer, Definition.BlockedBy);
+			Writer << Cancels;
+			HashTags(Writer, Definition.AppliesLocks);
+		}
+		return Writer.GetHash();
+	}
+
+	static bool IsSameDefinition(const FOmniActionDefinition& Left, const FOmniActionDefinition& Right)
+	{
+		return Left.ActionId == Right.ActionId
+			&& Left.bEnabled == Right.bEnabled
+			&& Left.Policy == Right.Policy
+			&& Left.Cancels == Right.Cancels
+			&& Left.BlockedBy == Right.BlockedBy
+			&& Left.AppliesLocks == Right.AppliesLocks;
+	}
+
+	static void BuildGraph(
+		const TArray<FOmniActionDefinition>& Definitions,
+		const TMap<FName, int32>& IndexById,
+		FOmniActionGraph& OutGraph
+	)
+	{
+		TArray<FOmniActionGraphNode> Nodes;
+		Nodes.Reserve(Definitions.Num());
+		for (const FOmniActionDefinition& Definition : Definitions)
+		{
+			FOmniActionGraphNode& Node = Nodes.AddDefaulted_GetRef();
+			Node.Policy = Definition.Policy;
+			for (const FGameplayTag& BlockedByTag : Definition.BlockedBy)
+			{
+				Node.BlockedBy.Add(BlockedByTag.GetTagName());
+			}
+			for (const FName CancelId : Definition.Cancels)
+			{
+				if (const int32* CancelIndex = IndexById.Find(CancelId))
+				{
+					Node.Cancels.Add(*CancelIndex);
+				}
+			}
+			for (const FGameplayTag& LockTag : Definition.AppliesLocks)
+			{
+				if (LockTag.IsValid())
+				{
+					Node.AppliesLocks.Add(LockTag.GetTagName());
+				}
+			}
+		}
+		FOmniActionGraph::Build(Nodes, OutGraph);
+	}
+}
+
+FOmniActionDefinitionTablePtr FOmniActionDefinitionTable::FindOrCreate(
+	TArray<FOmniActionDefinition>&& Definitions,
+	const FOmniActionGraph* PrebuiltGraph
+)
+{
+	TArray<FName> InputOrder;
+	InputOrder.Reserve(Definitions.Num());
+	TMap<FName, int32> LastIndexById;
+	LastIndexById.Reserve(Definitions.Num());
+	for (int32 Index = 0; Index < Definitions.Num(); ++Index)
+	{
+		InputOrder.Add(Definitions[Index].ActionId);
+		if (Definitions[Index].ActionId != NAME_None)
+		{
+			LastIndexById.Add(Definitions[Index].ActionId, Index);
+		}
+	}
+
+	TSharedRef<FOmniActionDefinitionTable, ESPMode::ThreadSafe> Table = MakeShared<FOmniActionDefinitionTable, ESPMode::ThreadSafe>();
+	Table->Definitions.Reserve(LastIndexById.Num());
+	for (int32 Index = 0; Index < Definitions.Num(); ++Index)
+	{
+		const int32* LastIndex = LastIndexById.Find(Definitions[Index].ActionId);
+		if (LastIndex && *LastIndex == Index)
+		{
+			Table->Definitions.Add(MoveTemp(Definitions[Index]));
+		}
+	}
+	Definitions.Empty();
+	Table->Definitions.Sort(
+		[](const FOmniActionDefinition& Left, const FOmniActionDefinition& Right)
+		{
+			return Left.ActionId.LexicalLess(Right.ActionId);
+		}
+	);
+	Table->ContentHash = OmniActionDefinitionTable::HashDefinitions(Table->Definitions);
+
+	const auto FindShared = [&Table]() -> FOmniActionDefinitionTablePtr
+	{
+		const FOmniActionDefinitionTablePtr Existing = OmniActionDefinitionTable::GetTables().FindRef(Table->ContentHash).Pin();
+		if (!Existing || Existing->Definitions.Num() != Table->Definitions.Num())
+		{
+			return nullptr;
+		}
+		for (int32 Index = 0; Index < Table->Definitions.Num(); ++Index)
+		{
+			if (!OmniActionDefinitionTable::IsSameDefinition(Existing->Definitions[Index], Table->Definitions[Index]))
+			{
+				return nullptr;
+			}
+		}
+		return Existing;
+	};
+
+	{
+		FScopeLock Lock(&OmniActionDefinitionTable::GetLock());
+		if (FOmniActionDefinitionTablePtr Existing = FindShared())
+		{
+			return Existing;
+		}
+	}
+
+	Table->SortedActionIds.Reserve(Table->Definitions.Num());
+	Table->IndexById.Reserve(Table->Definitions.Num());
+	for (int32 Index = 0; Index < Table->Definitions.Num(); ++Index)
+	{
+		Table->SortedActionIds.Add(Table->Definitions[Index].ActionId);
+		Table->IndexById.Add(Table->Definitions[Index].ActionId, Index);
+	}
+
+	if (PrebuiltGraph && PrebuiltGraph->Num() == Table->Num() && InputOrder == Table->SortedActionIds)
+	{
+		Table->Graph = *PrebuiltGraph;
+	}
+	else
+	{
+		OmniActionDefinitionTable::BuildGraph(Table->Definitions, Table->IndexById, Table->Graph);
+	}
+
+	FScopeLock Lock(&OmniActionDefinitionTable::GetLock());
+	TMap<uint64, OmniActionDefinitionTable::FWeakTable>& Tables = OmniActionDefinitionTable::GetTables();
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Another instance may have interned the same content while the graph was built. A hash collision with
+	// different content keeps the existing entry and leaves this table unshared.
+	if (FOmniActionDefinitionTablePtr Existing = FindShared())
+	{
+		return Existing;
+	}
+	if (Tables.Contains(Table->ContentHash))
+	{
+		return Table;
+	}
+	Tables.Add(Table->ContentHash, Table);
+	return Table;
+}
+
+int32 FOmniActionDefinitionTable::GetSharedTableCount()
+{
+	FScopeLock Lock(&OmniActionDefinitionTable::GetLock());
+	int32 Count = 0;
+	for (const TPair<uint64, OmniActionDefinitionTable::FWeakTable>& Pair : OmniActionDefinitionTable::GetTables())
+	{
+		Count += Pair.Value.IsValid() ? 1 : 0;
+	}
+	return Count;
+}
@@ -1,10 +1,14 @@
 #include "Systems/ActionGate/OmniActionGateSystem.h"
 
-#include "Debug/OmniDebugSubsystem.h"
+#include "Debug/OmniDebugMacros.h"
+#include "Debug/OmniDiagnosticGate.h"
+#include "Debug/OmniTrace.h"
 #include "Engine/GameInstance.h"
 #include "Library/OmniActionLibrary.h"
+#include "Manifest/OmniCookedManifest.h"
 #include "Manifest/OmniManifest.h"
 #include "Profile/OmniActionProfile.h"
+#include "Systems/ActionGate/OmniCompiledActionTable.h"
 #include "Systems/OmniSystemRegistrySubsystem.h"
 #include "Systems/OmniSystemMessageSchemas.h"
 #include "HAL/IConsoleManager.h"
@@ -14,6 +18,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogOmniActionGateSystem, Log, All);
 
 namespace OmniActionGate
 {
+	static const FName TraceLoadProfile(TEXT("ActionGate.LoadProfile"));
 	static const FName CategoryName(TEXT("ActionGate"));
 	static const FName SourceName(TEXT("ActionGateSystem"));
 	static const FName SystemId(TEXT("ActionGate"));
@@ -31,10 +36,51 @@ namespace OmniActionGate
 		TEXT("ActionGate validation strict mode.\n-1=Auto (strict in non-shipping, non-strict in shipping)\n0=Non-strict (log + deny/sanitize)\n1=Strict fail-fast"),
 		ECVF_Default
 	);
+	static TAutoConsoleVariable<int32> CVarActionGateCompiled(
+		TEXT("omni.actiongate.compiled"),
+		-1,
+		TEXT("Use Forge-generated action tables compiled into the game when one matches the manifest Namespace/BuildVersion.\n-1=Auto (on in shipping, off in editor and non-shipping, where library/profile edits are not covered by InputHash)\n0=Off\n1=On"),
+		ECVF_Default
+	);
+
+	static const FName ManualStopReason(TEXT("Manual"));
+	static const FOmniDebugFormat LogInitialized(TEXT("ActionGate inicializado. Definicoes={0}"));
+	static const FOmniDebugFormat LogActionStopped(TEXT("Acao parada: {0} (Reason={1})"));
+	static const FOmniDebugFormat LogDecisionSuppressed(TEXT("DENY {0} repetido {1}x na ultima janela (suprimido)"));
+	static const FName DiagnosticUnknownAction(TEXT("UnknownAction"));
+	static const FName DiagnosticDeny(TEXT("Deny"));
+
+	static const FOmniDebugFormat& GetDecisionLogFormat(const FOmniActionGateDecision& Decision)
+	{
+		static const TArray<FOmniDebugFormat> Formats = []()
+		{
+			TArray<FOmniDebugFormat> Result;
+			const int32 ReasonCount = StaticEnum<EOmniActionGateReason>()->NumEnums() - 1;
+			for (int32 ReasonIndex = 0; ReasonIndex < ReasonCount; ++ReasonIndex)
+			{
+				const TCHAR* ReasonPattern = GetReasonTextPattern(static_cast<EOmniActionGateReason>(ReasonIndex));
+				Result.Emplace(FString::Printf(TEXT("DENY {0} (%s)"), ReasonPattern));
+				Result.Emplace(FString::Printf(TEXT("ALLOW {0} (%s)"), ReasonPattern));
+			}
+			return Result;
+		}();
+
+		return Formats[static_cast<int32>(Decision.ReasonCode) * 2 + (Decision.bAllowed ? 1 : 0)];
+	}
+
+	static uint32 HashBlockingTags(const FGameplayTagContainer& BlockingTags)
+	{
+		uint32 Hash = 0;
+		for (const FGameplayTag& BlockingTag : BlockingTags)
+		{
+			Hash = HashCombineFast(Hash, GetTypeHash(BlockingTag));
+		}
+		return Hash;
+	}
 
 	static FString DecisionToResult(const FOmniActionGateDecision& Decision)
 	{
-		return FString::Printf(TEXT("%s | %s"), Decision.bAllowed ? TEXT("ALLOW") : TEXT("DENY"), *Decision.Reason);
+		return FString::Printf(TEXT("%s | %s"), Decision.bAllowed ? TEXT("ALLOW") : TEXT("DENY"), *Decision.BuildReasonText());
 	}
 
 	static bool IsStrictValidationEnabled()
@@ -53,6 +99,21 @@ namespace OmniActionGate
 		return false;
 #else
 		return true;
+#endif
+	}
+
+	static bool IsCompiledTableEnabled()
+	{
+		const int32 CVarValue = CVarActionGateCompiled.GetValueOnGameThread();
+		if (CVarValue >= 0)
+		{
+			return CVarValue != 0;
+		}
+
+#if WITH_EDITOR || !UE_BUILD_SHIPPING
+		return false;
+#else
+		return true;
 #endif
 	}
 }
@@ -81,12 +142,10 @@ void UOmniActionGateSystem::InitializeSystem_Implementation(UObject* WorldContex
 			DebugSubsystem = GameInstance->GetSubsystem<UOmniDebugSubsystem>();
 		}
 	}
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->SetMetric(OmniActionGate::DebugMetricProfileAction, TEXT("Pending"));
-	}
+	OMNI_METRIC_STATE(DebugSubsystem, OmniActionGate::DebugMetricProfileAction, TEXT("Pending"));
+	RegisterMetrics();
 
-	DefaultDefinitions.Reset();
+	DefinitionTable.Reset();
 	ResolvedProfileName.Reset();
 	ResolvedProfileAssetPath.Reset();
 	ResolvedLibraryAssetPath.Reset();
@@ -100,16 +159,12 @@ void UOmniActionGateSystem::InitializeSystem_Implementation(UObject* WorldContex
 			*GetSystemId().ToString(),
 			*LoadError
 		);
-		if (DebugSubsystem.IsValid())
-		{
-			DebugSubsystem->SetMetric(OmniActionGate::DebugMetricProfileAction, TEXT("Failed"));
-			DebugSubsystem->LogError(OmniActionGate::CategoryName, LoadError, OmniActionGate::SourceName);
-		}
+		OMNI_METRIC_STATE(DebugSubsystem, OmniActionGate::DebugMetricProfileAction, TEXT("Failed"));
+		OMNI_DEBUG_LOG_TEXT(DebugSubsystem, EOmniDebugLevel::Error, OmniActionGate::CategoryName, OmniActionGate::SourceName, LoadError);
 		return;
 	}
 
-	RebuildDefinitionMap();
-	if (DefinitionsById.Num() == 0)
+	if (GetKnownActionCount() == 0)
 	{
 		const bool bStrictValidation = OmniActionGate::IsStrictValidationEnabled();
 		const FString EmptyDefinitionsError = FString::Printf(
@@ -127,17 +182,30 @@ void UOmniActionGateSystem::InitializeSystem_Implementation(UObject* WorldContex
 		{
 			UE_LOG(LogOmniActionGateSystem, Warning, TEXT("%s"), *EmptyDefinitionsError);
 		}
-		if (DebugSubsystem.IsValid())
+		OMNI_METRIC_STATE(
+			DebugSubsystem,
+			OmniActionGate::DebugMetricProfileAction,
+			bStrictValidation ? TEXT("Failed") : TEXT("LoadedWithWarnings")
+		);
+		if (bStrictValidation)
 		{
-			DebugSubsystem->SetMetric(OmniActionGate::DebugMetricProfileAction, bStrictValidation ? TEXT("Failed") : TEXT("LoadedWithWarnings"));
-			if (bStrictValidation)
-			{
-				DebugSubsystem->LogError(OmniActionGate::CategoryName, EmptyDefinitionsError, OmniActionGate::SourceName);
-			}
-			else
-			{
-				DebugSubsystem->LogWarning(OmniActionGate::CategoryName, EmptyDefinitionsError, OmniActionGate::SourceName);
-			}
+			OMNI_DEBUG_LOG_TEXT(
+				DebugSubsystem,
+				EOmniDebugLevel::Error,
+				OmniActionGate::CategoryName,
+				OmniActionGate::SourceName,
+				EmptyDefinitionsError
+			);
+		}
+		else
+		{
+			OMNI_DEBUG_LOG_TEXT(
+				DebugSubsystem,
+				EOmniDebugLevel::Warning,
+				OmniActionGate::CategoryName,
+				OmniActionGate::SourceName,
+				EmptyDefinitionsError
+			);
 		}
 		if (bStrictValidation)
 		{
@@ -147,15 +215,13 @@ void UOmniActionGateSystem::InitializeSystem_Implementation(UObject* WorldContex
 
 	ActiveActions.Reset();
 	ActiveLockRefCounts.Reset();
+	ActiveLockBlockCounts.Init(0, GetKnownActionCount());
 	LastDecision = FOmniActionGateDecision();
 	bInitialized = true;
 	SetInitializationResult(true);
-	if (DebugSubsystem.IsValid())
+	if (GetKnownActionCount() > 0)
 	{
-		if (DefinitionsById.Num() > 0)
-		{
-			DebugSubsystem->SetMetric(OmniActionGate::DebugMetricProfileAction, TEXT("Loaded"));
-		}
+		OMNI_METRIC_STATE(DebugSubsystem, OmniActionGate::DebugMetricProfileAction, TEXT("Loaded"));
 	}
 
 	PublishTelemetry();
@@ -164,26 +230,28 @@ void UOmniActionGateSystem::InitializeSystem_Implementation(UObject* WorldContex
 		LogOmniActionGateSystem,
 		Log,
 		TEXT("ActionGate system initialized. Definitions=%d Manifest=%s"),
-		DefinitionsById.Num(),
+		GetKnownActionCount(),
 		*GetNameSafe(Manifest)
 	);
 
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->LogEvent(
-			OmniActionGate::CategoryName,
-			FString::Printf(TEXT("ActionGate inicializado. Definicoes=%d"), DefinitionsById.Num()),
-			OmniActionGate::SourceName
-		);
-	}
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniActionGate::CategoryName,
+		OmniActionGate::SourceName,
+		OmniActionGate::LogInitialized,
+		GetKnownActionCount()
+	);
 }
 
 void UOmniActionGateSystem::ShutdownSystem_Implementation()
 {
 	bInitialized = false;
-	DefinitionsById.Reset();
+	DefinitionTable.Reset();
+	ResolvedProfileFName = NAME_None;
 	ActiveActions.Reset();
 	ActiveLockRefCounts.Reset();
+	ActiveLockBlockCounts.Reset();
 	LastDecision = FOmniActionGateDecision();
 	ResolvedProfileName.Reset();
 	ResolvedProfileAssetPath.Reset();
@@ -191,12 +259,16 @@ void UOmniActionGateSystem::ShutdownSystem_Implementation()
 
 	if (DebugSubsystem.IsValid())
 	{
-		DebugSubsystem->RemoveMetric(TEXT("ActionGate.KnownActions"));
-		DebugSubsystem->RemoveMetric(TEXT("ActionGate.ActiveActions"));
-		DebugSubsystem->RemoveMetric(TEXT("ActionGate.ActiveLocks"));
+		UnregisterMetrics();
 		DebugSubsystem->RemoveMetric(TEXT("ActionGate.LastDecision"));
 		DebugSubsystem->RemoveMetric(OmniActionGate::DebugMetricProfileAction);
-		DebugSubsystem->LogEvent(OmniActionGate::CategoryName, TEXT("ActionGate finalizado"), OmniActionGate::SourceName);
+		OMNI_DEBUG_LOG_TEXT(
+			DebugSubsystem,
+			EOmniDebugLevel::Event,
+			OmniActionGate::CategoryName,
+			OmniActionGate::SourceName,
+			TEXT("ActionGate finalizado")
+		);
 	}
 
 	DebugSubsystem.Reset();
@@ -258,7 +330,8 @@ bool UOmniActionGateSystem::HandleQuery_Implementation(FOmniQueryMessage& Query)
 		const bool bAllowed = EvaluateStartAction(ParsedSchema.ActionId, Decision, false);
 		Query.bHandled = true;
 		Query.bSuccess = bAllowed;
-		Query.Result = Decision.Reason;
+		Query.Result = Decision.BuildReasonText();
+		Query.SetOutputValue(TEXT("ReasonCode"), LexToString(Decision.ReasonCode));
 		return true;
 	}
 
@@ -303,31 +376,69 @@ bool UOmniActionGateSystem::StopAction(const FName ActionId, const FName Reason)
 		return false;
 	}
 
-	const FOmniActionDefinition* Definition = DefinitionsById.Find(ActionId);
+	const FOmniActionDefinition* Definition = FindDefinition(ActionId);
 	if (!Definition)
 	{
 		ActiveActions.Remove(ActionId);
 		PublishTelemetry();
-		BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionEnded, ActionId, FString(), Reason);
+		BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionEnded, ActionId, EOmniActionGateReason::None, FString(), Reason);
 		return true;
 	}
 
 	RemoveActionLocks(*Definition);
 	ActiveActions.Remove(ActionId);
 	PublishTelemetry();
-	BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionEnded, ActionId, FString(), Reason);
+	BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionEnded, ActionId, EOmniActionGateReason::None, FString(), Reason);
+
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniActionGate::CategoryName,
+		OmniActionGate::SourceName,
+		OmniActionGate::LogActionStopped,
+		ActionId,
+		Reason == NAME_None ? OmniActionGate::ManualStopReason : Reason
+	);
 
-	if (DebugSubsystem.IsValid())
+	return true;
+}
+
+void UOmniActionGateSystem::SaveState(FArchive& Ar)
+{
+	Ar << bInitialized;
+	Ar << ResolvedProfileFName;
+
+	TArray<FName> SortedActiveActions = GetActiveActions();
+	Ar << SortedActiveActions;
+
+	TArray<TPair<FName, int32>> SortedLocks;
+	for (const TPair<FGameplayTag, int32>& Pair : ActiveLockRefCounts)
 	{
-		const FString StopReason = Reason == NAME_None ? TEXT("Manual") : Reason.ToString();
-		DebugSubsystem->LogEvent(
-			OmniActionGate::CategoryName,
-			FString::Printf(TEXT("Acao parada: %s (Reason=%s)"), *ActionId.ToString(), *StopReason),
-			OmniActionGate::SourceName
-		);
+		SortedLocks.Emplace(Pair.Key.GetTagName(), Pair.Value);
+	}
+	SortedLocks.Sort(
+		[](const TPair<FName, int32>& Left, const TPair<FName, int32>& Right)
+		{
+			return Left.Key.LexicalLess(Right.Key);
+		}
+	);
+	for (TPair<FName, int32>& Lock : SortedLocks)
+	{
+		Ar << Lock.Key;
+		Ar << Lock.Value;
 	}
 
-	return true;
+	uint8 ReasonCode = static_cast<uint8>(LastDecision.ReasonCode);
+	Ar << LastDecision.ActionId;
+	Ar << LastDecision.bAllowed;
+	Ar << ReasonCode;
+	Ar << LastDecision.ReasonArg;
+	for (const FGameplayTag& BlockingTag : LastDecision.BlockingTags)
+	{
+		FName BlockingTagName = BlockingTag.GetTagName();
+		Ar << BlockingTagName;
+	}
+	Ar << LastDecision.CanceledActions;
 }
 
 bool UOmniActionGateSystem::IsActionActive(const FName ActionId) const
@@ -357,10 +468,17 @@ FGameplayTagContainer UOmniActionGateSystem::GetActiveLocks() const
 
 TArray<FName> UOmniActionGateSystem::GetKnownActionIds() const
 {
-	TArray<FName> Result;
-	DefinitionsById.GenerateKeyArray(Result);
-	Result.Sort(FNameLexicalLess());
-	return Result;
+	return DefinitionTable ? DefinitionTable->GetSortedActionIds() : TArray<FName>();
+}
+
+const FOmniActionDefinition* UOmniActionGateSystem::FindDefinition(const FName ActionId) const
+{
+	return DefinitionTable ? DefinitionTable->Find(ActionId) : nullptr;
+}
+
+int32 UOmniActionGateSystem::GetKnownActionCount() const
+{
+	return DefinitionTable ? DefinitionTable->Num() : 0;
 }
 
 FOmniActionGateDecision UOmniActionGateSystem::GetLastDecision() const
@@ -368,11 +486,22 @@ FOmniActionGateDecision UOmniActionGateSystem::GetLastDecision() const
 	return LastDecision;
 }
 
+FString UOmniActionGateSystem::GetDecisionReasonText(const FOmniActionGateDecision& Decision)
+{
+	return Decision.BuildReasonText();
+}
+
 bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 	const UOmniManifest* Manifest,
 	FString& OutError
 )
 {
+	FOmniTraceScope TraceScope(TEXT("Profile"), OmniActionGate::TraceLoadProfile);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(TEXT("Manifest"), GetNameSafe(Manifest));
+	}
+
 	OutError.Reset();
 	ResolvedProfileName.Reset();
 	ResolvedProfileAssetPath.Reset();
@@ -383,6 +512,32 @@ bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 		OutError = TEXT("Manifest is null.");
 		return false;
 	}
+	if (OmniActionGate::IsCompiledTableEnabled())
+	{
+		if (const FOmniCompiledActionTable* CompiledTable = FOmniCompiledActionTables::Find(Manifest->Namespace, Manifest->BuildVersion))
+		{
+			// Checked against the live manifest: a cooked file can be as stale as the table, or absent.
+			const FString LiveInputHash = Registry.IsValid() ? Registry->GetLiveInputHash() : FString();
+			if (!LiveInputHash.IsEmpty() && LiveInputHash.Equals(CompiledTable->InputHash, ESearchCase::IgnoreCase))
+			{
+				return TryLoadDefinitionsFromCompiledTable(*CompiledTable, OutError);
+			}
+
+			UE_LOG(
+				LogOmniActionGateSystem,
+				Warning,
+				TEXT("Compiled action table for %s v%d is stale (InputHash %s, live manifest %s); loading from assets."),
+				*Manifest->Namespace.ToString(),
+				Manifest->BuildVersion,
+				CompiledTable->InputHash,
+				*LiveInputHash
+			);
+		}
+	}
+	if (const FOmniCookedManifest* TrustedManifest = Registry.IsValid() ? Registry->GetTrustedCookedManifest() : nullptr)
+	{
+		return TryLoadDefinitionsFromCookedManifest(*TrustedManifest, OutError);
+	}
 	const bool bStrictValidation = OmniActionGate::IsStrictValidationEnabled();
 
 	const FName RuntimeSystemId = GetSystemId();
@@ -479,12 +634,24 @@ bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 
 	if (bLoadedFromAssetPath)
 	{
-		const FSoftObjectPath ActionLibraryPath = LoadedProfile->ActionLibrary.ToSoftObjectPath();
+		TArray<const UOmniActionProfile*> ProfileChain;
+		FString ChainError;
+		if (!LoadedProfile->TryGetProfileChain(ProfileChain, ChainError))
+		{
+			OutError = FString::Printf(
+				TEXT("%s Fix in profile asset '%s': point ParentProfile to an existing UOmniActionProfile without cycles."),
+				*ChainError,
+				ResolvedProfileAssetPath.IsEmpty() ? TEXT("<unknown>") : *ResolvedProfileAssetPath
+			);
+			return false;
+		}
+
+		const FSoftObjectPath ActionLibraryPath = LoadedProfile->GetEffectiveActionLibrary().ToSoftObjectPath();
 		ResolvedLibraryAssetPath = ActionLibraryPath.ToString();
 		if (ActionLibraryPath.IsNull())
 		{
 			OutError = FString::Printf(
-				TEXT("Profile '%s' for SystemId '%s' has null ActionLibrary. Fix in profile asset '%s': set ActionLibrary to a UOmniActionLibrary."),
+				TEXT("Profile '%s' for SystemId '%s' has null ActionLibrary. Fix in profile asset '%s': set ActionLibrary (here or on a ParentProfile) to a UOmniActionLibrary."),
 				*GetNameSafe(LoadedProfile),
 				*RuntimeSystemId.ToString(),
 				ResolvedProfileAssetPath.IsEmpty() ? TEXT("<unknown>") : *ResolvedProfileAssetPath
@@ -752,7 +919,8 @@ bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 		return false;
 	}
 
-	DefaultDefinitions = MoveTemp(LoadedDefinitions);
+	const int32 LoadedDefinitionCount = LoadedDefinitions.Num();
+	AssignDefinitions(MoveTemp(LoadedDefinitions));
 	if (bLoadedFromAssetPath)
 	{
 		UE_LOG(
@@ -760,7 +928,7 @@ bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 			Log,
 			TEXT("Action definitions loaded from profile: %s (Definitions=%d, StrictValidation=%s)"),
 			*ProfileLabel,
-			DefaultDefinitions.Num(),
+			LoadedDefinitionCount,
 			bStrictValidation ? TEXT("true") : TEXT("false")
 		);
 		if (!bStrictValidation && ValidationIssues.Num() > 0)
@@ -787,18 +955,203 @@ bool UOmniActionGateSystem::TryLoadDefinitionsFromManifest(
 	return true;
 }
 
-void UOmniActionGateSystem::RebuildDefinitionMap()
+bool UOmniActionGateSystem::TryLoadDefinitionsFromCookedManifest(const FOmniCookedManifest& CookedManifest, FString& OutError)
 {
-	DefinitionsById.Reset();
+	const FName RuntimeSystemId = GetSystemId();
+	const TConstArrayView<OmniCookedManifestFormat::FSystemRecord> CookedSystems = CookedManifest.GetSystems();
+	for (const OmniCookedManifestFormat::FProfileRecord& Profile : CookedManifest.GetProfiles())
+	{
+		if (CookedSystems.IsValidIndex(static_cast<int32>(Profile.SystemIndex))
+			&& CookedManifest.GetStringAsName(CookedSystems[Profile.SystemIndex].SystemId) == RuntimeSystemId
+			&& CookedManifest.GetStringAsName(Profile.SettingKey) == OmniActionGate::ManifestSettingActionProfileAssetPath)
+		{
+			ResolvedProfileAssetPath = CookedManifest.GetStringAsFString(Profile.ProfileAssetPath);
+			ResolvedLibraryAssetPath = CookedManifest.GetStringAsFString(Profile.LibraryAssetPath);
+			ResolvedProfileName = FSoftObjectPath(ResolvedProfileAssetPath).GetAssetName();
+			break;
+		}
+	}
+	if (ResolvedProfileAssetPath.IsEmpty())
+	{
+		OutError = FString::Printf(
+			TEXT("Cooked manifest '%s' has no action profile for SystemId '%s'. Fix: rerun Forge for this manifest."),
+			*CookedManifest.GetFilePath(),
+			*RuntimeSystemId.ToString()
+		);
+		return false;
+	}
+
+	// Forge already rejected duplicate ids, Input.* ids, invalid tags and unknown cancels for this InputHash.
+	const TConstArrayView<uint32> CookedTags = CookedManifest.GetTags();
+	TArray<FGameplayTag> Tags;
+	Tags.Reserve(CookedTags.Num());
+	for (const uint32 StringIndex : CookedTags)
+	{
+		Tags.Add(FGameplayTag::RequestGameplayTag(CookedManifest.GetStringAsName(StringIndex), false));
+	}
+
+	const TConstArrayView<OmniCookedManifestFormat::FActionRecord> CookedActions = CookedManifest.GetActions();
+	TArray<FName> ActionIds;
+	ActionIds.Reserve(CookedActions.Num());
+	for (const OmniCookedManifestFormat::FActionRecord& Action : CookedActions)
+	{
+		ActionIds.Add(CookedManifest.GetStringAsName(Action.ActionId));
+	}
+
+	TArray<FOmniActionDefinition> LoadedDefinitions;
+	LoadedDefinitions.Reserve(CookedActions.Num());
+	for (int32 ActionIndex = 0; ActionIndex < CookedActions.Num(); ++ActionIndex)
+	{
+		const OmniCookedManifestFormat::FActionRecord& Action = CookedActions[ActionIndex];
+		FOmniActionDefinition& Definition = LoadedDefinitions.AddDefaulted_GetRef();
+		Definition.ActionId = ActionIds[ActionIndex];
+		Definition.bEnabled = Action.bEnabled != 0;
+		Definition.Policy = Action.GetPolicy();
+		for (const uint32 TagIndex : CookedManifest.GetRefs(Action.BlockedBy))
+		{
+			if (Tags.IsValidIndex(static_cast<int32>(TagIndex)))
+			{
+				Definition.BlockedBy.AddTag(Tags[TagIndex]);
+			}
+		}
+		for (const uint32 CancelIndex : CookedManifest.GetRefs(Action.Cancels))
+		{
+			if (ActionIds.IsValidIndex(static_cast<int32>(CancelIndex)))
+			{
+				Definition.Cancels.Add(ActionIds[CancelIndex]);
+			}
+		}
+		for (const uint32 TagIndex : CookedManifest.GetRefs(Action.AppliesLocks))
+		{
+			if (Tags.IsValidIndex(static_cast<int32>(TagIndex)))
+			{
+				Definition.AppliesLocks.AddTag(Tags[TagIndex]);
+			}
+		}
+	}
 
-	for (const FOmniActionDefinition& Definition : DefaultDefinitions)
+	if (LoadedDefinitions.Num() == 0)
+	{
+		OutError = FString::Printf(
+			TEXT("Cooked manifest '%s' has no action definitions for SystemId '%s'. Fix: rerun Forge for this manifest."),
+			*CookedManifest.GetFilePath(),
+			*RuntimeSystemId.ToString()
+		);
+		return false;
+	}
+
+	FOmniActionGraph CookedGraph;
+	CookedGraph.Assign(CookedActions.Num(), CookedManifest.GetActionLockBlocks(), CookedManifest.GetActionCancelClosure());
+	const int32 LoadedDefinitionCount = LoadedDefinitions.Num();
+	AssignDefinitions(MoveTemp(LoadedDefinitions), &CookedGraph);
+
+	UE_LOG(
+		LogOmniActionGateSystem,
+		Log,
+		TEXT("Action definitions loaded from verified cooked manifest: %s (Definitions=%d, Profile=%s)"),
+		*CookedManifest.GetFilePath(),
+		LoadedDefinitionCount,
+		*ResolvedProfileName
+	);
+	OutError.Reset();
+	return true;
+}
+
+bool UOmniActionGateSystem::TryLoadDefinitionsFromCompiledTable(const FOmniCompiledActionTable& Table, FString& OutError)
+{
+	ResolvedProfileAssetPath = Table.ProfileAssetPath;
+	ResolvedLibraryAssetPath = Table.LibraryAssetPath;
+	ResolvedProfileName = FSoftObjectPath(ResolvedProfileAssetPath).GetAssetName();
+
+	// Generated by Forge from content that already passed validation; indices are trusted like the cooked image.
+	TArray<FGameplayTag> Tags;
+	Tags.Reserve(Table.TagCount);
+	for (const TCHAR* TagName : Table.GetTagNames())
+	{
+		Tags.Add(FGameplayTag::RequestGameplayTag(FName(TagName), false));
+	}
+
+	const TConstArrayView<FOmniCompiledActionRecord> CompiledActions = Table.GetActions();
+	TArray<FName> ActionIds;
+	ActionIds.Reserve(CompiledActions.Num());
+	for (const FOmniCompiledActionRecord& Action : CompiledActions)
+	{
+		ActionIds.Add(FName(Action.ActionId));
+	}
+
+	TArray<FOmniActionDefinition> LoadedDefinitions;
+	LoadedDefinitions.Reserve(CompiledActions.Num());
+	for (int32 ActionIndex = 0; ActionIndex < CompiledActions.Num(); ++ActionIndex)
+	{
+		const FOmniCompiledActionRecord& Action = CompiledActions[ActionIndex];
+		FOmniActionDefinition& Definition = LoadedDefinitions.AddDefaulted_GetRef();
+		Definition.ActionId = ActionIds[ActionIndex];
+		Definition.bEnabled = Action.bEnabled;
+		Definition.Policy = Action.Policy;
+		for (const uint32 TagIndex : Table.GetRefs(Action.BlockedBy))
+		{
+			if (Tags.IsValidIndex(static_cast<int32>(TagIndex)))
+			{
+				Definition.BlockedBy.AddTag(Tags[TagIndex]);
+			}
+		}
+		for (const uint32 CancelIndex : Table.GetRefs(Action.Cancels))
+		{
+			if (ActionIds.IsValidIndex(static_cast<int32>(CancelIndex)))
+			{
+				Definition.Cancels.Add(ActionIds[CancelIndex]);
+			}
+		}
+		for (const uint32 TagIndex : Table.GetRefs(Action.AppliesLocks))
+		{
+			if (Tags.IsValidIndex(static_cast<int32>(TagIndex)))
+			{
+				Definition.AppliesLocks.AddTag(Tags[TagIndex]);
+			}
+		}
+	}
+
+	if (LoadedDefinitions.Num() == 0)
+	{
+		OutError = FString::Printf(
+			TEXT("Compiled action table for %s v%d is empty. Fix: rerun Forge with code output and rebuild."),
+			Table.Namespace,
+			Table.BuildVersion
+		);
+		return false;
+	}
+
+	const int32 LoadedDefinitionCount = LoadedDefinitions.Num();
+	AssignDefinitions(MoveTemp(LoadedDefinitions));
+
+	UE_LOG(
+		LogOmniActionGateSystem,
+		Log,
+		TEXT("Action definitions loaded from compiled table: %s v%d (Definitions=%d, Profile=%s, InputHash=%s)"),
+		Table.Namespace,
+		Table.BuildVersion,
+		LoadedDefinitionCount,
+		*ResolvedProfileName,
+		Table.InputHash
+	);
+	OutError.Reset();
+	return true;
+}
+
+void UOmniActionGateSystem::AssignDefinitions(TArray<FOmniActionDefinition>&& LoadedDefinitions, const FOmniActionGraph* CookedGraph)
+{
+	TSet<FName> SeenActionIds;
+	SeenActionIds.Reserve(LoadedDefinitions.Num());
+	for (const FOmniActionDefinition& Definition : LoadedDefinitions)
 	{
 		if (Definition.ActionId == NAME_None)
 		{
 			continue;
 		}
 
-		if (DefinitionsById.Contains(Definition.ActionId))
+		bool bAlreadySeen = false;
+		SeenActionIds.Add(Definition.ActionId, &bAlreadySeen);
+		if (bAlreadySeen)
 		{
 			UE_LOG(
 				LogOmniActionGateSystem,
@@ -807,12 +1160,13 @@ void UOmniActionGateSystem::RebuildDefinitionMap()
 				*Definition.ActionId.ToString()
 			);
 		}
-
-		DefinitionsById.Add(Definition.ActionId, Definition);
 	}
+
+	DefinitionTable = FOmniActionDefinitionTable::FindOrCreate(MoveTemp(LoadedDefinitions), CookedGraph);
+	ResolvedProfileFName = ResolvedProfileName.IsEmpty() ? NAME_None : FName(*ResolvedProfileName);
 }
 
-FGameplayTagContainer UOmniActionGateSystem::BuildCurrentBlockingContext() const
+FGameplayTagContainer UOmniActionGateSystem::BuildCurrentBlockingContext(const bool bIncludeActiveLocks) const
 {
 	FGameplayTagContainer Context;
 
@@ -843,96 +1197,51 @@ FGameplayTagContainer UOmniActionGateSystem::BuildCurrentBlockingContext() const
 		}
 	}
 
-	Context.AppendTags(GetActiveLocks());
+	if (bIncludeActiveLocks)
+	{
+		Context.AppendTags(GetActiveLocks());
+	}
 	return Context;
 }
 
 bool UOmniActionGateSystem::EvaluateStartAction(const FName ActionId, FOmniActionGateDecision& OutDecision, const bool bApplyChanges)
 {
-	FOmniActionGateDecision Decision;
-	Decision.ActionId = ActionId;
+	OutDecision = FOmniActionGateDecision();
+	OutDecision.ActionId = ActionId;
 
 	if (!bInitialized || ActionId == NAME_None)
 	{
-		Decision.bAllowed = false;
-		Decision.Reason = TEXT("Sistema nao inicializado ou ActionId invalido.");
-		OutDecision = Decision;
+		OutDecision.bAllowed = false;
+		OutDecision.ReasonCode = EOmniActionGateReason::NotInitialized;
 		return false;
 	}
 
-	const FOmniActionDefinition* Definition = DefinitionsById.Find(ActionId);
+	const FOmniActionDefinition* Definition = FindDefinition(ActionId);
 	if (!Definition || !Definition->bEnabled)
 	{
-		const bool bStrictValidation = OmniActionGate::IsStrictValidationEnabled();
-		TArray<FName> KnownActionIds;
-		DefinitionsById.GenerateKeyArray(KnownActionIds);
-		KnownActionIds.Sort(FNameLexicalLess());
-		const FString KnownActionsText = KnownActionIds.Num() > 0
-			? FString::JoinBy(
-				KnownActionIds,
-				TEXT(", "),
-				[](const FName KnownId)
-				{
-					return KnownId.ToString();
-				}
-			)
-			: TEXT("<none>");
-
-		const FString ProfileLabel = ResolvedProfileName.IsEmpty() ? TEXT("<unknown>") : ResolvedProfileName;
-		const FString ProfilePathLabel = ResolvedProfileAssetPath.IsEmpty() ? TEXT("<unknown>") : ResolvedProfileAssetPath;
-		const FString LibraryPathLabel = ResolvedLibraryAssetPath.IsEmpty() ? TEXT("<unknown>") : ResolvedLibraryAssetPath;
-		const FString ActionNotFoundMessage = FString::Printf(
-			TEXT("Action '%s' was requested but is not available in ActionProfile '%s'. Fix: set manifest setting '%s' (SystemId '%s') to profile '%s' and ensure ActionLibrary '%s' defines this ActionId. KnownActions=[%s]"),
-			*ActionId.ToString(),
-			*ProfileLabel,
-			*OmniActionGate::ManifestSettingActionProfileAssetPath.ToString(),
-			*GetSystemId().ToString(),
-			*ProfilePathLabel,
-			*LibraryPathLabel,
-			*KnownActionsText
-		);
-
-		if (bStrictValidation)
-		{
-			ensureAlwaysMsgf(false, TEXT("%s"), *ActionNotFoundMessage);
-		}
-		if (bStrictValidation)
-		{
-			UE_LOG(LogOmniActionGateSystem, Error, TEXT("%s"), *ActionNotFoundMessage);
-		}
-		else
-		{
-			UE_LOG(LogOmniActionGateSystem, Warning, TEXT("%s"), *ActionNotFoundMessage);
-		}
-
-		Decision.bAllowed = false;
-		Decision.Reason = FString::Printf(
-			TEXT("Acao '%s' desconhecida/desabilitada no profile '%s'. Verifique ActionLibrary/manifest."),
-			*ActionId.ToString(),
-			*ProfileLabel
-		);
-		OutDecision = Decision;
+		ReportUnknownAction(ActionId);
+		OutDecision.bAllowed = false;
+		OutDecision.ReasonCode = EOmniActionGateReason::UnknownAction;
+		OutDecision.ReasonArg = ResolvedProfileFName;
 		return false;
 	}
 
-	Decision.Policy = Definition->Policy;
+	OutDecision.Policy = Definition->Policy;
 
 	const bool bAlreadyActive = ActiveActions.Contains(ActionId);
 	if (bAlreadyActive)
 	{
 		if (Definition->Policy == EOmniActionPolicy::DenyIfActive)
 		{
-			Decision.bAllowed = false;
-			Decision.Reason = TEXT("Acao ja ativa (policy deny).");
-			OutDecision = Decision;
+			OutDecision.bAllowed = false;
+			OutDecision.ReasonCode = EOmniActionGateReason::AlreadyActiveDenied;
 			return false;
 		}
 
 		if (Definition->Policy == EOmniActionPolicy::SucceedIfActive)
 		{
-			Decision.bAllowed = true;
-			Decision.Reason = TEXT("Acao ja ativa (policy succeed).");
-			OutDecision = Decision;
+			OutDecision.bAllowed = true;
+			OutDecision.ReasonCode = EOmniActionGateReason::AlreadyActiveSucceeded;
 			return true;
 		}
 
@@ -942,17 +1251,29 @@ bool UOmniActionGateSystem::EvaluateStartAction(const FName ActionId, FOmniActio
 			{
 				StopAction(ActionId, TEXT("RestartPolicy"));
 			}
-			Decision.Reason = TEXT("Acao reiniciada (policy restart).");
+			OutDecision.ReasonCode = EOmniActionGateReason::Restarted;
 		}
 	}
 
-	const FGameplayTagContainer BlockingContext = BuildCurrentBlockingContext();
-	if (Definition->BlockedBy.HasAny(BlockingContext))
+	if (!Definition->BlockedBy.IsEmpty())
 	{
-		Decision.bAllowed = false;
-		Decision.Reason = FString::Printf(TEXT("Bloqueada por tags: %s"), *Definition->BlockedBy.ToStringSimple());
-		OutDecision = Decision;
-		return false;
+		// A zero count means no active lock can match this action's BlockedBy, so only Status tags can block it.
+		const int32 ActionIndex = DefinitionTable->FindIndex(ActionId);
+		const bool bMayBeLockBlocked = !ActiveLockBlockCounts.IsValidIndex(ActionIndex) || ActiveLockBlockCounts[ActionIndex] > 0;
+		const FGameplayTagContainer BlockingContext = BuildCurrentBlockingContext(bMayBeLockBlocked);
+		for (const FGameplayTag& BlockedByTag : Definition->BlockedBy)
+		{
+			if (BlockedByTag.MatchesAny(BlockingContext))
+			{
+				OutDecision.BlockingTags.AddTagFast(BlockedByTag);
+			}
+		}
+		if (!OutDecision.BlockingTags.IsEmpty())
+		{
+			OutDecision.bAllowed = false;
+			OutDecision.ReasonCode = EOmniActionGateReason::BlockedByTag;
+			return false;
+		}
 	}
 
 	if (bApplyChanges)
@@ -966,7 +1287,7 @@ bool UOmniActionGateSystem::EvaluateStartAction(const FName ActionId, FOmniActio
 
 			if (StopAction(ActionToCancel, ActionId))
 			{
-				Decision.CanceledActions.Add(ActionToCancel);
+				OutDecision.CanceledActions.Add(ActionToCancel);
 			}
 		}
 
@@ -975,16 +1296,66 @@ bool UOmniActionGateSystem::EvaluateStartAction(const FName ActionId, FOmniActio
 		BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionStarted, ActionId);
 	}
 
-	Decision.bAllowed = true;
-	if (Decision.Reason.IsEmpty())
+	OutDecision.bAllowed = true;
+	if (OutDecision.ReasonCode == EOmniActionGateReason::None)
 	{
-		Decision.Reason = TEXT("Autorizada.");
+		OutDecision.ReasonCode = EOmniActionGateReason::Allowed;
 	}
 
-	OutDecision = Decision;
 	return true;
 }
 
+void UOmniActionGateSystem::ReportUnknownAction(const FName ActionId) const
+{
+	const FOmniDiagnosticDecision Diagnostic = FOmniDiagnosticGate::Get().Check(
+		OmniActionGate::CategoryName,
+		OmniActionGate::DiagnosticUnknownAction,
+		FOmniDiagnosticGate::HashArgs(GetSystemId(), ActionId, ResolvedProfileFName)
+	);
+	if (!Diagnostic.bEmit)
+	{
+		return;
+	}
+
+	const bool bStrictValidation = OmniActionGate::IsStrictValidationEnabled();
+	const TArray<FName> KnownActionIds = GetKnownActionIds();
+	const FString KnownActionsText = KnownActionIds.Num() > 0
+		? FString::JoinBy(
+			KnownActionIds,
+			TEXT(", "),
+			[](const FName KnownId)
+			{
+				return KnownId.ToString();
+			}
+		)
+		: TEXT("<none>");
+
+	const FString ProfileLabel = ResolvedProfileName.IsEmpty() ? TEXT("<unknown>") : ResolvedProfileName;
+	const FString ProfilePathLabel = ResolvedProfileAssetPath.IsEmpty() ? TEXT("<unknown>") : ResolvedProfileAssetPath;
+	const FString LibraryPathLabel = ResolvedLibraryAssetPath.IsEmpty() ? TEXT("<unknown>") : ResolvedLibraryAssetPath;
+	const FString ActionNotFoundMessage = FString::Printf(
+		TEXT("Action '%s' was requested but is not available in ActionProfile '%s'. Fix: set manifest setting '%s' (SystemId '%s') to profile '%s' and ensure ActionLibrary '%s' defines this ActionId. KnownActions=[%s]%s"),
+		*ActionId.ToString(),
+		*ProfileLabel,
+		*OmniActionGate::ManifestSettingActionProfileAssetPath.ToString(),
+		*GetSystemId().ToString(),
+		*ProfilePathLabel,
+		*LibraryPathLabel,
+		*KnownActionsText,
+		*Diagnostic.GetSuppressedSuffix()
+	);
+
+	if (bStrictValidation)
+	{
+		ensureAlwaysMsgf(false, TEXT("%s"), *ActionNotFoundMessage);
+		UE_LOG(LogOmniActionGateSystem, Error, TEXT("%s"), *ActionNotFoundMessage);
+	}
+	else
+	{
+		UE_LOG(LogOmniActionGateSystem, Warning, TEXT("%s"), *ActionNotFoundMessage);
+	}
+}
+
 bool UOmniActionGateSystem::TryParseActionId(const FOmniQueryMessage& Query, FName& OutActionId)
 {
 	FString ActionValue;
@@ -1009,6 +1380,21 @@ void UOmniActionGateSystem::AddActionLocks(const FOmniActionDefinition& Definiti
 		int32& Count = ActiveLockRefCounts.FindOrAdd(LockTag);
 		Count++;
 	}
+
+	const int32 ActionIndex = DefinitionTable ? DefinitionTable->FindIndex(Definition.ActionId) : INDEX_NONE;
+	if (ActionIndex != INDEX_NONE)
+	{
+		FOmniActionGraph::ForEachSetBit(
+			DefinitionTable->GetGraph().GetLockBlocksRow(ActionIndex),
+			[this](const int32 BlockedIndex)
+			{
+				if (ActiveLockBlockCounts.IsValidIndex(BlockedIndex))
+				{
+					++ActiveLockBlockCounts[BlockedIndex];
+				}
+			}
+		);
+	}
 }
 
 void UOmniActionGateSystem::RemoveActionLocks(const FOmniActionDefinition& Definition)
@@ -1032,11 +1418,27 @@ void UOmniActionGateSystem::RemoveActionLocks(const FOmniActionDefinition& Defin
 			ActiveLockRefCounts.Remove(LockTag);
 		}
 	}
+
+	const int32 ActionIndex = DefinitionTable ? DefinitionTable->FindIndex(Definition.ActionId) : INDEX_NONE;
+	if (ActionIndex != INDEX_NONE)
+	{
+		FOmniActionGraph::ForEachSetBit(
+			DefinitionTable->GetGraph().GetLockBlocksRow(ActionIndex),
+			[this](const int32 BlockedIndex)
+			{
+				if (ActiveLockBlockCounts.IsValidIndex(BlockedIndex))
+				{
+					ActiveLockBlockCounts[BlockedIndex] = FMath::Max(0, ActiveLockBlockCounts[BlockedIndex] - 1);
+				}
+			}
+		);
+	}
 }
 
 void UOmniActionGateSystem::BroadcastActionLifecycleEvent(
 	const FName EventName,
 	const FName ActionId,
+	const EOmniActionGateReason ReasonCode,
 	const FString& Reason,
 	const FName EndReason
 )
@@ -1054,6 +1456,10 @@ void UOmniActionGateSystem::BroadcastActionLifecycleEvent(
 	{
 		Event.SetPayloadValue(TEXT("Reason"), Reason);
 	}
+	if (ReasonCode != EOmniActionGateReason::None)
+	{
+		Event.SetPayloadValue(TEXT("ReasonCode"), LexToString(ReasonCode));
+	}
 	if (EndReason != NAME_None)
 	{
 		Event.SetPayloadValue(TEXT("EndReason"), EndReason.ToString());
@@ -1062,37 +1468,73 @@ void UOmniActionGateSystem::BroadcastActionLifecycleEvent(
 	Registry->BroadcastEvent(Event);
 }
 
-void UOmniActionGateSystem::PublishTelemetry()
+void UOmniActionGateSystem::RegisterMetrics()
+{
+	if (!DebugSubsystem.IsValid())
+	{
+		return;
+	}
+
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	KnownActionsMetric = Metrics.RegisterGauge(TEXT("ActionGate.KnownActions"), EOmniMetricValueType::Int);
+	ActiveActionsMetric = Metrics.RegisterGauge(TEXT("ActionGate.ActiveActions"), EOmniMetricValueType::Int);
+	ActiveLocksMetric = Metrics.RegisterGauge(TEXT("ActionGate.ActiveLocks"), EOmniMetricValueType::Int);
+	AllowedCountMetric = Metrics.RegisterCounter(TEXT("ActionGate.Allowed"));
+	DeniedCountMetric = Metrics.RegisterCounter(TEXT("ActionGate.Denied"));
+}
+
+void UOmniActionGateSystem::UnregisterMetrics()
 {
 	if (!DebugSubsystem.IsValid())
 	{
 		return;
 	}
 
-	DebugSubsystem->SetMetric(TEXT("ActionGate.KnownActions"), FString::FromInt(DefinitionsById.Num()));
-	DebugSubsystem->SetMetric(TEXT("ActionGate.ActiveActions"), FString::FromInt(ActiveActions.Num()));
-	DebugSubsystem->SetMetric(TEXT("ActionGate.ActiveLocks"), FString::FromInt(ActiveLockRefCounts.Num()));
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	Metrics.Unregister(KnownActionsMetric);
+	Metrics.Unregister(ActiveActionsMetric);
+	Metrics.Unregister(ActiveLocksMetric);
+	Metrics.Unregister(AllowedCountMetric);
+	Metrics.Unregister(DeniedCountMetric);
+}
+
+void UOmniActionGateSystem::PublishTelemetry()
+{
+	FOmniMetricRegistry* Metrics = OMNI_METRICS(DebugSubsystem);
+	if (!Metrics)
+	{
+		return;
+	}
+
+	Metrics->SetInt(KnownActionsMetric, GetKnownActionCount());
+	Metrics->SetInt(ActiveActionsMetric, ActiveActions.Num());
+	Metrics->SetInt(ActiveLocksMetric, ActiveLockRefCounts.Num());
 }
 
 void UOmniActionGateSystem::PublishDecision(const FOmniActionGateDecision& Decision, const bool bEmitLogEntry)
 {
+	const bool bOutcomeChanged = !Decision.IsSameOutcome(LastDecision);
 	LastDecision = Decision;
 	PublishTelemetry();
 
-	if (!DebugSubsystem.IsValid())
+	if (FOmniMetricRegistry* Metrics = OMNI_METRICS(DebugSubsystem))
 	{
-		return;
+		Metrics->Increment(Decision.bAllowed ? AllowedCountMetric : DeniedCountMetric);
+	}
+	if (bOutcomeChanged)
+	{
+		OMNI_METRIC(DebugSubsystem, TEXT("ActionGate.LastDecision"), OmniActionGate::DecisionToResult(Decision));
 	}
 
-	DebugSubsystem->SetMetric(TEXT("ActionGate.LastDecision"), OmniActionGate::DecisionToResult(Decision));
-
+	const FString ReasonText = Registry.IsValid() ? Decision.BuildReasonText() : FString();
 	if (Registry.IsValid())
 	{
 		FOmniEventMessage Event;
 		Event.SourceSystem = OmniActionGate::SystemId;
 		Event.EventName = Decision.bAllowed ? TEXT("ActionAllowed") : TEXT("ActionDenied");
 		Event.SetPayloadValue(TEXT("ActionId"), Decision.ActionId.ToString());
-		Event.SetPayloadValue(TEXT("Reason"), Decision.Reason);
+		Event.SetPayloadValue(TEXT("Reason"), ReasonText);
+		Event.SetPayloadValue(TEXT("ReasonCode"), LexToString(Decision.ReasonCode));
 		Registry->BroadcastEvent(Event);
 	}
 
@@ -1103,23 +1545,40 @@ void UOmniActionGateSystem::PublishDecision(const FOmniActionGateDecision& Decis
 
 	if (!Decision.bAllowed)
 	{
-		BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionDenied, Decision.ActionId, Decision.Reason);
-	}
+		BroadcastActionLifecycleEvent(OmniActionGate::EventOnActionDenied, Decision.ActionId, Decision.ReasonCode, ReasonText);
 
-	if (Decision.bAllowed)
-	{
-		DebugSubsystem->LogEvent(
-			OmniActionGate::CategoryName,
-			FString::Printf(TEXT("ALLOW %s (%s)"), *Decision.ActionId.ToString(), *Decision.Reason),
-			OmniActionGate::SourceName
-		);
-	}
-	else
-	{
-		DebugSubsystem->LogWarning(
+		// Denied retries repeat at the retry interval; keep one DENY per window and report the rest as a count.
+		const FOmniDiagnosticDecision Diagnostic = FOmniDiagnosticGate::Get().Check(
 			OmniActionGate::CategoryName,
-			FString::Printf(TEXT("DENY %s (%s)"), *Decision.ActionId.ToString(), *Decision.Reason),
-			OmniActionGate::SourceName
+			OmniActionGate::DiagnosticDeny,
+			FOmniDiagnosticGate::HashArgs(GetSystemId(), Decision.ActionId, static_cast<uint8>(Decision.ReasonCode), Decision.ReasonArg, OmniActionGate::HashBlockingTags(Decision.BlockingTags))
 		);
+		if (!Diagnostic.bEmit)
+		{
+			return;
+		}
+
+		if (Diagnostic.SuppressedCount > 0)
+		{
+			OMNI_DEBUG_LOG(
+				DebugSubsystem,
+				EOmniDebugLevel::Warning,
+				OmniActionGate::CategoryName,
+				OmniActionGate::SourceName,
+				OmniActionGate::LogDecisionSuppressed,
+				Decision.ActionId,
+				Diagnostic.SuppressedCount
+			);
+		}
 	}
+
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		Decision.bAllowed ? EOmniDebugLevel::Event : EOmniDebugLevel::Warning,
+		OmniActionGate::CategoryName,
+		OmniActionGate::SourceName,
+		OmniActionGate::GetDecisionLogFormat(Decision),
+		Decision.ActionId,
+		Decision.GetReasonTextArg()
+	);
 }
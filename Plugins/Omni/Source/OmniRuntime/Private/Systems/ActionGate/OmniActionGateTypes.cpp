@@ -0,0 +1,67 @@
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+
+const TCHAR* LexToString(const EOmniActionGateReason Reason)
+{
+	switch (Reason)
+	{
+	case EOmniActionGateReason::Allowed:
+		return TEXT("Allowed");
+	case EOmniActionGateReason::NotInitialized:
+		return TEXT("NotInitialized");
+	case EOmniActionGateReason::UnknownAction:
+		return TEXT("UnknownAction");
+	case EOmniActionGateReason::AlreadyActiveDenied:
+		return TEXT("AlreadyActiveDenied");
+	case EOmniActionGateReason::AlreadyActiveSucceeded:
+		return TEXT("AlreadyActiveSucceeded");
+	case EOmniActionGateReason::Restarted:
+		return TEXT("Restarted");
+	case EOmniActionGateReason::BlockedByTag:
+		return TEXT("BlockedByTag");
+	case EOmniActionGateReason::None:
+	default:
+		return TEXT("None");
+	}
+}
+
+const TCHAR* GetReasonTextPattern(const EOmniActionGateReason Reason)
+{
+	switch (Reason)
+	{
+	case EOmniActionGateReason::Allowed:
+		return TEXT("Autorizada.");
+	case EOmniActionGateReason::NotInitialized:
+		return TEXT("Sistema nao inicializado ou ActionId invalido.");
+	case EOmniActionGateReason::UnknownAction:
+		return TEXT("Acao '{0}' desconhecida/desabilitada no profile '{1}'. Verifique ActionLibrary/manifest.");
+	case EOmniActionGateReason::AlreadyActiveDenied:
+		return TEXT("Acao ja ativa (policy deny).");
+	case EOmniActionGateReason::AlreadyActiveSucceeded:
+		return TEXT("Acao ja ativa (policy succeed).");
+	case EOmniActionGateReason::Restarted:
+		return TEXT("Acao reiniciada (policy restart).");
+	case EOmniActionGateReason::BlockedByTag:
+		return TEXT("Bloqueada por tags: {1}");
+	case EOmniActionGateReason::None:
+	default:
+		return TEXT("");
+	}
+}
+
+FString FOmniActionGateDecision::BuildReasonText() const
+{
+	FStringFormatOrderedArguments Args;
+	Args.Add(ActionId.ToString());
+	Args.Add(GetReasonTextArg().ToString());
+	return FString::Format(GetReasonTextPattern(ReasonCode), Args);
+}
+
+FName FOmniActionGateDecision::GetReasonTextArg() const
+{
+	if (ReasonCode == EOmniActionGateReason::BlockedByTag && !BlockingTags.IsEmpty())
+	{
+		return BlockingTags.Num() == 1 ? BlockingTags.First().GetTagName() : FName(*BlockingTags.ToStringSimple());
+	}
+
+	return ReasonArg == NAME_None ? FName(TEXT("<unknown>")) : ReasonArg;
+}
@@ -0,0 +1,274 @@
+#include "Systems/ActionGate/OmniActionGraph.h"
+
+namespace OmniActionGraph
+{
+	struct FTarjanFrame
+	{
+		int32 Node = INDEX_NONE;
+		int32 NextEdge = 0;
+	};
+
+	static void SetBit(TArray<uint64>& Bits, const int32 WordsPerRow, const int32 Row, const int32 Column)
+	{
+		Bits[Row * WordsPerRow + Column / 64] |= uint64(1) << (Column % 64);
+	}
+
+	static void BuildLockBlocks(TConstArrayView<FOmniActionGraphNode> Nodes, const int32 WordsPerRow, TArray<uint64>& OutBits)
+	{
+		// A lock blocks every BlockedBy tag equal to it or below it in the hierarchy, so index blocked actions
+		// under each BlockedBy tag and all of its ancestors, then look locks up directly.
+		TMap<FString, TArray<int32>> BlockedActionsByTag;
+		for (int32 BlockedIndex = 0; BlockedIndex < Nodes.Num(); ++BlockedIndex)
+		{
+			for (const FName BlockedBy : Nodes[BlockedIndex].BlockedBy)
+			{
+				if (BlockedBy.IsNone())
+				{
+					continue;
+				}
+
+				FString Tag = BlockedBy.ToString();
+				while (!Tag.IsEmpty())
+				{
+					BlockedActionsByTag.FindOrAdd(Tag).Add(BlockedIndex);
+					int32 SeparatorIndex = INDEX_NONE;
+					if (!Tag.FindLastChar(TEXT('.'), SeparatorIndex))
+					{
+						break;
+					}
+					Tag.LeftInline(SeparatorIndex);
+				}
+			}
+		}
+
+		for (int32 LockerIndex = 0; LockerIndex < Nodes.Num(); ++LockerIndex)
+		{
+			for (const FName Lock : Nodes[LockerIndex].AppliesLocks)
+			{
+				if (const TArray<int32>* BlockedActions = Lock.IsNone() ? nullptr : BlockedActionsByTag.Find(Lock.ToString()))
+				{
+					for (const int32 BlockedIndex : *BlockedActions)
+					{
+						SetBit(OutBits, WordsPerRow, LockerIndex, BlockedIndex);
+					}
+				}
+			}
+		}
+	}
+
+	// Iterative Tarjan: components complete in reverse topological order, so every component reached from the
+	// current one already has its closure row when the current one is finished.
+	static void BuildCancelClosure(
+		const TArray<TArray<int32>>& Edges,
+		const int32 WordsPerRow,
+		TArray<uint64>& OutBits,
+		FOmniActionGraphIssues* OutIssues
+	)
+	{
+		const int32 NodeCount = Edges.Num();
+		TArray<int32> Order;
+		TArray<int32> LowLink;
+		TArray<int32> ComponentOf;
+		TArray<bool> OnStack;
+		Order.Init(INDEX_NONE, NodeCount);
+		LowLink.Init(0, NodeCount);
+		ComponentOf.Init(INDEX_NONE, NodeCount);
+		OnStack.Init(false, NodeCount);
+
+		TArray<int32> Stack;
+		TArray<FTarjanFrame> CallStack;
+		TArray<int32> Members;
+		TArray<uint64> Row;
+		int32 NextOrder = 0;
+		int32 ComponentCount = 0;
+
+		for (int32 Root = 0; Root < NodeCount; ++Root)
+		{
+			if (Order[Root] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			Order[Root] = LowLink[Root] = NextOrder++;
+			Stack.Add(Root);
+			OnStack[Root] = true;
+			CallStack.Add({ Root, 0 });
+
+			while (CallStack.Num() > 0)
+			{
+				const int32 Node = CallStack.Last().Node;
+				const TArray<int32>& NodeEdges = Edges[Node];
+				if (CallStack.Last().NextEdge < NodeEdges.Num())
+				{
+					const int32 Target = NodeEdges[CallStack.Last().NextEdge++];
+					if (Order[Target] == INDEX_NONE)
+					{
+						Order[Target] = LowLink[Target] = NextOrder++;
+						Stack.Add(Target);
+						OnStack[Target] = true;
+						CallStack.Add({ Target, 0 });
+					}
+					else if (OnStack[Target])
+					{
+						LowLink[Node] = FMath::Min(LowLink[Node], Order[Target]);
+					}
+					continue;
+				}
+
+				CallStack.Pop(EAllowShrinking::No);
+				if (CallStack.Num() > 0)
+				{
+					const int32 Parent = CallStack.Last().Node;
+					LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Node]);
+				}
+				if (LowLink[Node] != Order[Node])
+				{
+					continue;
+				}
+
+				Members.Reset();
+				int32 Member = INDEX_NONE;
+				do
+				{
+					Member = Stack.Pop(EAllowShrinking::No);
+					OnStack[Member] = false;
+					ComponentOf[Member] = ComponentCount;
+					Members.Add(Member);
+				}
+				while (Member != Node);
+
+				Row.Init(0, WordsPerRow);
+				bool bSelfCancel = false;
+				for (const int32 Source : Members)
+				{
+					for (const int32 Target : Edges[Source])
+					{
+						bSelfCancel |= Target == Source;
+						if (ComponentOf[Target] == ComponentCount)
+						{
+							continue;
+						}
+
+						Row[Target / 64] |= uint64(1) << (Target % 64);
+						const uint64* TargetRow = OutBits.GetData() + Target * WordsPerRow;
+						for (int32 WordIndex = 0; WordIndex < WordsPerRow; ++WordIndex)
+						{
+							Row[WordIndex] |= TargetRow[WordIndex];
+						}
+					}
+				}
+
+				const bool bCyclic = Members.Num() > 1 || bSelfCancel;
+				if (bCyclic)
+				{
+					for (const int32 Source : Members)
+					{
+						Row[Source / 64] |= uint64(1) << (Source % 64);
+					}
+				}
+				for (const int32 Source : Members)
+				{
+					FMemory::Memcpy(OutBits.GetData() + Source * WordsPerRow, Row.GetData(), WordsPerRow * sizeof(uint64));
+				}
+
+				if (OutIssues && (Members.Num() > 2 || bSelfCancel))
+				{
+					Members.Sort();
+					OutIssues->CancelCycles.Add(Members);
+				}
+				++ComponentCount;
+			}
+		}
+
+		if (OutIssues)
+		{
+			OutIssues->CancelCycles.Sort(
+				[](const TArray<int32>& Left, const TArray<int32>& Right)
+				{
+					return Left[0] < Right[0];
+				}
+			);
+		}
+	}
+}
+
+void FOmniActionGraph::Build(
+	const TConstArrayView<FOmniActionGraphNode> Nodes,
+	FOmniActionGraph& OutGraph,
+	FOmniActionGraphIssues* OutIssues
+)
+{
+	OutGraph.Reset();
+	if (OutIssues)
+	{
+		*OutIssues = FOmniActionGraphIssues();
+	}
+
+	OutGraph.ActionCount = Nodes.Num();
+	OutGraph.WordsPerRow = GetWordsPerRow(Nodes.Num());
+	OutGraph.LockBlocksBits.SetNumZeroed(OutGraph.ActionCount * OutGraph.WordsPerRow);
+	OutGraph.CancelClosureBits.SetNumZeroed(OutGraph.ActionCount * OutGraph.WordsPerRow);
+
+	OmniActionGraph::BuildLockBlocks(Nodes, OutGraph.WordsPerRow, OutGraph.LockBlocksBits);
+
+	TArray<TArray<int32>> CancelEdges;
+	CancelEdges.SetNum(Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		for (const int32 Target : Nodes[NodeIndex].Cancels)
+		{
+			if (Nodes.IsValidIndex(Target))
+			{
+				CancelEdges[NodeIndex].AddUnique(Target);
+			}
+		}
+	}
+	OmniActionGraph::BuildCancelClosure(CancelEdges, OutGraph.WordsPerRow, OutGraph.CancelClosureBits, OutIssues);
+
+	if (!OutIssues)
+	{
+		return;
+	}
+
+	TSet<int32> OnReportedCycle;
+	for (const TArray<int32>& Cycle : OutIssues->CancelCycles)
+	{
+		OnReportedCycle.Append(Cycle);
+	}
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		if (Nodes[NodeIndex].Policy == EOmniActionPolicy::RestartIfActive
+			&& (OutGraph.LockBlocks(NodeIndex, NodeIndex) || OnReportedCycle.Contains(NodeIndex)))
+		{
+			OutIssues->RestartLoops.Add(NodeIndex);
+		}
+	}
+}
+
+bool FOmniActionGraph::Assign(
+	const int32 InActionCount,
+	const TConstArrayView<uint64> InLockBlocks,
+	const TConstArrayView<uint64> InCancelClosure
+)
+{
+	Reset();
+	const int32 ExpectedWords = InActionCount * GetWordsPerRow(InActionCount);
+	if (InActionCount <= 0 || InLockBlocks.Num() != ExpectedWords || InCancelClosure.Num() != ExpectedWords)
+	{
+		return false;
+	}
+
+	ActionCount = InActionCount;
+	WordsPerRow = GetWordsPerRow(InActionCount);
+	LockBlocksBits.Append(InLockBlocks.GetData(), InLockBlocks.Num());
+	CancelClosureBits.Append(InCancelClosure.GetData(), InCancelClosure.Num());
+	return true;
+}
+
+void FOmniActionGraph::Reset()
+{
+	ActionCount = 0;
+	WordsPerRow = 0;
+	LockBlocksBits.Reset();
+	CancelClosureBits.Reset();
+}
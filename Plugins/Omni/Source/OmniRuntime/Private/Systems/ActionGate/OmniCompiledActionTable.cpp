@@ -0,0 +1,44 @@
+#include "Systems/ActionGate/OmniCompiledActionTable.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace OmniCompiledActionTables
+{
+	// Function-local so registration from other modules' static initializers never sees an unconstructed list.
+	static TArray<const FOmniCompiledActionTable*>& GetTables()
+	{
+		static TArray<const FOmniCompiledActionTable*> Tables;
+		return Tables;
+	}
+
+	static FCriticalSection& GetLock()
+	{
+		static FCriticalSection Lock;
+		return Lock;
+	}
+}
+
+void FOmniCompiledActionTables::Register(const FOmniCompiledActionTable& Table)
+{
+	FScopeLock Lock(&OmniCompiledActionTables::GetLock());
+	OmniCompiledActionTables::GetTables().AddUnique(&Table);
+}
+
+void FOmniCompiledActionTables::Unregister(const FOmniCompiledActionTable& Table)
+{
+	FScopeLock Lock(&OmniCompiledActionTables::GetLock());
+	OmniCompiledActionTables::GetTables().Remove(&Table);
+}
+
+const FOmniCompiledActionTable* FOmniCompiledActionTables::Find(const FName Namespace, const int32 BuildVersion)
+{
+	FScopeLock Lock(&OmniCompiledActionTables::GetLock());
+	for (const FOmniCompiledActionTable* Table : OmniCompiledActionTables::GetTables())
+	{
+		if (Table->BuildVersion == BuildVersion && Namespace == FName(Table->Namespace))
+		{
+			return Table;
+		}
+	}
+	return nullptr;
+}
@@ -1,6 +1,8 @@
 #include "Systems/Movement/OmniMovementSystem.h"
 
-#include "Debug/OmniDebugSubsystem.h"
+#include "Debug/OmniDebugMacros.h"
+#include "Debug/OmniDiagnosticGate.h"
+#include "Debug/OmniTrace.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -17,6 +19,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogOmniMovementSystem, Log, All);
 
 namespace OmniMovement
 {
+	static const FName TraceLoadProfile(TEXT("Movement.LoadProfile"));
 	static const FName CategoryName(TEXT("Movement"));
 	static const FName SourceName(TEXT("MovementSystem"));
 	static const FName SystemId(TEXT("Movement"));
@@ -32,6 +35,13 @@ namespace OmniMovement
 	static const FName ManifestSettingMovementProfileClassPath(TEXT("MovementProfileClassPath"));
 	static const TCHAR* DefaultMovementProfileAssetPath = TEXT("/Game/Data/Movement/DA_Omni_MovementProfile_Default.DA_Omni_MovementProfile_Default");
 	static const FName DebugMetricProfileMovement(TEXT("Omni.Profile.Movement"));
+	static const FName UnknownStopReason(TEXT("Unknown"));
+	static const FOmniDebugFormat LogSprintStarted(TEXT("Sprint iniciada"));
+	static const FOmniDebugFormat LogSprintStopped(TEXT("Sprint parada ({0})"));
+	static const FOmniDebugFormat LogAutoSprintEnded(TEXT("AutoSprint finalizado"));
+	static const FName DiagnosticSanityStartedNotSprinting(TEXT("SanityStartedNotSprinting"));
+	static const FName DiagnosticSanityEndedStillSprinting(TEXT("SanityEndedStillSprinting"));
+	static const FName DiagnosticActionDenied(TEXT("ActionDenied"));
 }
 
 FName UOmniMovementSystem::GetSystemId_Implementation() const
@@ -58,10 +68,8 @@ void UOmniMovementSystem::InitializeSystem_Implementation(UObject* WorldContextO
 			ClockSubsystem = GameInstance->GetSubsystem<UOmniClockSubsystem>();
 		}
 	}
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->SetMetric(OmniMovement::DebugMetricProfileMovement, TEXT("Pending"));
-	}
+	OMNI_METRIC_STATE(DebugSubsystem, OmniMovement::DebugMetricProfileMovement, TEXT("Pending"));
+	RegisterMetrics();
 
 	RuntimeSettings = FOmniMovementSettings();
 	const bool bDevDefaultsEnabled = Registry.IsValid() && Registry->IsDevDefaultsEnabled();
@@ -71,11 +79,8 @@ void UOmniMovementSystem::InitializeSystem_Implementation(UObject* WorldContextO
 		if (!bDevDefaultsEnabled)
 		{
 			UE_LOG(LogOmniMovementSystem, Error, TEXT("Fail-fast [SystemId=%s]: %s"), *GetSystemId().ToString(), *LoadError);
-			if (DebugSubsystem.IsValid())
-			{
-				DebugSubsystem->SetMetric(OmniMovement::DebugMetricProfileMovement, TEXT("Failed"));
-				DebugSubsystem->LogError(OmniMovement::CategoryName, LoadError, OmniMovement::SourceName);
-			}
+			OMNI_METRIC_STATE(DebugSubsystem, OmniMovement::DebugMetricProfileMovement, TEXT("Failed"));
+			OMNI_DEBUG_LOG_TEXT(DebugSubsystem, EOmniDebugLevel::Error, OmniMovement::CategoryName, OmniMovement::SourceName, LoadError);
 			return;
 		}
 
@@ -85,27 +90,27 @@ void UOmniMovementSystem::InitializeSystem_Implementation(UObject* WorldContextO
 				? TEXT("DEV defaults enabled, but Movement fallback failed to resolve settings.")
 				: FString::Printf(TEXT("%s | DEV defaults fallback also failed."), *LoadError);
 			UE_LOG(LogOmniMovementSystem, Error, TEXT("Fail-fast [SystemId=%s]: %s"), *GetSystemId().ToString(), *FallbackError);
-			if (DebugSubsystem.IsValid())
-			{
-				DebugSubsystem->SetMetric(OmniMovement::DebugMetricProfileMovement, TEXT("Failed"));
-				DebugSubsystem->LogError(OmniMovement::CategoryName, FallbackError, OmniMovement::SourceName);
-			}
+			OMNI_METRIC_STATE(DebugSubsystem, OmniMovement::DebugMetricProfileMovement, TEXT("Failed"));
+			OMNI_DEBUG_LOG_TEXT(
+				DebugSubsystem,
+				EOmniDebugLevel::Error,
+				OmniMovement::CategoryName,
+				OmniMovement::SourceName,
+				FallbackError
+			);
 			return;
 		}
 	}
 
+	ClearStartRetry();
+	ClearAutoSprint();
 	bSprintRequested = false;
 	bIsSprinting = false;
-	NextStartAttemptWorldTime = 0.0f;
-	AutoSprintRemainingSeconds = 0.0f;
 	bObservedSprintStartedEvent = false;
 	bObservedSprintEndedEvent = false;
 	PublishTelemetry();
 	SetInitializationResult(true);
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->SetMetric(OmniMovement::DebugMetricProfileMovement, TEXT("Loaded"));
-	}
+	OMNI_METRIC_STATE(DebugSubsystem, OmniMovement::DebugMetricProfileMovement, TEXT("Loaded"));
 
 	UE_LOG(LogOmniMovementSystem, Log, TEXT("Movement system initialized. Manifest=%s"), *GetNameSafe(Manifest));
 }
@@ -113,16 +118,22 @@ void UOmniMovementSystem::InitializeSystem_Implementation(UObject* WorldContextO
 void UOmniMovementSystem::ShutdownSystem_Implementation()
 {
 	StopSprinting(TEXT("Shutdown"));
+	ClearStartRetry();
+	ClearAutoSprint();
 	bObservedSprintStartedEvent = false;
 	bObservedSprintEndedEvent = false;
 
 	if (DebugSubsystem.IsValid())
 	{
-		DebugSubsystem->RemoveMetric(TEXT("Movement.SprintRequested"));
-		DebugSubsystem->RemoveMetric(TEXT("Movement.IsSprinting"));
-		DebugSubsystem->RemoveMetric(TEXT("Movement.AutoSprintRemaining"));
+		UnregisterMetrics();
 		DebugSubsystem->RemoveMetric(OmniMovement::DebugMetricProfileMovement);
-		DebugSubsystem->LogEvent(OmniMovement::CategoryName, TEXT("Movement finalizado"), OmniMovement::SourceName);
+		OMNI_DEBUG_LOG_TEXT(
+			DebugSubsystem,
+			EOmniDebugLevel::Event,
+			OmniMovement::CategoryName,
+			OmniMovement::SourceName,
+			TEXT("Movement finalizado")
+		);
 	}
 
 	DebugSubsystem.Reset();
@@ -144,8 +155,6 @@ void UOmniMovementSystem::TickSystem_Implementation(const float DeltaTime)
 		return;
 	}
 
-	const double WorldTime = GetNowSeconds();
-
 	if (RuntimeSettings.bUseKeyboardShiftAsSprintRequest)
 	{
 		if (UGameInstance* GameInstance = Registry->GetGameInstance())
@@ -155,30 +164,16 @@ void UOmniMovementSystem::TickSystem_Implementation(const float DeltaTime)
 				const bool bShiftDown = PC->IsInputKeyDown(EKeys::LeftShift) || PC->IsInputKeyDown(EKeys::RightShift);
 				if (bShiftDown != bSprintRequested)
 				{
-					SetSprintRequested(bShiftDown);
+					// Routed through the registry as input so recordings can replay it without a PlayerController.
+					FOmniSetSprintRequestedCommandSchema CommandSchema;
+					CommandSchema.SourceSystem = OmniMovement::SystemId;
+					CommandSchema.bRequested = bShiftDown;
+					Registry->DispatchInputCommand(FOmniSetSprintRequestedCommandSchema::ToMessage(CommandSchema));
 				}
 			}
 		}
 	}
 
-	if (AutoSprintRemainingSeconds > 0.0f)
-	{
-		AutoSprintRemainingSeconds = FMath::Max(0.0f, AutoSprintRemainingSeconds - DeltaTime);
-		if (AutoSprintRemainingSeconds <= KINDA_SMALL_NUMBER)
-		{
-			SetSprintRequested(false);
-			if (DebugSubsystem.IsValid())
-			{
-				DebugSubsystem->LogEvent(OmniMovement::CategoryName, TEXT("AutoSprint finalizado"), OmniMovement::SourceName);
-			}
-		}
-	}
-
-	if (bSprintRequested && !bIsSprinting && WorldTime >= NextStartAttemptWorldTime)
-	{
-		StartSprinting();
-	}
-
 	if (!bSprintRequested && bIsSprinting)
 	{
 		StopSprinting(TEXT("Released"));
@@ -192,21 +187,39 @@ void UOmniMovementSystem::TickSystem_Implementation(const float DeltaTime)
 #if !UE_BUILD_SHIPPING
 	if (bObservedSprintStartedEvent && !bIsSprinting)
 	{
-		UE_LOG(
-			LogOmniMovementSystem,
-			Warning,
-			TEXT("SanityCheck: received ActionGate OnActionStarted for '%s' but Movement state ended tick with bIsSprinting=false."),
-			*RuntimeSettings.SprintActionId.ToString()
+		const FOmniDiagnosticDecision Diagnostic = FOmniDiagnosticGate::Get().Check(
+			OmniMovement::CategoryName,
+			OmniMovement::DiagnosticSanityStartedNotSprinting,
+			GetTypeHash(RuntimeSettings.SprintActionId)
 		);
+		if (Diagnostic.bEmit)
+		{
+			UE_LOG(
+				LogOmniMovementSystem,
+				Warning,
+				TEXT("SanityCheck: received ActionGate OnActionStarted for '%s' but Movement state ended tick with bIsSprinting=false.%s"),
+				*RuntimeSettings.SprintActionId.ToString(),
+				*Diagnostic.GetSuppressedSuffix()
+			);
+		}
 	}
 	if (bObservedSprintEndedEvent && bIsSprinting)
 	{
-		UE_LOG(
-			LogOmniMovementSystem,
-			Warning,
-			TEXT("SanityCheck: received ActionGate OnActionEnded for '%s' but Movement state ended tick with bIsSprinting=true."),
-			*RuntimeSettings.SprintActionId.ToString()
+		const FOmniDiagnosticDecision Diagnostic = FOmniDiagnosticGate::Get().Check(
+			OmniMovement::CategoryName,
+			OmniMovement::DiagnosticSanityEndedStillSprinting,
+			GetTypeHash(RuntimeSettings.SprintActionId)
 		);
+		if (Diagnostic.bEmit)
+		{
+			UE_LOG(
+				LogOmniMovementSystem,
+				Warning,
+				TEXT("SanityCheck: received ActionGate OnActionEnded for '%s' but Movement state ended tick with bIsSprinting=true.%s"),
+				*RuntimeSettings.SprintActionId.ToString(),
+				*Diagnostic.GetSuppressedSuffix()
+			);
+		}
 	}
 #endif
 
@@ -215,6 +228,25 @@ void UOmniMovementSystem::TickSystem_Implementation(const float DeltaTime)
 	PublishTelemetry();
 }
 
+bool UOmniMovementSystem::HandleCommand_Implementation(const FOmniCommandMessage& Command)
+{
+	if (Command.CommandName != OmniMessageSchema::CommandSetSprintRequested)
+	{
+		return Super::HandleCommand_Implementation(Command);
+	}
+
+	FOmniSetSprintRequestedCommandSchema CommandSchema;
+	FString ParseError;
+	if (!FOmniSetSprintRequestedCommandSchema::TryFromMessage(Command, CommandSchema, ParseError))
+	{
+		UE_LOG(LogOmniMovementSystem, Warning, TEXT("Invalid SetSprintRequested command: %s"), *ParseError);
+		return false;
+	}
+
+	SetSprintRequested(CommandSchema.bRequested);
+	return true;
+}
+
 void UOmniMovementSystem::HandleEvent_Implementation(const FOmniEventMessage& Event)
 {
 	Super::HandleEvent_Implementation(Event);
@@ -295,18 +327,42 @@ void UOmniMovementSystem::HandleEvent_Implementation(const FOmniEventMessage& Ev
 
 	if (Event.EventName == OmniMovement::EventOnActionDenied)
 	{
+		const FOmniDiagnosticDecision Diagnostic = FOmniDiagnosticGate::Get().Check(
+			OmniMovement::CategoryName,
+			OmniMovement::DiagnosticActionDenied,
+			FOmniDiagnosticGate::HashArgs(ActionId, ReasonValue)
+		);
+		if (!Diagnostic.bEmit)
+		{
+			return;
+		}
+
 		UE_LOG(
 			LogOmniMovementSystem,
 			Warning,
-			TEXT("ActionGateLifecycle Event=OnActionDenied ActionId=%s Reason=%s Requested=%s IsSprinting=%s"),
+			TEXT("ActionGateLifecycle Event=OnActionDenied ActionId=%s Reason=%s Requested=%s IsSprinting=%s%s"),
 			*ActionId.ToString(),
 			ReasonValue.IsEmpty() ? TEXT("<none>") : *ReasonValue,
 			bSprintRequested ? TEXT("True") : TEXT("False"),
-			bIsSprinting ? TEXT("True") : TEXT("False")
+			bIsSprinting ? TEXT("True") : TEXT("False"),
+			*Diagnostic.GetSuppressedSuffix()
 		);
 	}
 }
 
+void UOmniMovementSystem::SaveState(FArchive& Ar)
+{
+	Ar << bSprintRequested;
+	Ar << bIsSprinting;
+	Ar << bObservedSprintStartedEvent;
+	Ar << bObservedSprintEndedEvent;
+
+	bool bStartRetryActive = StartRetryTimerHandle.IsValid();
+	bool bAutoSprintActive = AutoSprintTimerHandle.IsValid();
+	Ar << bStartRetryActive;
+	Ar << bAutoSprintActive;
+}
+
 void UOmniMovementSystem::SetSprintRequested(const bool bRequested)
 {
 	if (bSprintRequested == bRequested)
@@ -317,7 +373,13 @@ void UOmniMovementSystem::SetSprintRequested(const bool bRequested)
 	bSprintRequested = bRequested;
 	if (!bSprintRequested)
 	{
-		AutoSprintRemainingSeconds = 0.0f;
+		ClearStartRetry();
+		ClearAutoSprint();
+	}
+	else if (!bIsSprinting)
+	{
+		// Denied starts are retried by StartRetryTimerHandle only; Tick never polls the gate.
+		StartSprinting();
 	}
 
 	PublishTelemetry();
@@ -330,11 +392,22 @@ void UOmniMovementSystem::ToggleSprintRequested()
 
 void UOmniMovementSystem::StartAutoSprint(const float DurationSeconds)
 {
-	AutoSprintRemainingSeconds = FMath::Max(0.0f, DurationSeconds);
-	if (AutoSprintRemainingSeconds > 0.0f)
+	ClearAutoSprint();
+	if (DurationSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	SetSprintRequested(true);
+	if (!ClockSubsystem.IsValid())
 	{
-		SetSprintRequested(true);
+		return;
 	}
+
+	AutoSprintTimerHandle = ClockSubsystem->SetTimer(
+		DurationSeconds,
+		FOmniTimerDelegate::CreateUObject(this, &UOmniMovementSystem::HandleAutoSprintElapsed)
+	);
 }
 
 bool UOmniMovementSystem::IsSprintRequested() const
@@ -349,32 +422,34 @@ bool UOmniMovementSystem::IsSprinting() const
 
 float UOmniMovementSystem::GetAutoSprintRemainingSeconds() const
 {
-	return AutoSprintRemainingSeconds;
+	return ClockSubsystem.IsValid() ? static_cast<float>(ClockSubsystem->GetTimerRemaining(AutoSprintTimerHandle)) : 0.0f;
 }
 
 void UOmniMovementSystem::StartSprinting()
 {
-	FString DenyReason;
-	if (!QueryCanStartSprint(&DenyReason))
+	if (!QueryCanStartSprint())
 	{
-		NextStartAttemptWorldTime = GetNowSeconds() + RuntimeSettings.FailedRetryIntervalSeconds;
+		ScheduleStartRetry();
 		return;
 	}
 
 	if (!DispatchStartSprint())
 	{
-		NextStartAttemptWorldTime = GetNowSeconds() + RuntimeSettings.FailedRetryIntervalSeconds;
+		ScheduleStartRetry();
 		return;
 	}
 
 	bIsSprinting = true;
-	NextStartAttemptWorldTime = 0.0f;
+	ClearStartRetry();
 	DispatchStatusSprinting(true);
 
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->LogEvent(OmniMovement::CategoryName, TEXT("Sprint iniciada"), OmniMovement::SourceName);
-	}
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniMovement::CategoryName,
+		OmniMovement::SourceName,
+		OmniMovement::LogSprintStarted
+	);
 }
 
 void UOmniMovementSystem::StopSprinting(const FName Reason)
@@ -388,28 +463,113 @@ void UOmniMovementSystem::StopSprinting(const FName Reason)
 	DispatchStopSprint(Reason);
 	bIsSprinting = false;
 	DispatchStatusSprinting(false);
-
-	if (DebugSubsystem.IsValid())
+	if (bSprintRequested)
 	{
-		const FString ReasonText = Reason == NAME_None ? TEXT("Unknown") : Reason.ToString();
-		DebugSubsystem->LogEvent(
-			OmniMovement::CategoryName,
-			FString::Printf(TEXT("Sprint parada (%s)"), *ReasonText),
-			OmniMovement::SourceName
-		);
+		ScheduleStartRetry();
 	}
+
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniMovement::CategoryName,
+		OmniMovement::SourceName,
+		OmniMovement::LogSprintStopped,
+		Reason == NAME_None ? OmniMovement::UnknownStopReason : Reason
+	);
 }
 
 void UOmniMovementSystem::PublishTelemetry() const
+{
+	FOmniMetricRegistry* Metrics = OMNI_METRICS(DebugSubsystem);
+	if (!Metrics)
+	{
+		return;
+	}
+
+	Metrics->SetBool(SprintRequestedMetric, bSprintRequested);
+	Metrics->SetBool(IsSprintingMetric, bIsSprinting);
+	Metrics->SetFloat(AutoSprintRemainingMetric, GetAutoSprintRemainingSeconds());
+}
+
+void UOmniMovementSystem::RegisterMetrics()
+{
+	if (!DebugSubsystem.IsValid())
+	{
+		return;
+	}
+
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	SprintRequestedMetric = Metrics.RegisterGauge(TEXT("Movement.SprintRequested"), EOmniMetricValueType::Bool);
+	IsSprintingMetric = Metrics.RegisterGauge(TEXT("Movement.IsSprinting"), EOmniMetricValueType::Bool);
+	AutoSprintRemainingMetric = Metrics.RegisterGauge(TEXT("Movement.AutoSprintRemaining"), EOmniMetricValueType::Float, TEXT("s"));
+}
+
+void UOmniMovementSystem::UnregisterMetrics()
 {
 	if (!DebugSubsystem.IsValid())
 	{
 		return;
 	}
 
-	DebugSubsystem->SetMetric(TEXT("Movement.SprintRequested"), bSprintRequested ? TEXT("True") : TEXT("False"));
-	DebugSubsystem->SetMetric(TEXT("Movement.IsSprinting"), bIsSprinting ? TEXT("True") : TEXT("False"));
-	DebugSubsystem->SetMetric(TEXT("Movement.AutoSprintRemaining"), FString::Printf(TEXT("%.1fs"), AutoSprintRemainingSeconds));
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	Metrics.Unregister(SprintRequestedMetric);
+	Metrics.Unregister(IsSprintingMetric);
+	Metrics.Unregister(AutoSprintRemainingMetric);
+}
+
+void UOmniMovementSystem::ScheduleStartRetry()
+{
+	ClearStartRetry();
+	if (!ClockSubsystem.IsValid())
+	{
+		return;
+	}
+
+	StartRetryTimerHandle = ClockSubsystem->SetTimer(
+		RuntimeSettings.FailedRetryIntervalSeconds,
+		FOmniTimerDelegate::CreateUObject(this, &UOmniMovementSystem::HandleStartRetryElapsed)
+	);
+}
+
+void UOmniMovementSystem::ClearStartRetry()
+{
+	if (ClockSubsystem.IsValid())
+	{
+		ClockSubsystem->ClearTimer(StartRetryTimerHandle);
+	}
+	StartRetryTimerHandle.Invalidate();
+}
+
+void UOmniMovementSystem::ClearAutoSprint()
+{
+	if (ClockSubsystem.IsValid())
+	{
+		ClockSubsystem->ClearTimer(AutoSprintTimerHandle);
+	}
+	AutoSprintTimerHandle.Invalidate();
+}
+
+void UOmniMovementSystem::HandleStartRetryElapsed()
+{
+	StartRetryTimerHandle.Invalidate();
+	if (bSprintRequested && !bIsSprinting)
+	{
+		StartSprinting();
+		PublishTelemetry();
+	}
+}
+
+void UOmniMovementSystem::HandleAutoSprintElapsed()
+{
+	AutoSprintTimerHandle.Invalidate();
+	SetSprintRequested(false);
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniMovement::CategoryName,
+		OmniMovement::SourceName,
+		OmniMovement::LogAutoSprintEnded
+	);
 }
 
 bool UOmniMovementSystem::TryLoadSettingsFromManifest(
@@ -418,6 +578,12 @@ bool UOmniMovementSystem::TryLoadSettingsFromManifest(
 	FString& OutError
 )
 {
+	FOmniTraceScope TraceScope(TEXT("Profile"), OmniMovement::TraceLoadProfile);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(TEXT("Manifest"), GetNameSafe(Manifest));
+	}
+
 	OutError.Reset();
 
 	if (!Manifest)
@@ -659,19 +825,6 @@ bool UOmniMovementSystem::BuildDevFallbackSettings()
 	return true;
 }
 
-double UOmniMovementSystem::GetNowSeconds() const
-{
-	if (ClockSubsystem.IsValid())
-	{
-		return ClockSubsystem->GetSimTime();
-	}
-	if (Registry.IsValid() && Registry->GetWorld())
-	{
-		return Registry->GetWorld()->GetTimeSeconds();
-	}
-	return 0.0;
-}
-
 bool UOmniMovementSystem::QueryStatusIsExhausted() const
 {
 	if (!Registry.IsValid())
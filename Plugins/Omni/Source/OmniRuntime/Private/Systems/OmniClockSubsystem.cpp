@@ -10,23 +10,19 @@ void UOmniClockSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UOmniClockSubsystem::Deinitialize()
 {
+	TimerWheel.Reset(0.0);
 	Super::Deinitialize();
 }
 
 void UOmniClockSubsystem::Tick(const float DeltaTime)
 {
-	TickIndex++;
-
-	if (bUseWorldTimeProvider)
+	if (bManualStepping)
 	{
-		if (const UWorld* World = GetWorld())
-		{
-			SimTimeSeconds = World->GetTimeSeconds();
-			return;
-		}
+		return;
 	}
 
-	SimTimeSeconds += FMath::Max(0.0f, DeltaTime);
+	const UWorld* World = bUseWorldTimeProvider ? GetWorld() : nullptr;
+	StepTo(World ? World->GetTimeSeconds() : SimTimeSeconds + FMath::Max(0.0f, DeltaTime));
 }
 
 TStatId UOmniClockSubsystem::GetStatId() const
@@ -58,4 +54,54 @@ void UOmniClockSubsystem::ResetClock()
 {
 	SimTimeSeconds = 0.0;
 	TickIndex = 0;
+	TimerWheel.Rebase(SimTimeSeconds);
+}
+
+void UOmniClockSubsystem::SetManualStepping(const bool bEnabled)
+{
+	bManualStepping = bEnabled;
+}
+
+bool UOmniClockSubsystem::IsManualStepping() const
+{
+	return bManualStepping;
+}
+
+void UOmniClockSubsystem::StepTo(const double NewSimTimeSeconds)
+{
+	TickIndex++;
+	SimTimeSeconds = NewSimTimeSeconds;
+	++TimerDispatchDepth;
+	TimerWheel.Advance(SimTimeSeconds);
+	--TimerDispatchDepth;
+}
+
+bool UOmniClockSubsystem::IsDispatchingTimers() const
+{
+	return TimerDispatchDepth > 0;
+}
+
+FOmniTimerHandle UOmniClockSubsystem::SetTimer(const double DelaySeconds, FOmniTimerDelegate Callback)
+{
+	return TimerWheel.Schedule(SimTimeSeconds, DelaySeconds, MoveTemp(Callback));
+}
+
+bool UOmniClockSubsystem::ClearTimer(FOmniTimerHandle& Handle)
+{
+	return TimerWheel.Cancel(Handle);
+}
+
+bool UOmniClockSubsystem::IsTimerActive(const FOmniTimerHandle& Handle) const
+{
+	return TimerWheel.IsActive(Handle);
+}
+
+double UOmniClockSubsystem::GetTimerRemaining(const FOmniTimerHandle& Handle) const
+{
+	return TimerWheel.GetRemainingSeconds(Handle, SimTimeSeconds);
+}
+
+int32 UOmniClockSubsystem::GetActiveTimerCount() const
+{
+	return TimerWheel.Num();
 }
@@ -1,8 +1,14 @@
 #include "Systems/OmniSystemRegistrySubsystem.h"
 
-#include "Debug/OmniDebugSubsystem.h"
+#include "Debug/OmniDebugMacros.h"
+#include "Debug/OmniTrace.h"
 #include "Engine/GameInstance.h"
 #include "Manifest/OmniManifest.h"
+#include "Manifest/OmniManifestHash.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Recording/OmniStateHash.h"
+#include "Systems/OmniClockSubsystem.h"
 #include "Systems/OmniRuntimeSystem.h"
 #include "Systems/OmniSystemMessageSchemas.h"
 #include "HAL/IConsoleManager.h"
@@ -17,17 +23,37 @@ namespace OmniRegistry
 		TEXT("Enable Omni DEV defaults fallback.\n0 = OFF (fail-fast)\n1 = ON (fallback allowed)"),
 		ECVF_Default
 	);
+
+	static TAutoConsoleVariable<int32> CVarOmniCookedManifest(
+		TEXT("omni.registry.cooked"),
+		1,
+		TEXT("Map the Forge cooked manifest and use its pre-sorted initialization order when it matches.\n0 = OFF\n1 = ON"),
+		ECVF_Default
+	);
+
+	static const TCHAR* RecordingsFolder = TEXT("Omni/Recordings");
+	static const TCHAR* RecordingExtension = TEXT(".omnirec");
+	static const FName RecordingMetaManifest(TEXT("Manifest"));
+	static const FName RecordingMetaManifestClass(TEXT("ManifestClass"));
+	static const FName RecordingMetaClockTick(TEXT("ClockTick"));
+	static const FName TraceRegistryTick(TEXT("Registry.Tick"));
+	static const FName TraceArgSource(TEXT("Source"));
+	static const FName TraceArgTarget(TEXT("Target"));
+	static const FName TraceArgListeners(TEXT("Listeners"));
 }
 
 void UOmniSystemRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	// Initializing the clock first also registers its tickable first, so it advances before systems tick.
+	ClockSubsystem = Collection.InitializeDependency<UOmniClockSubsystem>();
 	PublishRegistryDiagnostics(false);
 	if (UOmniDebugSubsystem* DebugSubsystem = TryGetDebugSubsystem())
 	{
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Action"), TEXT("Pending"));
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Status"), TEXT("Pending"));
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Movement"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Action"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Status"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Movement"), TEXT("Pending"));
+		TickTimeMetric = DebugSubsystem->GetMetricRegistry().RegisterLatencyHistogram(TEXT("Omni.Registry.TickMs"));
 	}
 
 	if (TryInitializeFromAutoManifest())
@@ -45,21 +71,56 @@ void UOmniSystemRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collecti
 
 void UOmniSystemRegistrySubsystem::Deinitialize()
 {
+	StopRecording();
 	ShutdownSystemsInternal(false);
+	if (UOmniDebugSubsystem* DebugSubsystem = TryGetDebugSubsystem())
+	{
+		DebugSubsystem->GetMetricRegistry().Unregister(TickTimeMetric);
+	}
 	Super::Deinitialize();
 }
 
 void UOmniSystemRegistrySubsystem::Tick(float DeltaTime)
 {
-	for (UOmniRuntimeSystem* System : ActiveSystems)
+#if OMNI_WITH_DEBUG_LOG
+	const double TickStartSeconds = FPlatformTime::Seconds();
+#endif
+	if (Recorder)
+	{
+		Recorder->RecordTick(++RecordingTickIndex, DeltaTime, ClockSubsystem.IsValid() ? ClockSubsystem->GetSimTime() : 0.0);
+	}
+
+	FOmniTraceScope TickTraceScope(TEXT("Tick"), OmniRegistry::TraceRegistryTick);
+	++MessageDepth;
+	bTickInProgress = true;
+	for (int32 SystemIndex = 0; SystemIndex < ActiveSystems.Num(); ++SystemIndex)
 	{
+		UOmniRuntimeSystem* System = ActiveSystems[SystemIndex];
 		if (!System || !System->IsTickEnabled())
 		{
 			continue;
 		}
 
+		FOmniTraceScope SystemTraceScope(TEXT("Tick"), ActiveSystemIds[SystemIndex]);
 		System->TickSystem(DeltaTime);
 	}
+	bTickInProgress = false;
+	--MessageDepth;
+
+	if (Recorder)
+	{
+		RecordStateHashes();
+	}
+
+#if OMNI_WITH_DEBUG_LOG
+	if (TickTimeMetric.IsValid())
+	{
+		if (FOmniMetricRegistry* Metrics = OMNI_METRICS(TryGetDebugSubsystem()))
+		{
+			Metrics->Observe(TickTimeMetric, (FPlatformTime::Seconds() - TickStartSeconds) * 1000.0);
+		}
+	}
+#endif
 }
 
 TStatId UOmniSystemRegistrySubsystem::GetStatId() const
@@ -83,9 +144,9 @@ bool UOmniSystemRegistrySubsystem::InitializeFromManifest(UOmniManifest* Manifes
 	PublishRegistryDiagnostics(false);
 	if (UOmniDebugSubsystem* DebugSubsystem = TryGetDebugSubsystem())
 	{
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Action"), TEXT("Pending"));
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Status"), TEXT("Pending"));
-		DebugSubsystem->SetMetric(TEXT("Omni.Profile.Movement"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Action"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Status"), TEXT("Pending"));
+		OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.Profile.Movement"), TEXT("Pending"));
 	}
 
 	if (!Manifest)
@@ -100,8 +161,14 @@ bool UOmniSystemRegistrySubsystem::InitializeFromManifest(UOmniManifest* Manifes
 		return false;
 	}
 
+	if (!FOmniManifestHash::ComputeInputHash(*Manifest, LiveInputHash))
+	{
+		UE_LOG(LogOmniRegistry, Warning, TEXT("Could not compute InputHash for manifest '%s'; cooked data is not trusted."), *GetNameSafe(Manifest));
+	}
+
 	TArray<FName> InitializationOrder;
-	if (!BuildInitializationOrder(Specs, InitializationOrder))
+	if (!TryGetCookedInitializationOrder(Manifest, Specs, InitializationOrder)
+		&& !BuildInitializationOrder(Specs, InitializationOrder))
 	{
 		return false;
 	}
@@ -139,6 +206,7 @@ bool UOmniSystemRegistrySubsystem::InitializeFromManifest(UOmniManifest* Manifes
 		}
 
 		ActiveSystems.Add(System);
+		ActiveSystemIds.Add(SystemId);
 		SystemsById.Add(SystemId, System);
 	}
 
@@ -197,9 +265,16 @@ bool UOmniSystemRegistrySubsystem::DispatchCommand(const FOmniCommandMessage& Co
 		return false;
 	}
 
+	if (Recorder)
+	{
+		Recorder->RecordCommand(RecordingTickIndex, Command, IsExternalMessage(), bTickInProgress);
+	}
+
+	FOmniMessageStats::FEntry* Stats = MessageStats.FindOrAdd(EOmniMessageKind::Command, Command.TargetSystem, Command.CommandName);
 	FString ValidationError;
 	if (!FOmniMessageSchemaValidator::ValidateCommand(Command, ValidationError))
 	{
+		FOmniMessageStats::RecordReject(Stats);
 		UE_LOG(
 			LogOmniRegistry,
 			Warning,
@@ -215,6 +290,7 @@ bool UOmniSystemRegistrySubsystem::DispatchCommand(const FOmniCommandMessage& Co
 	UOmniRuntimeSystem* TargetSystem = GetSystemById(Command.TargetSystem);
 	if (!TargetSystem)
 	{
+		FOmniMessageStats::RecordReject(Stats);
 		UE_LOG(LogOmniRegistry, Warning, TEXT("DispatchCommand: target system not found: %s"), *Command.TargetSystem.ToString());
 		return false;
 	}
@@ -228,7 +304,20 @@ bool UOmniSystemRegistrySubsystem::DispatchCommand(const FOmniCommandMessage& Co
 		*Command.CommandName.ToString()
 	);
 
-	return TargetSystem->HandleCommand(Command);
+	FOmniTraceScope TraceScope(TEXT("Command"), Command.CommandName);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(OmniRegistry::TraceArgSource, Command.SourceSystem.ToString());
+		TraceScope.AddArg(OmniRegistry::TraceArgTarget, Command.TargetSystem.ToString());
+		TraceScope.AddArgs(Command.Arguments);
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	++MessageDepth;
+	const bool bHandled = TargetSystem->HandleCommand(Command);
+	--MessageDepth;
+	MessageStats.RecordCall(Stats, FPlatformTime::Cycles64() - StartCycles, bHandled);
+	return bHandled;
 }
 
 bool UOmniSystemRegistrySubsystem::ExecuteQuery(FOmniQueryMessage& Query)
@@ -240,9 +329,16 @@ bool UOmniSystemRegistrySubsystem::ExecuteQuery(FOmniQueryMessage& Query)
 		return false;
 	}
 
+	if (Recorder)
+	{
+		Recorder->RecordQuery(RecordingTickIndex, Query, IsExternalMessage(), bTickInProgress);
+	}
+
+	FOmniMessageStats::FEntry* Stats = MessageStats.FindOrAdd(EOmniMessageKind::Query, Query.TargetSystem, Query.QueryName);
 	FString ValidationError;
 	if (!FOmniMessageSchemaValidator::ValidateQuery(Query, ValidationError))
 	{
+		FOmniMessageStats::RecordReject(Stats);
 		UE_LOG(
 			LogOmniRegistry,
 			Warning,
@@ -258,6 +354,7 @@ bool UOmniSystemRegistrySubsystem::ExecuteQuery(FOmniQueryMessage& Query)
 	UOmniRuntimeSystem* TargetSystem = GetSystemById(Query.TargetSystem);
 	if (!TargetSystem)
 	{
+		FOmniMessageStats::RecordReject(Stats);
 		UE_LOG(LogOmniRegistry, Warning, TEXT("ExecuteQuery: target system not found: %s"), *Query.TargetSystem.ToString());
 		return false;
 	}
@@ -271,7 +368,19 @@ bool UOmniSystemRegistrySubsystem::ExecuteQuery(FOmniQueryMessage& Query)
 		*Query.QueryName.ToString()
 	);
 
+	FOmniTraceScope TraceScope(TEXT("Query"), Query.QueryName);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(OmniRegistry::TraceArgSource, Query.SourceSystem.ToString());
+		TraceScope.AddArg(OmniRegistry::TraceArgTarget, Query.TargetSystem.ToString());
+		TraceScope.AddArgs(Query.Arguments);
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	++MessageDepth;
 	const bool bHandled = TargetSystem->HandleQuery(Query);
+	--MessageDepth;
+	MessageStats.RecordCall(Stats, FPlatformTime::Cycles64() - StartCycles, bHandled);
 	Query.bHandled = Query.bHandled || bHandled;
 	return bHandled;
 }
@@ -283,9 +392,15 @@ void UOmniSystemRegistrySubsystem::BroadcastEvent(const FOmniEventMessage& Event
 		return;
 	}
 
+	if (Recorder)
+	{
+		Recorder->RecordEvent(RecordingTickIndex, Event, IsExternalMessage(), bTickInProgress);
+	}
+
 	FString ValidationError;
 	if (!FOmniMessageSchemaValidator::ValidateEvent(Event, ValidationError))
 	{
+		FOmniMessageStats::RecordReject(MessageStats.FindOrAdd(EOmniMessageKind::Event, NAME_None, Event.EventName));
 		UE_LOG(
 			LogOmniRegistry,
 			Warning,
@@ -306,15 +421,78 @@ void UOmniSystemRegistrySubsystem::BroadcastEvent(const FOmniEventMessage& Event
 		ActiveSystems.Num()
 	);
 
-	for (UOmniRuntimeSystem* System : ActiveSystems)
+	FOmniTraceScope TraceScope(TEXT("Event"), Event.EventName);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(OmniRegistry::TraceArgSource, Event.SourceSystem.ToString());
+		TraceScope.AddArg(OmniRegistry::TraceArgListeners, LexToString(ActiveSystems.Num()));
+		TraceScope.AddArgs(Event.Payload);
+	}
+
+	++MessageDepth;
+	for (int32 SystemIndex = 0; SystemIndex < ActiveSystems.Num(); ++SystemIndex)
 	{
+		UOmniRuntimeSystem* System = ActiveSystems[SystemIndex];
 		if (!System)
 		{
 			continue;
 		}
 
+		// Events have no per-handler result, so fan-out entries only accumulate calls and time.
+		FOmniTraceScope HandlerTraceScope(TEXT("EventHandler"), ActiveSystemIds[SystemIndex]);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
 		System->HandleEvent(Event);
+		MessageStats.RecordCall(
+			MessageStats.FindOrAdd(EOmniMessageKind::Event, ActiveSystemIds[SystemIndex], Event.EventName),
+			FPlatformTime::Cycles64() - StartCycles,
+			true
+		);
 	}
+	--MessageDepth;
+}
+
+FOmniMessageStats& UOmniSystemRegistrySubsystem::GetMessageStats()
+{
+	return MessageStats;
+}
+
+const FOmniCookedManifest* UOmniSystemRegistrySubsystem::GetCookedManifest() const
+{
+	return CookedManifest.IsOpen() ? &CookedManifest : nullptr;
+}
+
+const FOmniCookedManifest* UOmniSystemRegistrySubsystem::GetTrustedCookedManifest() const
+{
+	return bCookedManifestTrusted && CookedManifest.IsOpen() ? &CookedManifest : nullptr;
+}
+
+const FString& UOmniSystemRegistrySubsystem::GetLiveInputHash() const
+{
+	return LiveInputHash;
+}
+
+void UOmniSystemRegistrySubsystem::SetCookedManifestSource(const FString& FilePath, const bool bTrust)
+{
+	CookedManifestFile = FilePath;
+	bTrustVerifiedCookedManifest = bTrust;
+}
+
+bool UOmniSystemRegistrySubsystem::DispatchInputCommand(const FOmniCommandMessage& Command)
+{
+	TGuardValue<int32> DepthGuard(MessageDepth, 0);
+	TGuardValue<bool> InputGuard(bDispatchingInput, true);
+	return DispatchCommand(Command);
+}
+
+bool UOmniSystemRegistrySubsystem::IsExternalMessage() const
+{
+	if (MessageDepth > 0)
+	{
+		return false;
+	}
+
+	// Clock timers fire again when a replay steps the clock, so whatever their callbacks send is internal.
+	return bDispatchingInput || !(ClockSubsystem.IsValid() && ClockSubsystem->IsDispatchingTimers());
 }
 
 bool UOmniSystemRegistrySubsystem::IsDevDefaultsEnabled() const
@@ -323,6 +501,72 @@ bool UOmniSystemRegistrySubsystem::IsDevDefaultsEnabled() const
 	return bAllowDevDefaults || CVarValue > 0;
 }
 
+bool UOmniSystemRegistrySubsystem::StartRecording(const FString& FilePath)
+{
+	StopRecording();
+
+	const FString ResolvedPath = FilePath.IsEmpty()
+		? FPaths::Combine(
+			FPaths::ProjectSavedDir(),
+			OmniRegistry::RecordingsFolder,
+			FString::Printf(TEXT("Omni_%s%s"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")), OmniRegistry::RecordingExtension)
+		)
+		: FilePath;
+
+	TUniquePtr<FOmniRecorder> NewRecorder = MakeUnique<FOmniRecorder>();
+	FString Error;
+	if (!NewRecorder->Open(ResolvedPath, Error))
+	{
+		UE_LOG(LogOmniRegistry, Warning, TEXT("StartRecording failed: %s"), *Error);
+		return false;
+	}
+
+	Recorder = MoveTemp(NewRecorder);
+	RecordingTickIndex = 0;
+
+	TMap<FName, FString> Metadata;
+	if (ActiveManifest)
+	{
+		Metadata.Add(OmniRegistry::RecordingMetaManifest, ActiveManifest->HasAnyFlags(RF_Transient) ? FString() : ActiveManifest->GetPathName());
+		Metadata.Add(OmniRegistry::RecordingMetaManifestClass, ActiveManifest->GetClass()->GetPathName());
+	}
+	Metadata.Add(OmniRegistry::RecordingMetaClockTick, LexToString(ClockSubsystem.IsValid() ? ClockSubsystem->GetTickIndex() : 0));
+	Recorder->RecordBegin(RecordingTickIndex, ClockSubsystem.IsValid() ? ClockSubsystem->GetSimTime() : 0.0, Metadata);
+	RecordStateHashes();
+	UE_LOG(LogOmniRegistry, Log, TEXT("Recording started: %s"), *ResolvedPath);
+	return true;
+}
+
+void UOmniSystemRegistrySubsystem::StopRecording()
+{
+	if (!Recorder)
+	{
+		return;
+	}
+
+	Recorder->Close();
+	UE_LOG(
+		LogOmniRegistry,
+		Log,
+		TEXT("Recording stopped: %s Records=%lld Chunks=%d Bytes=%lld"),
+		*Recorder->GetFilePath(),
+		Recorder->GetRecordCount(),
+		Recorder->GetChunkCount(),
+		Recorder->GetBytesWritten()
+	);
+	Recorder.Reset();
+}
+
+bool UOmniSystemRegistrySubsystem::IsRecording() const
+{
+	return Recorder.IsValid();
+}
+
+FString UOmniSystemRegistrySubsystem::GetRecordingFilePath() const
+{
+	return Recorder ? Recorder->GetFilePath() : FString();
+}
+
 bool UOmniSystemRegistrySubsystem::TryInitializeFromAutoManifest()
 {
 	if (!AutoManifestAssetPath.IsNull())
@@ -610,6 +854,128 @@ bool UOmniSystemRegistrySubsystem::BuildInitializationOrder(
 	return true;
 }
 
+bool UOmniSystemRegistrySubsystem::TryGetCookedInitializationOrder(
+	const UOmniManifest* Manifest,
+	const TMap<FName, FResolvedSystemSpec>& Specs,
+	TArray<FName>& OutInitializationOrder
+)
+{
+	CookedManifest.Close();
+	bCookedManifestTrusted = false;
+	OutInitializationOrder.Reset();
+	if (!Manifest || OmniRegistry::CVarOmniCookedManifest.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	const FString FilePath = FOmniCookedManifest::ResolveFilePath(CookedManifestFile);
+	if (!FPaths::FileExists(FilePath))
+	{
+		return false;
+	}
+
+	FString OpenError;
+	if (!CookedManifest.Open(FilePath, OpenError))
+	{
+		UE_LOG(LogOmniRegistry, Warning, TEXT("Ignoring cooked manifest: %s"), *OpenError);
+		return false;
+	}
+
+	// The image must describe exactly the systems and dependencies resolved from the live manifest.
+	const TConstArrayView<OmniCookedManifestFormat::FSystemRecord> CookedSystems = CookedManifest.GetSystems();
+	const FUtf8StringView CookedNamespace = CookedManifest.GetNamespace();
+	const FUTF8ToTCHAR CookedNamespaceText(reinterpret_cast<const ANSICHAR*>(CookedNamespace.GetData()), CookedNamespace.Len());
+	bool bMatches = CookedManifest.GetBuildVersion() == Manifest->BuildVersion
+		&& FStringView(CookedNamespaceText.Get(), CookedNamespaceText.Length()).Equals(Manifest->Namespace.ToString().TrimStartAndEnd())
+		&& CookedSystems.Num() == Specs.Num();
+	TSet<FName> CookedSystemIds;
+	CookedSystemIds.Reserve(CookedSystems.Num());
+	for (int32 SystemIndex = 0; bMatches && SystemIndex < CookedSystems.Num(); ++SystemIndex)
+	{
+		const OmniCookedManifestFormat::FSystemRecord& Record = CookedSystems[SystemIndex];
+		const FName CookedSystemId = CookedManifest.GetStringAsName(Record.SystemId);
+		bool bDuplicateSystemId = false;
+		CookedSystemIds.Add(CookedSystemId, &bDuplicateSystemId);
+		const FResolvedSystemSpec* Spec = bDuplicateSystemId ? nullptr : Specs.Find(CookedSystemId);
+		const TConstArrayView<uint32> Dependencies = CookedManifest.GetRefs(Record.Dependencies);
+		bMatches = Spec && Dependencies.Num() == static_cast<int32>(Record.Dependencies.Count);
+		for (int32 DependencyIndex = 0; bMatches && DependencyIndex < Dependencies.Num(); ++DependencyIndex)
+		{
+			const uint32 DependencySystem = Dependencies[DependencyIndex];
+			bMatches = CookedSystems.IsValidIndex(static_cast<int32>(DependencySystem))
+				&& Spec->Dependencies.Contains(CookedManifest.GetStringAsName(CookedSystems[DependencySystem].SystemId));
+		}
+		if (bMatches)
+		{
+			int32 LiveDependencyCount = 0;
+			for (const FName DependencyId : Spec->Dependencies)
+			{
+				LiveDependencyCount += (DependencyId != NAME_None && DependencyId != Spec->SystemId) ? 1 : 0;
+			}
+			bMatches = LiveDependencyCount == Dependencies.Num();
+		}
+	}
+
+	// InitOrder must be a permutation of the systems: every index once, none missing.
+	const TConstArrayView<uint32> CookedOrder = CookedManifest.GetInitializationOrder();
+	bMatches = bMatches && CookedOrder.Num() == CookedSystems.Num();
+	if (bMatches)
+	{
+		TBitArray<> Ordered(false, CookedSystems.Num());
+		OutInitializationOrder.Reserve(CookedOrder.Num());
+		for (const uint32 SystemIndex : CookedOrder)
+		{
+			if (!CookedSystems.IsValidIndex(static_cast<int32>(SystemIndex)) || Ordered[SystemIndex])
+			{
+				bMatches = false;
+				break;
+			}
+			Ordered[SystemIndex] = true;
+			OutInitializationOrder.Add(CookedManifest.GetStringAsName(CookedSystems[SystemIndex].SystemId));
+		}
+	}
+
+	if (!bMatches)
+	{
+		UE_LOG(
+			LogOmniRegistry,
+			Log,
+			TEXT("Cooked manifest '%s' does not match manifest '%s'; computing initialization order."),
+			*FilePath,
+			*GetNameSafe(Manifest)
+		);
+		OutInitializationOrder.Reset();
+		CookedManifest.Close();
+		return false;
+	}
+
+	if (bTrustVerifiedCookedManifest)
+	{
+		bCookedManifestTrusted = !LiveInputHash.IsEmpty() && CookedManifest.MatchesInputHash(LiveInputHash);
+		if (!bCookedManifestTrusted)
+		{
+			UE_LOG(
+				LogOmniRegistry,
+				Log,
+				TEXT("Cooked manifest InputHash does not match manifest '%s' (live %s); systems run full validation."),
+				*GetNameSafe(Manifest),
+				*LiveInputHash
+			);
+		}
+	}
+
+	UE_LOG(
+		LogOmniRegistry,
+		Verbose,
+		TEXT("Using cooked initialization order from '%s' (%lld bytes, %s, %s)."),
+		*FilePath,
+		CookedManifest.GetImageSize(),
+		CookedManifest.IsMemoryMapped() ? TEXT("mapped") : TEXT("loaded"),
+		bCookedManifestTrusted ? TEXT("trusted") : TEXT("untrusted")
+	);
+	return true;
+}
+
 UOmniDebugSubsystem* UOmniSystemRegistrySubsystem::TryGetDebugSubsystem() const
 {
 	if (const UGameInstance* GameInstance = GetGameInstance())
@@ -628,8 +994,19 @@ void UOmniSystemRegistrySubsystem::PublishRegistryDiagnostics(const bool bManife
 		return;
 	}
 
-	DebugSubsystem->SetMetric(TEXT("Omni.ManifestLoaded"), bManifestLoaded ? TEXT("True") : TEXT("False"));
-	DebugSubsystem->SetMetric(TEXT("Omni.DevDefaults"), IsDevDefaultsEnabled() ? TEXT("ON") : TEXT("OFF"));
+	OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.ManifestLoaded"), bManifestLoaded ? TEXT("True") : TEXT("False"));
+	OMNI_METRIC_STATE(DebugSubsystem, TEXT("Omni.DevDefaults"), IsDevDefaultsEnabled() ? TEXT("ON") : TEXT("OFF"));
+}
+
+void UOmniSystemRegistrySubsystem::RecordStateHashes()
+{
+	for (int32 SystemIndex = 0; SystemIndex < ActiveSystems.Num(); ++SystemIndex)
+	{
+		if (UOmniRuntimeSystem* System = ActiveSystems[SystemIndex])
+		{
+			Recorder->RecordStateHash(RecordingTickIndex, ActiveSystemIds[SystemIndex], FOmniStateHashWriter::HashSystemState(*System));
+		}
+	}
 }
 
 void UOmniSystemRegistrySubsystem::ShutdownSystemsInternal(const bool bLogSummary)
@@ -651,8 +1028,12 @@ void UOmniSystemRegistrySubsystem::ShutdownSystemsInternal(const bool bLogSummar
 	}
 
 	ActiveSystems.Reset();
+	ActiveSystemIds.Reset();
 	SystemsById.Reset();
 	ActiveManifest = nullptr;
 	bRegistryInitialized = false;
+	CookedManifest.Close();
+	bCookedManifestTrusted = false;
+	LiveInputHash.Reset();
 	PublishRegistryDiagnostics(false);
 }
@@ -0,0 +1,352 @@
+#include "Systems/OmniTimerWheel.h"
+
+namespace OmniTimerWheel
+{
+	static constexpr uint64 SlotMask = FOmniTimerWheel::SlotsPerLevel - 1;
+	static constexpr uint64 MaxDeltaTicks = (uint64(1) << (FOmniTimerWheel::NumLevels * FOmniTimerWheel::SlotBits)) - 1;
+
+	static uint64 LevelSpan(const int32 Level)
+	{
+		return uint64(1) << (Level * FOmniTimerWheel::SlotBits);
+	}
+}
+
+FOmniTimerWheel::FOmniTimerWheel(const double InTicksPerSecond)
+	: TicksPerSecond(FMath::Max(1.0, InTicksPerSecond))
+{
+	for (int32& Head : SlotHeads)
+	{
+		Head = INDEX_NONE;
+	}
+}
+
+FOmniTimerHandle FOmniTimerWheel::Schedule(const double NowSeconds, const double DelaySeconds, FOmniTimerDelegate Callback)
+{
+	FOmniTimerHandle Handle;
+	if (!Callback.IsBound())
+	{
+		return Handle;
+	}
+
+	const int32 Index = AllocateEntry();
+	FEntry& Entry = Entries[Index];
+	Entry.DeadlineSeconds = FMath::Max(NowSeconds, CurrentSeconds) + FMath::Max(0.0, DelaySeconds);
+	Entry.DeadlineTick = FMath::Max(ToTickCeil(Entry.DeadlineSeconds), CurrentTick + 1);
+	Entry.Sequence = NextSequence++;
+	Entry.Callback = MoveTemp(Callback);
+	Entry.bActive = true;
+	++ActiveCount;
+	InsertEntry(Index);
+
+	Handle.Index = Index;
+	Handle.Generation = Entry.Generation;
+	return Handle;
+}
+
+bool FOmniTimerWheel::Cancel(FOmniTimerHandle& Handle)
+{
+	if (!FindEntry(Handle))
+	{
+		Handle.Invalidate();
+		return false;
+	}
+
+	const int32 Index = Handle.Index;
+	if (Entries[Index].Slot != INDEX_NONE)
+	{
+		UnlinkFromSlot(Index);
+	}
+	FreeEntry(Index);
+	Handle.Invalidate();
+	return true;
+}
+
+bool FOmniTimerWheel::IsActive(const FOmniTimerHandle& Handle) const
+{
+	return FindEntry(Handle) != nullptr;
+}
+
+double FOmniTimerWheel::GetRemainingSeconds(const FOmniTimerHandle& Handle, const double NowSeconds) const
+{
+	const FEntry* Entry = FindEntry(Handle);
+	return Entry ? FMath::Max(0.0, Entry->DeadlineSeconds - NowSeconds) : 0.0;
+}
+
+int32 FOmniTimerWheel::Advance(const double NowSeconds)
+{
+	if (NowSeconds < CurrentSeconds)
+	{
+		Rebase(NowSeconds);
+		return 0;
+	}
+
+	CurrentSeconds = NowSeconds;
+	const uint64 TargetTick = ToTickFloor(NowSeconds);
+	if (LinkedCount == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		return 0;
+	}
+
+	ExpiredScratch.Reset();
+	while (CurrentTick < TargetTick && LinkedCount > 0)
+	{
+		++CurrentTick;
+		for (int32 Level = 1; Level < NumLevels; ++Level)
+		{
+			if ((CurrentTick & (OmniTimerWheel::LevelSpan(Level) - 1)) != 0)
+			{
+				break;
+			}
+			CascadeSlot(Level, static_cast<int32>((CurrentTick >> (Level * SlotBits)) & OmniTimerWheel::SlotMask));
+		}
+		CollectSlot(static_cast<int32>(CurrentTick & OmniTimerWheel::SlotMask));
+	}
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+
+	if (ExpiredScratch.Num() == 0)
+	{
+		return 0;
+	}
+
+	ExpiredScratch.Sort(
+		[this](const FExpired& A, const FExpired& B)
+		{
+			const FEntry& EntryA = Entries[A.Index];
+			const FEntry& EntryB = Entries[B.Index];
+			if (EntryA.DeadlineSeconds != EntryB.DeadlineSeconds)
+			{
+				return EntryA.DeadlineSeconds < EntryB.DeadlineSeconds;
+			}
+			return EntryA.Sequence < EntryB.Sequence;
+		}
+	);
+
+	// Callbacks may schedule or cancel timers, so the batch is detached before firing.
+	TArray<FExpired> Batch = MoveTemp(ExpiredScratch);
+	ExpiredScratch.Reset();
+
+	int32 FiredCount = 0;
+	for (const FExpired& Expired : Batch)
+	{
+		FOmniTimerHandle Handle;
+		Handle.Index = Expired.Index;
+		Handle.Generation = Expired.Generation;
+		if (!FindEntry(Handle))
+		{
+			continue;
+		}
+
+		if (Entries[Expired.Index].Slot != INDEX_NONE)
+		{
+			UnlinkFromSlot(Expired.Index);
+		}
+		FOmniTimerDelegate Callback = MoveTemp(Entries[Expired.Index].Callback);
+		FreeEntry(Expired.Index);
+		Callback.ExecuteIfBound();
+		++FiredCount;
+	}
+
+	Batch.Reset();
+	if (ExpiredScratch.Num() == 0)
+	{
+		ExpiredScratch = MoveTemp(Batch);
+	}
+	return FiredCount;
+}
+
+void FOmniTimerWheel::Rebase(const double NowSeconds)
+{
+	const double Offset = NowSeconds - CurrentSeconds;
+	CurrentSeconds = NowSeconds;
+	CurrentTick = ToTickFloor(NowSeconds);
+
+	for (int32& Head : SlotHeads)
+	{
+		Head = INDEX_NONE;
+	}
+	LinkedCount = 0;
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FEntry& Entry = Entries[Index];
+		if (!Entry.bActive)
+		{
+			continue;
+		}
+
+		Entry.Prev = INDEX_NONE;
+		Entry.Next = INDEX_NONE;
+		Entry.Slot = INDEX_NONE;
+		Entry.DeadlineSeconds = FMath::Max(NowSeconds, Entry.DeadlineSeconds + Offset);
+		Entry.DeadlineTick = FMath::Max(ToTickCeil(Entry.DeadlineSeconds), CurrentTick + 1);
+		InsertEntry(Index);
+	}
+}
+
+void FOmniTimerWheel::Reset(const double NowSeconds)
+{
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Entries[Index].bActive)
+		{
+			Entries[Index].Slot = INDEX_NONE;
+			FreeEntry(Index);
+		}
+	}
+
+	for (int32& Head : SlotHeads)
+	{
+		Head = INDEX_NONE;
+	}
+	LinkedCount = 0;
+	ExpiredScratch.Reset();
+	CurrentSeconds = NowSeconds;
+	CurrentTick = ToTickFloor(NowSeconds);
+}
+
+int32 FOmniTimerWheel::Num() const
+{
+	return ActiveCount;
+}
+
+uint64 FOmniTimerWheel::ToTickFloor(const double Seconds) const
+{
+	return Seconds <= 0.0 ? 0 : static_cast<uint64>(FMath::FloorToDouble(Seconds * TicksPerSecond));
+}
+
+uint64 FOmniTimerWheel::ToTickCeil(const double Seconds) const
+{
+	return Seconds <= 0.0 ? 0 : static_cast<uint64>(FMath::CeilToDouble(Seconds * TicksPerSecond));
+}
+
+int32 FOmniTimerWheel::AllocateEntry()
+{
+	if (FreeIndices.Num() > 0)
+	{
+		return FreeIndices.Pop(EAllowShrinking::No);
+	}
+	return Entries.AddDefaulted();
+}
+
+void FOmniTimerWheel::FreeEntry(const int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+	Entry.Callback.Unbind();
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = INDEX_NONE;
+	Entry.Slot = INDEX_NONE;
+	Entry.bActive = false;
+	++Entry.Generation;
+	--ActiveCount;
+	FreeIndices.Add(Index);
+}
+
+void FOmniTimerWheel::InsertEntry(const int32 Index)
+{
+	const FEntry& Entry = Entries[Index];
+	const uint64 Delta = Entry.DeadlineTick > CurrentTick ? Entry.DeadlineTick - CurrentTick : 0;
+	const uint64 SlotTick = Delta > OmniTimerWheel::MaxDeltaTicks
+		? CurrentTick + OmniTimerWheel::MaxDeltaTicks
+		: CurrentTick + Delta;
+	const uint64 ClampedDelta = SlotTick - CurrentTick;
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && ClampedDelta >= OmniTimerWheel::LevelSpan(Level + 1))
+	{
+		++Level;
+	}
+
+	const int32 SlotInLevel = static_cast<int32>((SlotTick >> (Level * SlotBits)) & OmniTimerWheel::SlotMask);
+	LinkIntoSlot(Index, Level * SlotsPerLevel + SlotInLevel);
+}
+
+void FOmniTimerWheel::LinkIntoSlot(const int32 Index, const int32 Slot)
+{
+	FEntry& Entry = Entries[Index];
+	Entry.Slot = Slot;
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = SlotHeads[Slot];
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = Index;
+	}
+	SlotHeads[Slot] = Index;
+	++LinkedCount;
+}
+
+void FOmniTimerWheel::UnlinkFromSlot(const int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+	if (Entry.Prev != INDEX_NONE)
+	{
+		Entries[Entry.Prev].Next = Entry.Next;
+	}
+	else
+	{
+		SlotHeads[Entry.Slot] = Entry.Next;
+	}
+	if (Entry.Next != INDEX_NONE)
+	{
+		Entries[Entry.Next].Prev = Entry.Prev;
+	}
+
+	Entry.Prev = INDEX_NONE;
+	Entry.Next = INDEX_NONE;
+	Entry.Slot = INDEX_NONE;
+	--LinkedCount;
+}
+
+void FOmniTimerWheel::CascadeSlot(const int32 Level, const int32 SlotInLevel)
+{
+	const int32 Slot = Level * SlotsPerLevel + SlotInLevel;
+	int32 Index = SlotHeads[Slot];
+	SlotHeads[Slot] = INDEX_NONE;
+
+	while (Index != INDEX_NONE)
+	{
+		const int32 NextIndex = Entries[Index].Next;
+		--LinkedCount;
+		InsertEntry(Index);
+		Index = NextIndex;
+	}
+}
+
+void FOmniTimerWheel::CollectSlot(const int32 Slot)
+{
+	int32 Index = SlotHeads[Slot];
+	SlotHeads[Slot] = INDEX_NONE;
+
+	while (Index != INDEX_NONE)
+	{
+		FEntry& Entry = Entries[Index];
+		const int32 NextIndex = Entry.Next;
+		Entry.Prev = INDEX_NONE;
+		Entry.Next = INDEX_NONE;
+		Entry.Slot = INDEX_NONE;
+		--LinkedCount;
+
+		if (Entry.DeadlineTick <= CurrentTick)
+		{
+			FExpired& Expired = ExpiredScratch.AddDefaulted_GetRef();
+			Expired.Index = Index;
+			Expired.Generation = Entry.Generation;
+		}
+		else
+		{
+			InsertEntry(Index);
+		}
+		Index = NextIndex;
+	}
+}
+
+const FOmniTimerWheel::FEntry* FOmniTimerWheel::FindEntry(const FOmniTimerHandle& Handle) const
+{
+	if (!Entries.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+
+	const FEntry& Entry = Entries[Handle.Index];
+	return Entry.bActive && Entry.Generation == Handle.Generation ? &Entry : nullptr;
+}
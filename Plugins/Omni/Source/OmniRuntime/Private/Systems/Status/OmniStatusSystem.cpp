@@ -1,10 +1,14 @@
 #include "Systems/Status/OmniStatusSystem.h"
 
-#include "Debug/OmniDebugSubsystem.h"
+#include "Debug/OmniDebugMacros.h"
+#include "Debug/OmniTrace.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Library/OmniStatusLibrary.h"
 #include "Manifest/OmniManifest.h"
 #include "Profile/OmniStatusProfile.h"
+#include "Systems/OmniClockSubsystem.h"
 #include "Systems/OmniSystemRegistrySubsystem.h"
 #include "Systems/OmniSystemMessageSchemas.h"
 #include "UObject/SoftObjectPath.h"
@@ -13,6 +17,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogOmniStatusSystem, Log, All);
 
 namespace OmniStatus
 {
+	static const FName TraceLoadProfile(TEXT("Status.LoadProfile"));
 	static const FName CategoryName(TEXT("Status"));
 	static const FName SourceName(TEXT("StatusSystem"));
 	static const FName SystemId(TEXT("Status"));
@@ -25,6 +30,17 @@ namespace OmniStatus
 	static const FName ManifestSettingStatusProfileAssetPath(TEXT("StatusProfileAssetPath"));
 	static const TCHAR* DefaultStatusProfileAssetPath = TEXT("/Game/Data/Status/DA_Omni_StatusProfile_Default.DA_Omni_StatusProfile_Default");
 	static const FName DebugMetricProfileStatus(TEXT("Omni.Profile.Status"));
+	static const FOmniDebugFormat LogInitialized(TEXT("Status inicializado. Stamina={0}"));
+	static const FOmniDebugFormat LogEnteredExhausted(TEXT("Entrou em estado Exhausted"));
+	static const FOmniDebugFormat LogLeftExhausted(TEXT("Saiu de estado Exhausted"));
+	// Lazy mode has no tick; the Status.Stamina gauge is refreshed at the overlay's own rate while stamina moves.
+	static constexpr double LazyTelemetryIntervalSeconds = 0.2;
+	static TAutoConsoleVariable<int32> CVarStatusEvaluationMode(
+		TEXT("omni.status.evaluation"),
+		0,
+		TEXT("Status stamina evaluation mode (applied on system initialization).\n0=Tick (integrate every frame)\n1=Lazy (closed-form on demand + threshold timer)"),
+		ECVF_Default
+	);
 }
 
 FName UOmniStatusSystem::GetSystemId_Implementation() const
@@ -48,23 +64,19 @@ void UOmniStatusSystem::InitializeSystem_Implementation(UObject* WorldContextObj
 		if (UGameInstance* GameInstance = Registry->GetGameInstance())
 		{
 			DebugSubsystem = GameInstance->GetSubsystem<UOmniDebugSubsystem>();
+			ClockSubsystem = GameInstance->GetSubsystem<UOmniClockSubsystem>();
 		}
 	}
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->SetMetric(OmniStatus::DebugMetricProfileStatus, TEXT("Pending"));
-	}
+	OMNI_METRIC_STATE(DebugSubsystem, OmniStatus::DebugMetricProfileStatus, TEXT("Pending"));
+	RegisterMetrics();
 
 	RuntimeSettings = FOmniStatusSettings();
 	FString LoadError;
 	if (!TryLoadSettingsFromManifest(Manifest, LoadError))
 	{
 		UE_LOG(LogOmniStatusSystem, Error, TEXT("Fail-fast [SystemId=%s]: %s"), *GetSystemId().ToString(), *LoadError);
-		if (DebugSubsystem.IsValid())
-		{
-			DebugSubsystem->SetMetric(OmniStatus::DebugMetricProfileStatus, TEXT("Failed"));
-			DebugSubsystem->LogError(OmniStatus::CategoryName, LoadError, OmniStatus::SourceName);
-		}
+		OMNI_METRIC_STATE(DebugSubsystem, OmniStatus::DebugMetricProfileStatus, TEXT("Failed"));
+		OMNI_DEBUG_LOG_TEXT(DebugSubsystem, EOmniDebugLevel::Error, OmniStatus::CategoryName, OmniStatus::SourceName, LoadError);
 		return;
 	}
 
@@ -77,43 +89,57 @@ void UOmniStatusSystem::InitializeSystem_Implementation(UObject* WorldContextObj
 	CurrentStamina = RuntimeSettings.MaxStamina;
 	bExhausted = false;
 	bSprinting = false;
-	TimeSinceLastConsumption = RuntimeSettings.RegenDelaySeconds;
+	ClearRegenDelayTimer();
+	bLazyEvaluation = OmniStatus::CVarStatusEvaluationMode.GetValueOnGameThread() == 1;
+	LazySegmentStartTime = GetNowSeconds();
+	LazyRegenResumeTime = LazySegmentStartTime;
 	UpdateStateTags();
 	PublishTelemetry();
 	SetInitializationResult(true);
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->SetMetric(OmniStatus::DebugMetricProfileStatus, TEXT("Loaded"));
-	}
-
-	UE_LOG(LogOmniStatusSystem, Log, TEXT("Status system initialized. Manifest=%s"), *GetNameSafe(Manifest));
-
-	if (DebugSubsystem.IsValid())
-	{
-		DebugSubsystem->LogEvent(
-			OmniStatus::CategoryName,
-			FString::Printf(TEXT("Status inicializado. Stamina=%.1f"), CurrentStamina),
-			OmniStatus::SourceName
-		);
-	}
+	OMNI_METRIC_STATE(DebugSubsystem, OmniStatus::DebugMetricProfileStatus, TEXT("Loaded"));
+
+	UE_LOG(
+		LogOmniStatusSystem,
+		Log,
+		TEXT("Status system initialized. Manifest=%s Evaluation=%s"),
+		*GetNameSafe(Manifest),
+		bLazyEvaluation ? TEXT("Lazy") : TEXT("Tick")
+	);
+
+	OMNI_DEBUG_LOG(
+		DebugSubsystem,
+		EOmniDebugLevel::Event,
+		OmniStatus::CategoryName,
+		OmniStatus::SourceName,
+		OmniStatus::LogInitialized,
+		CurrentStamina
+	);
 }
 
 void UOmniStatusSystem::ShutdownSystem_Implementation()
 {
+	ClearLazyThresholdTimer();
+	ClearLazyTelemetryTimer();
+	ClearRegenDelayTimer();
 	bSprinting = false;
 	bExhausted = false;
 	StateTags.Reset();
 
 	if (DebugSubsystem.IsValid())
 	{
-		DebugSubsystem->RemoveMetric(TEXT("Status.Stamina"));
-		DebugSubsystem->RemoveMetric(TEXT("Status.Exhausted"));
-		DebugSubsystem->RemoveMetric(TEXT("Status.Sprinting"));
+		UnregisterMetrics();
 		DebugSubsystem->RemoveMetric(OmniStatus::DebugMetricProfileStatus);
-		DebugSubsystem->LogEvent(OmniStatus::CategoryName, TEXT("Status finalizado"), OmniStatus::SourceName);
+		OMNI_DEBUG_LOG_TEXT(
+			DebugSubsystem,
+			EOmniDebugLevel::Event,
+			OmniStatus::CategoryName,
+			OmniStatus::SourceName,
+			TEXT("Status finalizado")
+		);
 	}
 
 	DebugSubsystem.Reset();
+	ClockSubsystem.Reset();
 	Registry.Reset();
 
 	UE_LOG(LogOmniStatusSystem, Log, TEXT("Status system shutdown."));
@@ -121,7 +147,7 @@ void UOmniStatusSystem::ShutdownSystem_Implementation()
 
 bool UOmniStatusSystem::IsTickEnabled_Implementation() const
 {
-	return true;
+	return !bLazyEvaluation;
 }
 
 void UOmniStatusSystem::TickSystem_Implementation(const float DeltaTime)
@@ -135,50 +161,12 @@ void UOmniStatusSystem::TickSystem_Implementation(const float DeltaTime)
 	{
 		ConsumeStamina(RuntimeSettings.SprintDrainPerSecond * DeltaTime);
 	}
-	else
+	else if (!RegenDelayTimerHandle.IsValid() && CurrentStamina < RuntimeSettings.MaxStamina)
 	{
-		TimeSinceLastConsumption += DeltaTime;
-		if (TimeSinceLastConsumption >= RuntimeSettings.RegenDelaySeconds && CurrentStamina < RuntimeSettings.MaxStamina)
-		{
-			AddStamina(RuntimeSettings.RegenPerSecond * DeltaTime);
-		}
-	}
-
-	if (!bExhausted && CurrentStamina <= RuntimeSettings.ExhaustedThreshold)
-	{
-		bExhausted = true;
-		UpdateStateTags();
-
-		if (Registry.IsValid())
-		{
-			FOmniExhaustedEventSchema EventSchema;
-			EventSchema.SourceSystem = OmniStatus::SystemId;
-			Registry->BroadcastEvent(FOmniExhaustedEventSchema::ToMessage(EventSchema));
-		}
-
-		if (DebugSubsystem.IsValid())
-		{
-			DebugSubsystem->LogWarning(OmniStatus::CategoryName, TEXT("Entrou em estado Exhausted"), OmniStatus::SourceName);
-		}
-	}
-	else if (bExhausted && CurrentStamina >= RuntimeSettings.ExhaustRecoverThreshold)
-	{
-		bExhausted = false;
-		UpdateStateTags();
-
-		if (Registry.IsValid())
-		{
-			FOmniExhaustedClearedEventSchema EventSchema;
-			EventSchema.SourceSystem = OmniStatus::SystemId;
-			Registry->BroadcastEvent(FOmniExhaustedClearedEventSchema::ToMessage(EventSchema));
-		}
-
-		if (DebugSubsystem.IsValid())
-		{
-			DebugSubsystem->LogEvent(OmniStatus::CategoryName, TEXT("Saiu de estado Exhausted"), OmniStatus::SourceName);
-		}
+		AddStamina(RuntimeSettings.RegenPerSecond * DeltaTime);
 	}
 
+	UpdateExhaustionState();
 	PublishTelemetry();
 }
 
@@ -259,8 +247,9 @@ bool UOmniStatusSystem::HandleQuery_Implementation(FOmniQueryMessage& Query)
 	{
 		Query.bHandled = true;
 		Query.bSuccess = true;
-		Query.Result = FString::Printf(TEXT("%.2f/%.2f"), CurrentStamina, RuntimeSettings.MaxStamina);
-		Query.SetOutputValue(TEXT("Current"), FString::Printf(TEXT("%.2f"), CurrentStamina));
+		const float Stamina = GetCurrentStamina();
+		Query.Result = FString::Printf(TEXT("%.2f/%.2f"), Stamina, RuntimeSettings.MaxStamina);
+		Query.SetOutputValue(TEXT("Current"), FString::Printf(TEXT("%.2f"), Stamina));
 		Query.SetOutputValue(TEXT("Max"), FString::Printf(TEXT("%.2f"), RuntimeSettings.MaxStamina));
 		Query.SetOutputValue(TEXT("Normalized"), FString::Printf(TEXT("%.4f"), GetStaminaNormalized()));
 		return true;
@@ -275,9 +264,32 @@ void UOmniStatusSystem::HandleEvent_Implementation(const FOmniEventMessage& Even
 	(void)Event;
 }
 
+void UOmniStatusSystem::SaveState(FArchive& Ar)
+{
+	Ar << CurrentStamina;
+	Ar << bSprinting;
+	Ar << bExhausted;
+	Ar << bLazyEvaluation;
+	Ar << LazySegmentStartTime;
+	Ar << LazyRegenResumeTime;
+
+	bool bRegenDelayActive = RegenDelayTimerHandle.IsValid();
+	bool bLazyThresholdActive = LazyThresholdTimerHandle.IsValid();
+	Ar << bRegenDelayActive;
+	Ar << bLazyThresholdActive;
+
+	TArray<FName> TagNames;
+	for (const FGameplayTag& Tag : StateTags)
+	{
+		TagNames.Add(Tag.GetTagName());
+	}
+	TagNames.Sort(FNameLexicalLess());
+	Ar << TagNames;
+}
+
 float UOmniStatusSystem::GetCurrentStamina() const
 {
-	return CurrentStamina;
+	return bLazyEvaluation ? EvaluateStaminaAt(GetNowSeconds()) : CurrentStamina;
 }
 
 float UOmniStatusSystem::GetMaxStamina() const
@@ -292,7 +304,7 @@ float UOmniStatusSystem::GetStaminaNormalized() const
 		return 0.0f;
 	}
 
-	return CurrentStamina / RuntimeSettings.MaxStamina;
+	return GetCurrentStamina() / RuntimeSettings.MaxStamina;
 }
 
 bool UOmniStatusSystem::IsExhausted() const
@@ -312,10 +324,25 @@ void UOmniStatusSystem::SetSprinting(const bool bInSprinting)
 		return;
 	}
 
+	if (bLazyEvaluation)
+	{
+		const double NowSeconds = GetNowSeconds();
+		RebaseLazySegment(NowSeconds);
+		if (!bInSprinting)
+		{
+			LazyRegenResumeTime = NowSeconds + RuntimeSettings.RegenDelaySeconds;
+		}
+	}
+
 	bSprinting = bInSprinting;
-	if (!bSprinting)
+	if (!bSprinting && !bLazyEvaluation)
 	{
-		TimeSinceLastConsumption = 0.0f;
+		RestartRegenDelay();
+	}
+
+	if (bLazyEvaluation)
+	{
+		ScheduleNextLazyThreshold();
 	}
 
 	PublishTelemetry();
@@ -328,8 +355,23 @@ void UOmniStatusSystem::ConsumeStamina(const float Amount)
 		return;
 	}
 
+	if (bLazyEvaluation)
+	{
+		const double NowSeconds = GetNowSeconds();
+		RebaseLazySegment(NowSeconds);
+		CurrentStamina = FMath::Max(0.0f, CurrentStamina - Amount);
+		LazyRegenResumeTime = NowSeconds + RuntimeSettings.RegenDelaySeconds;
+		UpdateExhaustionState();
+		ScheduleNextLazyThreshold();
+		PublishTelemetry();
+		return;
+	}
+
 	CurrentStamina = FMath::Max(0.0f, CurrentStamina - Amount);
-	TimeSinceLastConsumption = 0.0f;
+	if (!bSprinting)
+	{
+		RestartRegenDelay();
+	}
 }
 
 void UOmniStatusSystem::AddStamina(const float Amount)
@@ -339,6 +381,16 @@ void UOmniStatusSystem::AddStamina(const float Amount)
 		return;
 	}
 
+	if (bLazyEvaluation)
+	{
+		RebaseLazySegment(GetNowSeconds());
+		CurrentStamina = FMath::Min(RuntimeSettings.MaxStamina, CurrentStamina + Amount);
+		UpdateExhaustionState();
+		ScheduleNextLazyThreshold();
+		PublishTelemetry();
+		return;
+	}
+
 	CurrentStamina = FMath::Min(RuntimeSettings.MaxStamina, CurrentStamina + Amount);
 }
 
@@ -347,6 +399,12 @@ bool UOmniStatusSystem::TryLoadSettingsFromManifest(
 	FString& OutError
 )
 {
+	FOmniTraceScope TraceScope(TEXT("Profile"), OmniStatus::TraceLoadProfile);
+	if (TraceScope.IsActive())
+	{
+		TraceScope.AddArg(TEXT("Manifest"), GetNameSafe(Manifest));
+	}
+
 	OutError.Reset();
 
 	if (!Manifest)
@@ -527,6 +585,51 @@ bool UOmniStatusSystem::TryLoadSettingsFromManifest(
 	return true;
 }
 
+void UOmniStatusSystem::UpdateExhaustionState()
+{
+	const float Stamina = GetCurrentStamina();
+	if (!bExhausted && Stamina <= RuntimeSettings.ExhaustedThreshold)
+	{
+		bExhausted = true;
+		UpdateStateTags();
+
+		if (Registry.IsValid())
+		{
+			FOmniExhaustedEventSchema EventSchema;
+			EventSchema.SourceSystem = OmniStatus::SystemId;
+			Registry->BroadcastEvent(FOmniExhaustedEventSchema::ToMessage(EventSchema));
+		}
+
+		OMNI_DEBUG_LOG(
+			DebugSubsystem,
+			EOmniDebugLevel::Warning,
+			OmniStatus::CategoryName,
+			OmniStatus::SourceName,
+			OmniStatus::LogEnteredExhausted
+		);
+	}
+	else if (bExhausted && Stamina >= RuntimeSettings.ExhaustRecoverThreshold)
+	{
+		bExhausted = false;
+		UpdateStateTags();
+
+		if (Registry.IsValid())
+		{
+			FOmniExhaustedClearedEventSchema EventSchema;
+			EventSchema.SourceSystem = OmniStatus::SystemId;
+			Registry->BroadcastEvent(FOmniExhaustedClearedEventSchema::ToMessage(EventSchema));
+		}
+
+		OMNI_DEBUG_LOG(
+			DebugSubsystem,
+			EOmniDebugLevel::Event,
+			OmniStatus::CategoryName,
+			OmniStatus::SourceName,
+			OmniStatus::LogLeftExhausted
+		);
+	}
+}
+
 void UOmniStatusSystem::UpdateStateTags()
 {
 	StateTags.Reset();
@@ -537,13 +640,200 @@ void UOmniStatusSystem::UpdateStateTags()
 }
 
 void UOmniStatusSystem::PublishTelemetry()
+{
+	FOmniMetricRegistry* Metrics = OMNI_METRICS(DebugSubsystem);
+	if (!Metrics)
+	{
+		return;
+	}
+
+	Metrics->SetFloat(StaminaMetric, GetCurrentStamina());
+	Metrics->SetFloat(MaxStaminaMetric, RuntimeSettings.MaxStamina);
+	Metrics->SetBool(ExhaustedMetric, bExhausted);
+	Metrics->SetBool(SprintingMetric, bSprinting);
+
+	if (bLazyEvaluation)
+	{
+		ScheduleLazyTelemetryRefresh();
+	}
+}
+
+void UOmniStatusSystem::RegisterMetrics()
 {
 	if (!DebugSubsystem.IsValid())
 	{
 		return;
 	}
 
-	DebugSubsystem->SetMetric(TEXT("Status.Stamina"), FString::Printf(TEXT("%.1f/%.1f"), CurrentStamina, RuntimeSettings.MaxStamina));
-	DebugSubsystem->SetMetric(TEXT("Status.Exhausted"), bExhausted ? TEXT("True") : TEXT("False"));
-	DebugSubsystem->SetMetric(TEXT("Status.Sprinting"), bSprinting ? TEXT("True") : TEXT("False"));
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	StaminaMetric = Metrics.RegisterGauge(TEXT("Status.Stamina"), EOmniMetricValueType::Float);
+	MaxStaminaMetric = Metrics.RegisterGauge(TEXT("Status.MaxStamina"), EOmniMetricValueType::Float);
+	ExhaustedMetric = Metrics.RegisterGauge(TEXT("Status.Exhausted"), EOmniMetricValueType::Bool);
+	SprintingMetric = Metrics.RegisterGauge(TEXT("Status.Sprinting"), EOmniMetricValueType::Bool);
+}
+
+void UOmniStatusSystem::UnregisterMetrics()
+{
+	if (!DebugSubsystem.IsValid())
+	{
+		return;
+	}
+
+	FOmniMetricRegistry& Metrics = DebugSubsystem->GetMetricRegistry();
+	Metrics.Unregister(StaminaMetric);
+	Metrics.Unregister(MaxStaminaMetric);
+	Metrics.Unregister(ExhaustedMetric);
+	Metrics.Unregister(SprintingMetric);
+}
+
+double UOmniStatusSystem::GetNowSeconds() const
+{
+	if (ClockSubsystem.IsValid())
+	{
+		return ClockSubsystem->GetSimTime();
+	}
+	if (Registry.IsValid() && Registry->GetWorld())
+	{
+		return Registry->GetWorld()->GetTimeSeconds();
+	}
+	return 0.0;
+}
+
+void UOmniStatusSystem::RestartRegenDelay()
+{
+	ClearRegenDelayTimer();
+	if (RuntimeSettings.RegenDelaySeconds <= 0.0f || !ClockSubsystem.IsValid())
+	{
+		return;
+	}
+
+	RegenDelayTimerHandle = ClockSubsystem->SetTimer(
+		RuntimeSettings.RegenDelaySeconds,
+		FOmniTimerDelegate::CreateUObject(this, &UOmniStatusSystem::HandleRegenDelayElapsed)
+	);
+}
+
+void UOmniStatusSystem::ClearRegenDelayTimer()
+{
+	if (ClockSubsystem.IsValid())
+	{
+		ClockSubsystem->ClearTimer(RegenDelayTimerHandle);
+	}
+	RegenDelayTimerHandle.Invalidate();
+}
+
+void UOmniStatusSystem::HandleRegenDelayElapsed()
+{
+	RegenDelayTimerHandle.Invalidate();
+}
+
+float UOmniStatusSystem::EvaluateStaminaAt(const double TimeSeconds) const
+{
+	const double Elapsed = FMath::Max(0.0, TimeSeconds - LazySegmentStartTime);
+	if (bSprinting)
+	{
+		return FMath::Max(0.0f, CurrentStamina - static_cast<float>(RuntimeSettings.SprintDrainPerSecond * Elapsed));
+	}
+
+	const double RegenStartTime = FMath::Max(LazySegmentStartTime, LazyRegenResumeTime);
+	if (TimeSeconds <= RegenStartTime)
+	{
+		return CurrentStamina;
+	}
+
+	const double RegenSeconds = TimeSeconds - RegenStartTime;
+	return FMath::Min(RuntimeSettings.MaxStamina, CurrentStamina + static_cast<float>(RuntimeSettings.RegenPerSecond * RegenSeconds));
+}
+
+void UOmniStatusSystem::RebaseLazySegment(const double NowSeconds)
+{
+	CurrentStamina = EvaluateStaminaAt(NowSeconds);
+	LazySegmentStartTime = NowSeconds;
+}
+
+void UOmniStatusSystem::ScheduleNextLazyThreshold()
+{
+	ClearLazyThresholdTimer();
+
+	const double NowSeconds = GetNowSeconds();
+	const float Stamina = EvaluateStaminaAt(NowSeconds);
+	double SecondsUntilCrossing = -1.0;
+
+	if (!bExhausted && bSprinting)
+	{
+		SecondsUntilCrossing = (Stamina - RuntimeSettings.ExhaustedThreshold) / RuntimeSettings.SprintDrainPerSecond;
+	}
+	else if (bExhausted && !bSprinting && Stamina < RuntimeSettings.ExhaustRecoverThreshold)
+	{
+		const double RegenStartTime = FMath::Max(NowSeconds, LazyRegenResumeTime);
+		SecondsUntilCrossing = (RegenStartTime - NowSeconds)
+			+ (RuntimeSettings.ExhaustRecoverThreshold - Stamina) / RuntimeSettings.RegenPerSecond;
+	}
+
+	if (SecondsUntilCrossing < 0.0)
+	{
+		return;
+	}
+
+	if (!ClockSubsystem.IsValid())
+	{
+		return;
+	}
+
+	LazyThresholdTimerHandle = ClockSubsystem->SetTimer(
+		SecondsUntilCrossing,
+		FOmniTimerDelegate::CreateUObject(this, &UOmniStatusSystem::HandleLazyThresholdReached)
+	);
+}
+
+void UOmniStatusSystem::ClearLazyThresholdTimer()
+{
+	if (ClockSubsystem.IsValid())
+	{
+		ClockSubsystem->ClearTimer(LazyThresholdTimerHandle);
+	}
+	LazyThresholdTimerHandle.Invalidate();
+}
+
+void UOmniStatusSystem::HandleLazyThresholdReached()
+{
+	LazyThresholdTimerHandle.Invalidate();
+	UpdateExhaustionState();
+	ScheduleNextLazyThreshold();
+	PublishTelemetry();
+}
+
+void UOmniStatusSystem::ScheduleLazyTelemetryRefresh()
+{
+	if (LazyTelemetryTimerHandle.IsValid() || !ClockSubsystem.IsValid())
+	{
+		return;
+	}
+
+	const float Stamina = GetCurrentStamina();
+	const bool bStaminaMoving = bSprinting ? Stamina > 0.0f : Stamina < RuntimeSettings.MaxStamina;
+	if (!bStaminaMoving)
+	{
+		return;
+	}
+
+	LazyTelemetryTimerHandle = ClockSubsystem->SetTimer(
+		OmniStatus::LazyTelemetryIntervalSeconds,
+		FOmniTimerDelegate::CreateUObject(this, &UOmniStatusSystem::HandleLazyTelemetryRefresh)
+	);
+}
+
+void UOmniStatusSystem::ClearLazyTelemetryTimer()
+{
+	if (ClockSubsystem.IsValid())
+	{
+		ClockSubsystem->ClearTimer(LazyTelemetryTimerHandle);
+	}
+	LazyTelemetryTimerHandle.Invalidate();
+}
+
+void UOmniStatusSystem::HandleLazyTelemetryRefresh()
+{
+	LazyTelemetryTimerHandle.Invalidate();
+	PublishTelemetry();
 }
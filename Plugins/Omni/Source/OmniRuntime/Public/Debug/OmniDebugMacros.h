@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Debug/OmniDebugSubsystem.h"
+
+// Diagnostics front-end for runtime systems. With OMNI_WITH_DEBUG_LOG=0 every call site compiles to nothing;
+// otherwise arguments are only evaluated after the subsystem's cached level check passes.
+#ifndef OMNI_WITH_DEBUG_LOG
+#define OMNI_WITH_DEBUG_LOG !UE_BUILD_SHIPPING
+#endif
+
+namespace OmniDebugMacros
+{
+	FORCEINLINE UOmniDebugSubsystem* ResolveTarget(UOmniDebugSubsystem* DebugSubsystem)
+	{
+		return DebugSubsystem;
+	}
+
+	FORCEINLINE UOmniDebugSubsystem* ResolveTarget(const TWeakObjectPtr<UOmniDebugSubsystem>& DebugSubsystem)
+	{
+		return DebugSubsystem.Get();
+	}
+
+	template <typename DebugSubsystemType>
+	FORCEINLINE FOmniMetricRegistry* ResolveMetricRegistry(const DebugSubsystemType& DebugSubsystem)
+	{
+		UOmniDebugSubsystem* Target = ResolveTarget(DebugSubsystem);
+		return Target && Target->AreMetricsEnabled() ? &Target->GetMetricRegistry() : nullptr;
+	}
+}
+
+#if OMNI_WITH_DEBUG_LOG
+
+// OMNI_DEBUG_LOG(DebugSubsystem, Level, Category, Source, Format, Args...) -> structured record (FOmniDebugFormat + args).
+#define OMNI_DEBUG_LOG(DebugSubsystem, Level, Category, Source, Format, ...) \
+	do \
+	{ \
+		const EOmniDebugLevel OmniDebugLogLevel = (Level); \
+		UOmniDebugSubsystem* OmniDebugLogTarget = OmniDebugMacros::ResolveTarget(DebugSubsystem); \
+		if (OmniDebugLogTarget && OmniDebugLogTarget->ShouldLog(OmniDebugLogLevel)) \
+		{ \
+			OmniDebugLogTarget->AddRecord(OmniDebugLogLevel, (Category), (Format), { __VA_ARGS__ }, (Source)); \
+		} \
+	} \
+	while (false)
+
+// OMNI_DEBUG_LOG_TEXT(DebugSubsystem, Level, Category, Source, Message) -> free-text entry; Message is only built when enabled.
+#define OMNI_DEBUG_LOG_TEXT(DebugSubsystem, Level, Category, Source, Message) \
+	do \
+	{ \
+		const EOmniDebugLevel OmniDebugLogLevel = (Level); \
+		UOmniDebugSubsystem* OmniDebugLogTarget = OmniDebugMacros::ResolveTarget(DebugSubsystem); \
+		if (OmniDebugLogTarget && OmniDebugLogTarget->ShouldLog(OmniDebugLogLevel)) \
+		{ \
+			OmniDebugLogTarget->AddEntry(OmniDebugLogLevel, (Category), (Message), (Source)); \
+		} \
+	} \
+	while (false)
+
+// OMNI_METRIC(DebugSubsystem, Key, Value) -> string metric; Value is only evaluated while metrics are enabled.
+#define OMNI_METRIC(DebugSubsystem, Key, Value) \
+	do \
+	{ \
+		UOmniDebugSubsystem* OmniMetricTarget = OmniDebugMacros::ResolveTarget(DebugSubsystem); \
+		if (OmniMetricTarget && OmniMetricTarget->AreMetricsEnabled()) \
+		{ \
+			OmniMetricTarget->SetMetric((Key), (Value)); \
+		} \
+	} \
+	while (false)
+
+// OMNI_METRIC_STATE(DebugSubsystem, Key, Value) -> string metric stored regardless of omni.debug. For cheap values set
+// once at init (Omni.ManifestLoaded, Omni.Profile.*) that must still be there when debug is turned back on.
+#define OMNI_METRIC_STATE(DebugSubsystem, Key, Value) \
+	do \
+	{ \
+		if (UOmniDebugSubsystem* OmniMetricTarget = OmniDebugMacros::ResolveTarget(DebugSubsystem)) \
+		{ \
+			OmniMetricTarget->SetMetric((Key), (Value)); \
+		} \
+	} \
+	while (false)
+
+// if (FOmniMetricRegistry* Metrics = OMNI_METRICS(DebugSubsystem)) { ... } -> numeric metrics; null when disabled.
+// Systems republish these from PublishTelemetry on the next change after debug is re-enabled.
+#define OMNI_METRICS(DebugSubsystem) OmniDebugMacros::ResolveMetricRegistry(DebugSubsystem)
+
+#else
+
+#define OMNI_DEBUG_LOG(DebugSubsystem, Level, Category, Source, Format, ...) do {} while (false)
+#define OMNI_DEBUG_LOG_TEXT(DebugSubsystem, Level, Category, Source, Message) do {} while (false)
+#define OMNI_METRIC(DebugSubsystem, Key, Value) do {} while (false)
+#define OMNI_METRIC_STATE(DebugSubsystem, Key, Value) do {} while (false)
+#define OMNI_METRICS(DebugSubsystem) static_cast<FOmniMetricRegistry*>(nullptr)
+
+#endif
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EOmniMetricKind : uint8
+{
+	Counter,
+	Gauge,
+	Histogram
+};
+
+enum class EOmniMetricValueType : uint8
+{
+	Int,
+	Float,
+	Bool
+};
+
+struct FOmniMetricHandle
+{
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	void Invalidate()
+	{
+		Index = INDEX_NONE;
+	}
+};
+
+// Numeric metrics updated through handles with plain stores; text is produced only when a reader formats them.
+// Slots are never recycled: unregistering hides a metric and re-registering the same key reuses its slot.
+// Registration and reads are game-thread only. Updates from other threads land in a per-thread shard (recycled once
+// its thread exits) and are folded into the slots on the next read or MergeThreadShards().
+class OMNIRUNTIME_API FOmniMetricRegistry
+{
+public:
+	FOmniMetricRegistry();
+	~FOmniMetricRegistry();
+
+	FOmniMetricRegistry(const FOmniMetricRegistry&) = delete;
+	FOmniMetricRegistry& operator=(const FOmniMetricRegistry&) = delete;
+
+	FOmniMetricHandle RegisterCounter(FName Key);
+	FOmniMetricHandle RegisterGauge(FName Key, EOmniMetricValueType ValueType, const TCHAR* Unit = nullptr);
+	FOmniMetricHandle RegisterHistogram(FName Key, TArrayView<const double> BucketUpperBounds, const TCHAR* Unit = nullptr);
+	FOmniMetricHandle RegisterLatencyHistogram(FName Key);
+	void Unregister(FOmniMetricHandle& Handle);
+	void Reset();
+
+	void Increment(const FOmniMetricHandle Handle, const int64 Delta = 1)
+	{
+		if (!IsInGameThread())
+		{
+			IncrementConcurrent(Handle, Delta);
+			return;
+		}
+
+		if (Slots.IsValidIndex(Handle.Index) && Delta != 0)
+		{
+			Slots[Handle.Index].IntValue += Delta;
+			++Revision;
+		}
+	}
+
+	void SetInt(const FOmniMetricHandle Handle, const int64 Value)
+	{
+		if (!IsInGameThread())
+		{
+			SetIntConcurrent(Handle, Value);
+			return;
+		}
+
+		if (Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].IntValue != Value)
+		{
+			Slots[Handle.Index].IntValue = Value;
+			++Revision;
+		}
+	}
+
+	void SetFloat(const FOmniMetricHandle Handle, const double Value)
+	{
+		if (!IsInGameThread())
+		{
+			SetFloatConcurrent(Handle, Value);
+			return;
+		}
+
+		if (Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].FloatValue != Value)
+		{
+			Slots[Handle.Index].FloatValue = Value;
+			++Revision;
+		}
+	}
+
+	void SetBool(const FOmniMetricHandle Handle, const bool bValue)
+	{
+		SetInt(Handle, bValue ? 1 : 0);
+	}
+
+	void Observe(FOmniMetricHandle Handle, double Value);
+
+	int32 Num() const;
+	FName GetKey(FOmniMetricHandle Handle) const;
+	FString FormatValue(FOmniMetricHandle Handle) const;
+	void ForEachMetric(TFunctionRef<void(FOmniMetricHandle Handle, FName Key)> Visitor) const;
+	void MergeThreadShards() const;
+	// Bumped whenever a visible value or the set of metrics changes; folds pending thread shards first.
+	uint32 GetRevision() const;
+
+private:
+	struct FSlot
+	{
+		FName Key = NAME_None;
+		EOmniMetricKind Kind = EOmniMetricKind::Gauge;
+		EOmniMetricValueType ValueType = EOmniMetricValueType::Int;
+		bool bActive = false;
+		int64 IntValue = 0;
+		double FloatValue = 0.0;
+		FString Unit;
+		TArray<double> BucketUpperBounds;
+		TArray<uint32> BucketCounts;
+		double Sum = 0.0;
+		double Min = 0.0;
+		double Max = 0.0;
+	};
+
+	struct FConcurrentState;
+
+	FOmniMetricHandle RegisterSlot(FName Key, EOmniMetricKind Kind, EOmniMetricValueType ValueType, const TCHAR* Unit);
+	static double EstimatePercentile(const FSlot& Slot, double Percentile);
+
+	void IncrementConcurrent(FOmniMetricHandle Handle, int64 Delta);
+	void SetIntConcurrent(FOmniMetricHandle Handle, int64 Value);
+	void SetFloatConcurrent(FOmniMetricHandle Handle, double Value);
+	void ObserveConcurrent(FOmniMetricHandle Handle, double Value);
+
+private:
+	// Mutable so const readers can fold pending thread shards before formatting.
+	mutable TArray<FSlot> Slots;
+	TMap<FName, int32> IndexByKey;
+	TUniquePtr<FConcurrentState> Concurrent;
+	mutable uint32 Revision = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Debug/OmniDebugTypes.h"
+
+enum class EOmniDebugArgType : uint8
+{
+	None,
+	Int,
+	Float,
+	Bool,
+	Name
+};
+
+struct OMNIRUNTIME_API FOmniDebugArg
+{
+	FOmniDebugArg(int32 Value);
+	FOmniDebugArg(int64 Value);
+	FOmniDebugArg(float Value);
+	FOmniDebugArg(double Value);
+	FOmniDebugArg(bool Value);
+	FOmniDebugArg(FName Value);
+	FOmniDebugArg(const TCHAR* Value) = delete;
+
+	uint64 Payload = 0;
+	EOmniDebugArgType Type = EOmniDebugArgType::None;
+};
+
+// Interned message pattern using FString::Format ordered placeholders ({0}, {1}, ...).
+// Declare as a static so the pattern is interned once; records only store the 16-bit id.
+struct OMNIRUNTIME_API FOmniDebugFormat
+{
+	explicit FOmniDebugFormat(const TCHAR* Pattern);
+	explicit FOmniDebugFormat(const FString& Pattern);
+
+	uint16 Id = 0;
+
+	static uint16 Intern(const FString& Pattern);
+	// Lock-free; interned patterns are never freed, so the pointer stays valid for the process lifetime.
+	static const TCHAR* GetPattern(uint16 FormatId);
+};
+
+struct OMNIRUNTIME_API FOmniDebugRecord
+{
+	static constexpr int32 MaxArgs = 4;
+
+	int64 TimestampTicks = 0;
+	// Unstructured entries (FormatId == 0) keep their text out of line; ArgPayloads[0] is its sequence in the owner's text buffer.
+	uint64 ArgPayloads[MaxArgs] = {};
+	FName Category = NAME_None;
+	FName Source = NAME_None;
+	float WorldTimeSeconds = 0.0f;
+	uint16 FormatId = 0;
+	EOmniDebugLevel Level = EOmniDebugLevel::Info;
+	uint8 ArgCount = 0;
+	EOmniDebugArgType ArgTypes[MaxArgs] = {};
+
+	void SetArgs(std::initializer_list<FOmniDebugArg> Args);
+	FString RenderMessage(FStringView Text) const;
+	FString RenderTimestampUtc() const;
+	FOmniDebugEntry ToEntry(FStringView Text) const;
+};
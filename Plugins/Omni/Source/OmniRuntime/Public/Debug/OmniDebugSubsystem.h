@@ -1,14 +1,21 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/MpscQueue.h"
 #include "Tickable.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Debug/OmniDebugMetrics.h"
+#include "Debug/OmniDebugRecord.h"
 #include "Debug/OmniDebugTypes.h"
+#include "Debug/OmniRingBuffer.h"
+#include <atomic>
 #include "OmniDebugSubsystem.generated.h"
 
 class APlayerController;
 class UOmniDebugOverlayWidget;
 
+using FOmniDebugRecordRange = TOmniRingBuffer<FOmniDebugRecord>::FConstRange;
+
 UCLASS()
 class OMNIRUNTIME_API UOmniDebugSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
@@ -44,9 +51,33 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Omni|Debug")
 	int32 GetRevision() const;
 
+	UFUNCTION(BlueprintPure, Category = "Omni|Debug")
+	bool IsLevelEnabled(EOmniDebugLevel Level) const;
+
+	// Cached per-level gate read by the OMNI_DEBUG_* macros before any argument is evaluated.
+	FORCEINLINE bool ShouldLog(const EOmniDebugLevel Level) const
+	{
+		return (EnabledLevelMask.load(std::memory_order_relaxed) & (1u << static_cast<uint8>(Level))) != 0;
+	}
+
+	FORCEINLINE bool AreMetricsEnabled() const
+	{
+		return EnabledLevelMask.load(std::memory_order_relaxed) != 0;
+	}
+
+	// AddEntry/AddRecord and the metric setters may be called from any thread. Off the game thread they are staged in a
+	// lock-free queue and reach the buffer on the next Tick; everything else is game-thread only.
 	UFUNCTION(BlueprintCallable, Category = "Omni|Debug")
 	void AddEntry(EOmniDebugLevel Level, FName Category, const FString& Message, FName Source = NAME_None);
 
+	void AddRecord(
+		EOmniDebugLevel Level,
+		FName Category,
+		const FOmniDebugFormat& Format,
+		std::initializer_list<FOmniDebugArg> Args = {},
+		FName Source = NAME_None
+	);
+
 	UFUNCTION(BlueprintCallable, Category = "Omni|Debug")
 	void LogInfo(FName Category, const FString& Message, FName Source = NAME_None);
 
@@ -62,8 +93,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Omni|Debug")
 	TArray<FOmniDebugEntry> GetEntriesSnapshot() const;
 
-	UFUNCTION(BlueprintPure, Category = "Omni|Debug")
-	TArray<FOmniDebugEntry> GetRecentEntries(int32 MaxCount) const;
+	UFUNCTION(BlueprintPure, Category = "Omni|Debug", meta = (DisplayName = "Get Recent Entries"))
+	TArray<FOmniDebugEntry> CopyRecentEntries(int32 MaxCount) const;
+
+	FOmniDebugRecordRange GetRecentRecords(int32 MaxCount) const;
+	FString RenderRecordMessage(const FOmniDebugRecord& Record) const;
+	// Sequence of the newest record ever pushed (0 = none); never reset, so readers can detect appends.
+	uint64 GetLastRecordSequence() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Omni|Debug")
 	void SetMetric(FName Key, const FString& Value);
@@ -76,6 +112,10 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "Omni|Debug")
 	TArray<FOmniDebugMetric> GetMetricsSnapshot() const;
+	const TMap<FName, FString>& GetLiveMetrics() const;
+
+	FOmniMetricRegistry& GetMetricRegistry();
+	const FOmniMetricRegistry& GetMetricRegistry() const;
 
 	UFUNCTION(BlueprintCallable, Category = "Omni|Debug|Overlay")
 	bool ShowOverlay(APlayerController* PlayerController = nullptr);
@@ -93,28 +133,59 @@ public:
 	void SetOverlayWidgetClass(TSubclassOf<UOmniDebugOverlayWidget> NewOverlayWidgetClass);
 
 private:
-	void TrimToMaxEntries();
 	void SyncDebugModeFromConsole();
 	static EOmniDebugMode ToDebugMode(int32 ConsoleValue);
-	static FString BuildTimestampUtc();
+	void RefreshEnabledLevelMask();
+	FOmniDebugRecord* PushRecord(EOmniDebugLevel Level, FName Category, FName Source);
+	bool PrepareStagedRecord(FOmniDebugRecord& Record, EOmniDebugLevel Level, FName Category, FName Source);
+	void SetRecordText(FOmniDebugRecord& Record, FString&& Text);
+	FStringView FindRecordText(const FOmniDebugRecord& Record) const;
+	bool ReserveStagedSlot();
+	void StageMetric(FName Key, const FString& Value, bool bRemove);
+	void DrainStaged();
 	APlayerController* ResolveLocalPlayerController(APlayerController* Preferred) const;
 
 private:
-	UPROPERTY()
-	TArray<FOmniDebugEntry> Entries;
+	struct FStagedRecord
+	{
+		FOmniDebugRecord Record;
+		FString Text;
+	};
+
+	struct FStagedMetric
+	{
+		FName Key = NAME_None;
+		FString Value;
+		bool bRemove = false;
+	};
+
+	TOmniRingBuffer<FOmniDebugRecord> Entries;
+	// Text of unstructured entries, same capacity as Entries so every live record still finds its text.
+	TOmniRingBuffer<FString> EntryTexts;
+	uint64 LastEntryTextSequence = 0;
+	TMpscQueue<FStagedRecord> StagedRecords;
+	TMpscQueue<FStagedMetric> StagedMetrics;
+	std::atomic<int32> StagedCount{0};
+	std::atomic<int32> DroppedStagedCount{0};
+	std::atomic<float> CachedWorldTimeSeconds{0.0f};
 
 	UPROPERTY()
 	TMap<FName, FString> LiveMetrics;
 
+	FOmniMetricRegistry MetricRegistry;
+
 	UPROPERTY(EditAnywhere, Category = "Omni|Debug")
 	EOmniDebugMode DebugMode = EOmniDebugMode::Basic;
 
-	UPROPERTY(EditAnywhere, Category = "Omni|Debug", meta = (ClampMin = "10", UIMin = "10"))
+	UPROPERTY(EditAnywhere, Category = "Omni|Debug", meta = (ClampMin = "10", UIMin = "10", ClampMax = "100000", UIMax = "20000"))
 	int32 MaxEntries = 200;
 
 	UPROPERTY()
 	int32 Revision = 0;
 
+	uint64 LastRecordSequence = 0;
+	std::atomic<uint8> EnabledLevelMask{0};
+
 	UPROPERTY(EditAnywhere, Category = "Omni|Debug|Overlay")
 	TSubclassOf<UOmniDebugOverlayWidget> OverlayWidgetClass;
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FOmniDiagnosticDecision
+{
+	bool bEmit = true;
+	// Repeats swallowed since the previous emitted occurrence of the same key.
+	int32 SuppressedCount = 0;
+
+	// " (+N repeticoes suprimidas)" when something was swallowed, empty otherwise.
+	OMNIRUNTIME_API FString GetSuppressedSuffix() const;
+};
+
+// Process-wide dedup for diagnostics that can fire at frame rate. The first occurrence of a
+// (category, message id, args hash) key is emitted; repeats inside the window (omni.diag.window) are
+// only counted and the count is handed to the next occurrence that lands after the window. Counts still
+// pending when a window expires without a new occurrence are logged by FlushExpired (module ticker) or Reset.
+// Callers should check the gate before building message text so suppressed repeats stay cheap.
+class OMNIRUNTIME_API FOmniDiagnosticGate
+{
+public:
+	static FOmniDiagnosticGate& Get();
+
+	FOmniDiagnosticDecision Check(FName Category, FName MessageId, uint32 ArgsHash = 0);
+	void FlushExpired();
+	void Reset();
+
+	template <typename... ArgTypes>
+	static uint32 HashArgs(const ArgTypes&... Args)
+	{
+		uint32 Hash = 0;
+		((Hash = HashCombineFast(Hash, GetTypeHash(Args))), ...);
+		return Hash;
+	}
+
+private:
+	struct FKey
+	{
+		FName Category = NAME_None;
+		FName MessageId = NAME_None;
+		uint32 ArgsHash = 0;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Category == Other.Category && MessageId == Other.MessageId && ArgsHash == Other.ArgsHash;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(HashCombineFast(GetTypeHash(Key.Category), GetTypeHash(Key.MessageId)), Key.ArgsHash);
+		}
+	};
+
+	struct FState
+	{
+		double WindowStartSeconds = 0.0;
+		int32 SuppressedCount = 0;
+	};
+
+	void PruneExpired(double NowSeconds, double WindowSeconds);
+
+	FCriticalSection Lock;
+	TMap<FKey, FState> States;
+};
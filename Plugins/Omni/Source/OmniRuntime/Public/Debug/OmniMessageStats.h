@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+enum class EOmniMessageKind : uint8
+{
+	Command,
+	Query,
+	Event
+};
+
+struct FOmniMessageStatsSnapshot
+{
+	EOmniMessageKind Kind = EOmniMessageKind::Command;
+	FName TargetSystem = NAME_None;
+	FName MessageName = NAME_None;
+	uint64 Calls = 0;
+	uint64 Failures = 0;
+	uint64 ValidationRejects = 0;
+	double TotalMs = 0.0;
+	double MaxMs = 0.0;
+	TArray<uint64> BucketCounts;
+
+	double GetAverageMs() const
+	{
+		return Calls > 0 ? TotalMs / static_cast<double>(Calls) : 0.0;
+	}
+
+	// Upper bound (ms) of the histogram bucket holding the given percentile; MaxMs for the overflow bucket.
+	OMNIRUNTIME_API double EstimatePercentileMs(double Percentile) const;
+	OMNIRUNTIME_API static const TCHAR* LexKind(EOmniMessageKind Kind);
+};
+
+// Per-(kind, target, message) dispatch counters. Entries live in a fixed open-addressing table that is
+// filled with CAS, and every counter is a relaxed atomic, so recording never takes a lock.
+// Entries are never freed before destruction; Reset only zeroes their counters.
+class OMNIRUNTIME_API FOmniMessageStats
+{
+public:
+	static constexpr int32 Capacity = 1024;
+	static constexpr int32 NumBucketBounds = 13;
+	static constexpr int32 NumBuckets = NumBucketBounds + 1;
+
+	struct FEntry
+	{
+		EOmniMessageKind Kind = EOmniMessageKind::Command;
+		FName TargetSystem = NAME_None;
+		FName MessageName = NAME_None;
+		std::atomic<uint64> Calls{0};
+		std::atomic<uint64> Failures{0};
+		std::atomic<uint64> ValidationRejects{0};
+		std::atomic<uint64> TotalCycles{0};
+		std::atomic<uint64> MaxCycles{0};
+		std::atomic<uint64> BucketCounts[NumBuckets] = {};
+	};
+
+	FOmniMessageStats();
+	~FOmniMessageStats();
+	FOmniMessageStats(const FOmniMessageStats&) = delete;
+	FOmniMessageStats& operator=(const FOmniMessageStats&) = delete;
+
+	// Null only when the table is full; callers pass the result straight to Record*.
+	FEntry* FindOrAdd(EOmniMessageKind Kind, FName TargetSystem, FName MessageName);
+
+	void RecordCall(FEntry* Entry, uint64 Cycles, bool bSuccess) const;
+	static void RecordReject(FEntry* Entry);
+
+	void Reset();
+	// Sorted by total handler time, descending.
+	void GetSnapshot(TArray<FOmniMessageStatsSnapshot>& OutSnapshot) const;
+
+	static TConstArrayView<double> GetBucketUpperBoundsMs();
+
+private:
+	std::atomic<FEntry*> Slots[Capacity];
+	uint64 BucketUpperBoundCycles[NumBucketBounds];
+};
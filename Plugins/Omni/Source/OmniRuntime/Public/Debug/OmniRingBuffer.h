@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Fixed-capacity FIFO: Push overwrites the oldest element once full. Logical index 0 is the oldest element.
+template <typename ElementType>
+class TOmniRingBuffer
+{
+public:
+	class FConstIterator
+	{
+	public:
+		FConstIterator(const TOmniRingBuffer& InBuffer, const int32 InLogicalIndex)
+			: Buffer(InBuffer)
+			, LogicalIndex(InLogicalIndex)
+		{
+		}
+
+		const ElementType& operator*() const
+		{
+			return Buffer[LogicalIndex];
+		}
+
+		const ElementType* operator->() const
+		{
+			return &Buffer[LogicalIndex];
+		}
+
+		FConstIterator& operator++()
+		{
+			++LogicalIndex;
+			return *this;
+		}
+
+		bool operator!=(const FConstIterator& Other) const
+		{
+			return LogicalIndex != Other.LogicalIndex;
+		}
+
+	private:
+		const TOmniRingBuffer& Buffer;
+		int32 LogicalIndex = 0;
+	};
+
+	class FConstRange
+	{
+	public:
+		FConstRange(const TOmniRingBuffer& InBuffer, const int32 InFirst, const int32 InLast)
+			: Buffer(InBuffer)
+			, First(InFirst)
+			, Last(InLast)
+		{
+		}
+
+		FConstIterator begin() const
+		{
+			return FConstIterator(Buffer, First);
+		}
+
+		FConstIterator end() const
+		{
+			return FConstIterator(Buffer, Last);
+		}
+
+		int32 Num() const
+		{
+			return Last - First;
+		}
+
+	private:
+		const TOmniRingBuffer& Buffer;
+		int32 First = 0;
+		int32 Last = 0;
+	};
+
+	explicit TOmniRingBuffer(const int32 InCapacity = 1)
+		: Capacity(FMath::Max(1, InCapacity))
+	{
+	}
+
+	int32 Num() const
+	{
+		return Storage.Num();
+	}
+
+	int32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	const ElementType& operator[](const int32 LogicalIndex) const
+	{
+		check(LogicalIndex >= 0 && LogicalIndex < Storage.Num());
+		const int32 PhysicalIndex = Head + LogicalIndex;
+		return Storage[PhysicalIndex < Capacity ? PhysicalIndex : PhysicalIndex - Capacity];
+	}
+
+	ElementType& Push(ElementType&& Element)
+	{
+		if (Storage.Num() < Capacity)
+		{
+			return Storage.Add_GetRef(MoveTemp(Element));
+		}
+
+		ElementType& Slot = Storage[Head];
+		Slot = MoveTemp(Element);
+		Head = Head + 1 < Capacity ? Head + 1 : 0;
+		return Slot;
+	}
+
+	void Reset()
+	{
+		Storage.Reset();
+		Head = 0;
+	}
+
+	void SetCapacity(const int32 NewCapacity)
+	{
+		const int32 ClampedCapacity = FMath::Max(1, NewCapacity);
+		if (ClampedCapacity == Capacity)
+		{
+			return;
+		}
+
+		const int32 KeepCount = FMath::Min(Storage.Num(), ClampedCapacity);
+		TArray<ElementType> Linearized;
+		Linearized.Reserve(KeepCount);
+		for (int32 LogicalIndex = Storage.Num() - KeepCount; LogicalIndex < Storage.Num(); ++LogicalIndex)
+		{
+			const int32 PhysicalIndex = Head + LogicalIndex;
+			Linearized.Add(MoveTemp(Storage[PhysicalIndex < Capacity ? PhysicalIndex : PhysicalIndex - Capacity]));
+		}
+
+		Storage = MoveTemp(Linearized);
+		Head = 0;
+		Capacity = ClampedCapacity;
+	}
+
+	FConstRange GetAll() const
+	{
+		return FConstRange(*this, 0, Storage.Num());
+	}
+
+	FConstRange GetTail(const int32 MaxCount) const
+	{
+		const int32 Count = FMath::Clamp(MaxCount, 0, Storage.Num());
+		return FConstRange(*this, Storage.Num() - Count, Storage.Num());
+	}
+
+private:
+	TArray<ElementType> Storage;
+	int32 Capacity = 1;
+	int32 Head = 0;
+};
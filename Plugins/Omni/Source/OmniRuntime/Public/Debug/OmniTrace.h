@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Standalone trace of the Omni layer in Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+// Scopes are written as complete ("X") events; with OMNI_WITH_TRACE=0 they compile to empty inlines.
+#ifndef OMNI_WITH_TRACE
+#define OMNI_WITH_TRACE !UE_BUILD_SHIPPING
+#endif
+
+class OMNIRUNTIME_API FOmniTrace
+{
+public:
+	static bool Start(const FString& FilePath, FString& OutError);
+	static void Stop();
+	static FString GetFilePath();
+	static int64 GetEventCount();
+
+	FORCEINLINE static bool IsActive()
+	{
+		return bActive.load(std::memory_order_relaxed);
+	}
+
+	static void WriteCompleteEvent(
+		const TCHAR* Category,
+		FName Name,
+		uint64 StartCycles,
+		uint64 EndCycles,
+		TConstArrayView<TPair<FName, FString>> Args
+	);
+
+private:
+	static std::atomic<bool> bActive;
+};
+
+#if OMNI_WITH_TRACE
+
+class FOmniTraceScope
+{
+public:
+	FOmniTraceScope(const TCHAR* InCategory, const FName InName)
+		: bActive(FOmniTrace::IsActive())
+	{
+		if (bActive)
+		{
+			Category = InCategory;
+			Name = InName;
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	~FOmniTraceScope()
+	{
+		if (bActive)
+		{
+			FOmniTrace::WriteCompleteEvent(Category, Name, StartCycles, FPlatformTime::Cycles64(), Args);
+		}
+	}
+
+	// Guard argument building with IsActive() so an idle trace costs one relaxed load per scope.
+	FORCEINLINE bool IsActive() const
+	{
+		return bActive;
+	}
+
+	void AddArg(const FName Key, FString Value)
+	{
+		Args.Emplace(Key, MoveTemp(Value));
+	}
+
+	void AddArgs(const TMap<FName, FString>& Values)
+	{
+		for (const TPair<FName, FString>& Pair : Values)
+		{
+			Args.Emplace(Pair.Key, Pair.Value);
+		}
+	}
+
+private:
+	bool bActive = false;
+	const TCHAR* Category = nullptr;
+	FName Name = NAME_None;
+	uint64 StartCycles = 0;
+	TArray<TPair<FName, FString>, TInlineAllocator<4>> Args;
+};
+
+#else
+
+class FOmniTraceScope
+{
+public:
+	FOmniTraceScope(const TCHAR*, FName)
+	{
+	}
+
+	FORCEINLINE bool IsActive() const
+	{
+		return false;
+	}
+
+	void AddArg(FName, const FString&)
+	{
+	}
+
+	void AddArgs(const TMap<FName, FString>&)
+	{
+	}
+};
+
+#endif
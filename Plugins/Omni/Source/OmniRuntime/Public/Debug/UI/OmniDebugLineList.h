@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "OmniDebugLineList.generated.h"
+
+class ITableRow;
+class STableViewBase;
+template <typename ItemType>
+class SListView;
+
+struct FOmniDebugLine
+{
+	// Owner-defined identity (record sequence for log lines); the list itself never reads it.
+	uint64 Id = 0;
+	FText Text;
+};
+
+// Virtualized line list: only rows scrolled into view get a Slate widget, and each row reads its
+// cached FText, so owners only rebuild lines that were appended or actually changed.
+UCLASS()
+class OMNIRUNTIME_API UOmniDebugLineList : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+	TArray<TSharedPtr<FOmniDebugLine>>& GetLines();
+	void RequestRefresh(bool bScrollToEnd);
+	void SetFontSize(int32 NewFontSize);
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+protected:
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+private:
+	TSharedRef<ITableRow> HandleGenerateRow(TSharedPtr<FOmniDebugLine> Line, const TSharedRef<STableViewBase>& OwnerTable);
+
+private:
+	UPROPERTY(EditAnywhere, Category = "Omni|Debug|Overlay", meta = (ClampMin = "8", UIMin = "8"))
+	int32 FontSize = 10;
+
+	TArray<TSharedPtr<FOmniDebugLine>> Lines;
+	TSharedPtr<SListView<TSharedPtr<FOmniDebugLine>>> ListView;
+};
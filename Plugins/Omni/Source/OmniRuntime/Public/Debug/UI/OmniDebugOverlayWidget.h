@@ -4,8 +4,19 @@
 #include "Blueprint/UserWidget.h"
 #include "OmniDebugOverlayWidget.generated.h"
 
+class UOmniDebugLineList;
 class UOmniDebugSubsystem;
 class UTextBlock;
+struct FOmniDebugLine;
+struct FOmniDebugRecord;
+
+struct FOmniDebugOverlayMetricLine
+{
+	FName Key = NAME_None;
+	FString Value;
+	TSharedPtr<FOmniDebugLine> Line;
+	uint32 SeenStamp = 0;
+};
 
 UCLASS()
 class OMNIRUNTIME_API UOmniDebugOverlayWidget : public UUserWidget
@@ -29,7 +40,11 @@ protected:
 private:
 	void EnsureWidgetTreeBuilt();
 	FText BuildHeaderText() const;
-	FText BuildBodyText() const;
+	void ResetLines();
+	void RefreshLogLines();
+	void RefreshMetricLines();
+	void UpdateMetricLine(FOmniDebugOverlayMetricLine& MetricLine, FName Key, const FString& Value, bool& bOutLayoutChanged) const;
+	FText BuildLogLineText(const FOmniDebugRecord& Record) const;
 
 private:
 	UPROPERTY(EditAnywhere, Category = "Omni|Debug|Overlay", meta = (ClampMin = "8", UIMin = "8"))
@@ -39,7 +54,7 @@ private:
 	int32 BodyFontSize = 10;
 
 	UPROPERTY(EditAnywhere, Category = "Omni|Debug|Overlay", meta = (ClampMin = "1", UIMin = "1"))
-	int32 MaxVisibleEntries = 20;
+	int32 MaxVisibleEntries = 200;
 
 	UPROPERTY(EditAnywhere, Category = "Omni|Debug|Overlay", meta = (ClampMin = "0.05", UIMin = "0.05"))
 	float RefreshIntervalSeconds = 0.2f;
@@ -51,11 +66,19 @@ private:
 	TObjectPtr<UTextBlock> HeaderText = nullptr;
 
 	UPROPERTY(Transient, meta = (BindWidgetOptional))
-	TObjectPtr<UTextBlock> BodyText = nullptr;
+	TObjectPtr<UOmniDebugLineList> MetricsList = nullptr;
+
+	UPROPERTY(Transient, meta = (BindWidgetOptional))
+	TObjectPtr<UOmniDebugLineList> LogList = nullptr;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UOmniDebugSubsystem> DebugSubsystem = nullptr;
 
 	FTimerHandle RefreshTimerHandle;
 	int32 LastSeenRevision = INDEX_NONE;
+	uint32 LastSeenMetricRevision = MAX_uint32;
+	uint64 LastBuiltSequence = 0;
+	uint32 MetricSeenStamp = 0;
+	TMap<FName, FOmniDebugOverlayMetricLine> TextMetricLines;
+	TMap<int32, FOmniDebugOverlayMetricLine> NumericMetricLines;
 };
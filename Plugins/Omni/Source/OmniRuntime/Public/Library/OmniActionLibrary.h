@@ -13,6 +13,12 @@ class OMNIRUNTIME_API UOmniActionLibrary : public UPrimaryDataAsset
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Omni|ActionGate")
 	TArray<FOmniActionDefinition> Definitions;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
 
 UCLASS(BlueprintType)
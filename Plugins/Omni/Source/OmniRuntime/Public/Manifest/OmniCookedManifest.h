@@ -0,0 +1,185 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Omni cooked manifests are written in native little-endian byte order.");
+
+// Flat image of a Forge-resolved manifest, read in place from a file mapping (no parsing).
+// File layout (all fields little-endian, every section 8-byte aligned):
+//   Header     : Magic u32 | Version u16 | HeaderSize u16 | FileSize u32 | ForgeVersion u32 | BuildVersion i32
+//                | Namespace/GenerationRoot/InputHash string indices | { Offset u32 | Count u32 } per section
+//   Strings    : { Offset u32 | Length u32 }* into StringData
+//   StringData : UTF-8 bytes, each string null-terminated
+//   Systems    : FSystemRecord*, sorted by SystemId; dependencies are system indices in Refs
+//   InitOrder  : u32 system indices, already topologically sorted by Forge
+//   Profiles   : FProfileRecord*
+//   Actions    : FActionRecord*, sorted by ActionId; BlockedBy/AppliesLocks are tag indices and Cancels
+//                action indices, all in Refs
+//   Tags       : u32 string indices of the unique gameplay tag names
+//   Refs       : u32 pool addressed by FRange
+//   LockBlocks / CancelClosure : u64 bit matrices over action indices (FOmniActionGraph), one row of
+//                ceil(Actions/64) words per action; both empty when the image has no actions
+namespace OmniCookedManifestFormat
+{
+	static constexpr uint32 Magic = 0x4D434D4F; // "OMCM"
+	static constexpr uint16 Version = 2;
+	static constexpr uint32 InvalidIndex = MAX_uint32;
+	static constexpr uint32 SectionAlignment = 8;
+	static constexpr TCHAR DefaultFileName[] = TEXT("ResolvedManifest.omnibin");
+
+	struct FSection
+	{
+		uint32 Offset = 0;
+		uint32 Count = 0;
+	};
+
+	struct FRange
+	{
+		uint32 First = 0;
+		uint32 Count = 0;
+	};
+
+	struct FStringEntry
+	{
+		uint32 Offset = 0;
+		uint32 Length = 0;
+	};
+
+	struct FSystemRecord
+	{
+		uint32 SystemId = InvalidIndex;
+		uint32 ClassPath = InvalidIndex;
+		FRange Dependencies;
+	};
+
+	struct FProfileRecord
+	{
+		uint32 SystemIndex = InvalidIndex;
+		uint32 SettingKey = InvalidIndex;
+		uint32 ProfileAssetPath = InvalidIndex;
+		uint32 ProfileClassPath = InvalidIndex;
+		uint32 LibraryAssetPath = InvalidIndex;
+		uint32 LibraryClassPath = InvalidIndex;
+	};
+
+	struct FActionRecord
+	{
+		uint32 ActionId = InvalidIndex;
+		uint8 bEnabled = 0;
+		uint8 Policy = 0;
+		uint16 Reserved = 0;
+		FRange BlockedBy;
+		FRange Cancels;
+		FRange AppliesLocks;
+
+		EOmniActionPolicy GetPolicy() const
+		{
+			return static_cast<EOmniActionPolicy>(Policy);
+		}
+	};
+
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint16 Version = 0;
+		uint16 HeaderSize = 0;
+		uint32 FileSize = 0;
+		uint32 ForgeVersion = 0;
+		int32 BuildVersion = 0;
+		uint32 Namespace = InvalidIndex;
+		uint32 GenerationRoot = InvalidIndex;
+		uint32 InputHash = InvalidIndex;
+		FSection Strings;
+		FSection StringData;
+		FSection Systems;
+		FSection InitOrder;
+		FSection Profiles;
+		FSection Actions;
+		FSection Tags;
+		FSection Refs;
+		FSection LockBlocks;
+		FSection CancelClosure;
+	};
+
+	static_assert(sizeof(FSystemRecord) == 16, "FSystemRecord layout is part of the file format.");
+	static_assert(sizeof(FProfileRecord) == 24, "FProfileRecord layout is part of the file format.");
+	static_assert(sizeof(FActionRecord) == 32, "FActionRecord layout is part of the file format.");
+	static_assert(sizeof(FHeader) == 112, "FHeader layout is part of the file format.");
+}
+
+// Read-only view over a cooked manifest image. Open maps the file and checks the header and section
+// bounds; accessors return views into the mapping and bounds-check individual indices.
+class OMNIRUNTIME_API FOmniCookedManifest
+{
+public:
+	FOmniCookedManifest();
+	~FOmniCookedManifest();
+
+	FOmniCookedManifest(const FOmniCookedManifest&) = delete;
+	FOmniCookedManifest& operator=(const FOmniCookedManifest&) = delete;
+
+	// Content/Omni/ResolvedManifest.omnibin, where a default Forge run writes the image. Content/Omni is listed in
+	// DirectoriesToAlwaysStageAsNonUFS, so packaged builds ship the file loose and can still map it.
+	static FString GetDefaultFilePath();
+
+	// Empty -> GetDefaultFilePath(); relative paths are resolved against the project directory.
+	static FString ResolveFilePath(const FString& ConfiguredPath);
+
+	bool Open(const FString& FilePath, FString& OutError);
+	void Close();
+	bool IsOpen() const;
+	bool IsMemoryMapped() const;
+	const FString& GetFilePath() const;
+	int64 GetImageSize() const;
+
+	uint32 GetForgeVersion() const;
+	int32 GetBuildVersion() const;
+	FUtf8StringView GetNamespace() const;
+	FUtf8StringView GetGenerationRoot() const;
+	FUtf8StringView GetInputHash() const;
+	bool MatchesInputHash(FStringView InputHash) const;
+
+	FUtf8StringView GetString(uint32 StringIndex) const;
+	FString GetStringAsFString(uint32 StringIndex) const;
+	FName GetStringAsName(uint32 StringIndex) const;
+
+	TConstArrayView<OmniCookedManifestFormat::FSystemRecord> GetSystems() const;
+	TConstArrayView<uint32> GetInitializationOrder() const;
+	TConstArrayView<OmniCookedManifestFormat::FProfileRecord> GetProfiles() const;
+	TConstArrayView<OmniCookedManifestFormat::FActionRecord> GetActions() const;
+	// String index per tag index.
+	TConstArrayView<uint32> GetTags() const;
+	TConstArrayView<uint32> GetRefs(const OmniCookedManifestFormat::FRange& Range) const;
+	TConstArrayView<uint64> GetActionLockBlocks() const;
+	TConstArrayView<uint64> GetActionCancelClosure() const;
+
+private:
+	bool ValidateImage(FString& OutError) const;
+
+	template <typename RecordType>
+	TConstArrayView<RecordType> GetSection(const OmniCookedManifestFormat::FSection& Section) const
+	{
+		if (!Header)
+		{
+			return TConstArrayView<RecordType>();
+		}
+
+		return TConstArrayView<RecordType>(reinterpret_cast<const RecordType*>(Data + Section.Offset), Section.Count);
+	}
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	// Fallback when the platform cannot map the file.
+	TArray64<uint8> LoadedBytes;
+	FString FilePath;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	const OmniCookedManifestFormat::FHeader* Header = nullptr;
+};
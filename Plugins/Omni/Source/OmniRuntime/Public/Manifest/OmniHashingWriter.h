@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/Blake3.h"
+#include "Hash/xxhash.h"
+#include "Serialization/Archive.h"
+
+enum class EOmniHashKind : uint8
+{
+	None = 0,
+	// BLAKE3-256: durable content ids (InputHash) that are persisted and compared across runs.
+	Durable = 1 << 0,
+	// XXH3-64: cache keys, where speed matters more than collision resistance.
+	Fast = 1 << 1
+};
+ENUM_CLASS_FLAGS(EOmniHashKind);
+
+// Write-only archive for canonical serialization. Bytes are staged in a small buffer, fed to the requested
+// incremental hashers and forwarded to an optional downstream archive (e.g. a file writer), so a document can be
+// hashed and written while it is produced, without ever existing as a whole string.
+class OMNIRUNTIME_API FOmniHashingWriter : public FArchive
+{
+public:
+	explicit FOmniHashingWriter(EOmniHashKind InHashKinds, FArchive* InDownstream = nullptr);
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual void Flush() override;
+	virtual FString GetArchiveName() const override;
+
+	// Flushes pending bytes; valid once, after the document is complete.
+	FString FinalizeDurableHex();
+	uint64 FinalizeFast();
+
+	int64 GetBytesWritten() const
+	{
+		return BytesWritten;
+	}
+
+	static FString FastHashToHex(uint64 Hash);
+
+private:
+	static constexpr int32 BufferCapacity = 4096;
+
+	void FlushBuffer();
+
+	EOmniHashKind HashKinds = EOmniHashKind::None;
+	FArchive* Downstream = nullptr;
+	FBlake3 DurableHasher;
+	FXxHash64Builder FastHasher;
+	TArray<uint8, TInlineAllocator<BufferCapacity>> Buffer;
+	int64 BytesWritten = 0;
+};
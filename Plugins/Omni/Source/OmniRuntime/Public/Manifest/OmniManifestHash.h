@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UOmniManifest;
+
+// BLAKE3-256 hex of the canonical form of a manifest (enabled entries, trimmed ids, sorted dependencies and settings).
+// Forge stores it as InputHash; the registry recomputes it to check that a cooked manifest is still current.
+struct OMNIRUNTIME_API FOmniManifestHash
+{
+	static bool ComputeInputHash(const UOmniManifest& Manifest, FString& OutHash);
+};
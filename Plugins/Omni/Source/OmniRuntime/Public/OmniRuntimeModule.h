@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "Modules/ModuleManager.h"
 
 class FOmniRuntimeModule final : public IModuleInterface
@@ -7,4 +8,8 @@ class FOmniRuntimeModule final : public IModuleInterface
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	FTSTicker::FDelegateHandle DiagnosticFlushHandle;
+	FDelegateHandle PackageReloadedHandle;
 };
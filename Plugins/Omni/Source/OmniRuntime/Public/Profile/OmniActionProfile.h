@@ -8,19 +8,51 @@
 
 class UOmniActionLibrary;
 
+using FOmniResolvedActionDefinitions = TSharedPtr<const TArray<FOmniActionDefinition>, ESPMode::ThreadSafe>;
+
 UCLASS(BlueprintType)
 class OMNIRUNTIME_API UOmniActionProfile : public UPrimaryDataAsset
 {
 	GENERATED_BODY()
 
 public:
+	// Empty inherits the nearest library set along the parent chain.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Omni|ActionGate")
 	TSoftObjectPtr<UOmniActionLibrary> ActionLibrary;
 
+	// Overrides of this profile apply on top of the parent's resolved definitions (base -> mode -> difficulty).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Omni|ActionGate")
+	TSoftObjectPtr<UOmniActionProfile> ParentProfile;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Omni|ActionGate")
 	TArray<FOmniActionDefinition> OverrideDefinitions;
 
+	static constexpr int32 MaxParentDepth = 16;
+
 	void ResolveDefinitions(TArray<FOmniActionDefinition>& OutDefinitions) const;
+
+	// Merged definitions, resolved once per profile and shared until a profile or library is edited.
+	FOmniResolvedActionDefinitions GetResolvedDefinitions() const;
+
+	// Root first, this profile last. False (with the chain walked so far) on a missing parent, a cycle or a
+	// chain deeper than MaxParentDepth.
+	bool TryGetProfileChain(TArray<const UOmniActionProfile*>& OutChain, FString& OutError) const;
+
+	TSoftObjectPtr<UOmniActionLibrary> GetEffectiveActionLibrary() const;
+
+	// Drops every cached resolve; call after changing profile or library contents from code.
+	static void InvalidateResolvedDefinitions();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	mutable FCriticalSection ResolvedDefinitionsLock;
+	mutable FOmniResolvedActionDefinitions ResolvedDefinitions;
+	mutable uint32 ResolvedGeneration = 0;
 };
 
 UCLASS(BlueprintType)
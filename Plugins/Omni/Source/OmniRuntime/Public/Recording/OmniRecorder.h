@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Recording/OmniRecording.h"
+
+class IFileHandle;
+
+// Append-only binary capture of registry traffic. Records of one tick form a frame; frames are
+// delta-encoded into ~64 KB chunks, and the chunk index is appended when the recording is closed.
+class OMNIRUNTIME_API FOmniRecorder
+{
+public:
+	FOmniRecorder();
+	~FOmniRecorder();
+
+	bool Open(const FString& FilePath, FString& OutError);
+	void Close();
+	bool IsOpen() const;
+	const FString& GetFilePath() const;
+
+	void RecordBegin(int64 TickIndex, double SimTime, const TMap<FName, FString>& Metadata);
+	void RecordTick(int64 TickIndex, float DeltaTime, double SimTime);
+	void RecordCommand(int64 TickIndex, const FOmniCommandMessage& Command, bool bExternal, bool bDuringTick);
+	void RecordQuery(int64 TickIndex, const FOmniQueryMessage& Query, bool bExternal, bool bDuringTick);
+	void RecordEvent(int64 TickIndex, const FOmniEventMessage& Event, bool bExternal, bool bDuringTick);
+	void RecordStateHash(int64 TickIndex, FName SystemId, uint64 Hash);
+
+	int64 GetRecordCount() const;
+	int64 GetBytesWritten() const;
+	int32 GetChunkCount() const;
+
+private:
+	void BeginRecord(int64 TickIndex, uint8 Header);
+	uint32 WriteNameRef(FName Name);
+	void WriteArguments(uint8 Kind, uint32 MessageNameId, const TMap<FName, FString>& Arguments);
+	void FlushFrame();
+	void FlushChunk();
+	void WriteToFile(const TArray<uint8>& Bytes);
+
+private:
+	TUniquePtr<IFileHandle> FileHandle;
+	FString FilePath;
+
+	TArray<uint8> FrameBuffer;
+	TArray<uint8> ChunkBuffer;
+	TArray<FOmniRecordingChunkInfo> ChunkIndex;
+
+	// Per-chunk encoder state, reset on every chunk flush.
+	TMap<FName, uint32> ChunkNameIds;
+	TMap<uint64, FString> LastArgumentValues;
+	float LastDeltaTime = 0.0f;
+	bool bHasLastDeltaTime = false;
+	int64 ChunkFirstTick = 0;
+	int64 ChunkLastTick = 0;
+	int64 PreviousFrameTick = 0;
+	int32 ChunkFrameCount = 0;
+
+	int64 FrameTick = 0;
+	int32 FrameRecordCount = 0;
+	bool bHasOpenFrame = false;
+
+	int64 RecordCount = 0;
+	int64 BytesWritten = 0;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/OmniSystemMessaging.h"
+
+class IFileHandle;
+
+enum class EOmniRecordKind : uint8
+{
+	Tick = 0,
+	Command = 1,
+	Query = 2,
+	Event = 3,
+	// Per-system SaveState digest taken after the registry ticked (or at recording start).
+	StateHash = 4,
+	// Recording start marker; Arguments hold session metadata (manifest, clock tick).
+	Begin = 5
+};
+
+struct FOmniRecordingChunkInfo
+{
+	int64 FirstTick = 0;
+	int64 LastTick = 0;
+	int64 Offset = 0;
+	int32 FrameCount = 0;
+};
+
+struct OMNIRUNTIME_API FOmniRecordedMessage
+{
+	EOmniRecordKind Kind = EOmniRecordKind::Tick;
+	// True when the message entered the registry from outside any system handler/tick (replayable input).
+	bool bExternal = false;
+	// True when the message was sent while the registry was ticking systems (e.g. input sampled in TickSystem).
+	bool bDuringTick = false;
+	float DeltaTime = 0.0f;
+	double SimTime = 0.0;
+	uint64 StateHash = 0;
+	FName SourceSystem = NAME_None;
+	// StateHash records: the hashed system.
+	FName TargetSystem = NAME_None;
+	FName MessageName = NAME_None;
+
+	void SetArgument(FName Key, const FString& Value);
+	bool TryGetArgument(FName Key, FString& OutValue) const;
+
+	FOmniCommandMessage ToCommand() const;
+	FOmniQueryMessage ToQuery() const;
+	FOmniEventMessage ToEvent() const;
+
+private:
+	TMap<FName, FString> Arguments;
+};
+
+struct FOmniRecordedFrame
+{
+	int64 TickIndex = 0;
+	TArray<FOmniRecordedMessage> Records;
+};
+
+class OMNIRUNTIME_API FOmniRecordingReader
+{
+public:
+	FOmniRecordingReader();
+	~FOmniRecordingReader();
+
+	bool Open(const FString& FilePath, FString& OutError);
+	void Close();
+	bool IsOpen() const;
+
+	const TArray<FOmniRecordingChunkInfo>& GetChunks() const;
+	// Chunks are written in tick order, so this is a binary search on the chunk index.
+	int32 FindChunkForTick(int64 TickIndex) const;
+	bool ReadChunk(int32 ChunkIndex, TArray<FOmniRecordedFrame>& OutFrames, FString& OutError);
+	bool ReadAllFrames(TArray<FOmniRecordedFrame>& OutFrames, FString& OutError);
+
+private:
+	bool ReadIndexFromFooter();
+	bool RebuildIndexByScanning(FString& OutError);
+
+private:
+	TUniquePtr<IFileHandle> FileHandle;
+	int64 FileSize = 0;
+	TArray<FOmniRecordingChunkInfo> Chunks;
+};
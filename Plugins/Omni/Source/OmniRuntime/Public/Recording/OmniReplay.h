@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Recording/OmniRecording.h"
+
+class UOmniClockSubsystem;
+class UOmniManifest;
+class UOmniSystemRegistrySubsystem;
+
+struct OMNIRUNTIME_API FOmniReplayResult
+{
+	bool bDiverged = false;
+	int64 DivergedTick = INDEX_NONE;
+	FName DivergedSystem = NAME_None;
+	uint64 ExpectedHash = 0;
+	uint64 ActualHash = 0;
+
+	int64 TicksReplayed = 0;
+	int64 MessagesReplayed = 0;
+	int64 HashesCompared = 0;
+	double ElapsedSeconds = 0.0;
+	FString Error;
+
+	FString Describe() const;
+};
+
+// Feeds the external messages of a recording back into a registry, driving its clock from the
+// recorded sim time, and compares every recorded per-system state hash. Stops at the first mismatch.
+// The registry must not be ticked by the engine meanwhile (use a standalone game instance).
+class OMNIRUNTIME_API FOmniReplayHarness
+{
+public:
+	FOmniReplayHarness(UOmniSystemRegistrySubsystem& InRegistry, UOmniClockSubsystem& InClock);
+
+	// Returns false when the recording could not be replayed (OutResult.Error); a divergence still returns true.
+	bool Run(FOmniRecordingReader& Reader, FOmniReplayResult& OutResult, UOmniManifest* ManifestOverride = nullptr);
+
+private:
+	bool RestartSession(const FOmniRecordedMessage& BeginRecord, UOmniManifest* ManifestOverride, FString& OutError);
+	void ReplayMessage(const FOmniRecordedMessage& Record);
+	bool MatchesStateHash(int64 TickIndex, const FOmniRecordedMessage& Record, FOmniReplayResult& OutResult) const;
+
+	static bool IsReplayedInput(const FOmniRecordedMessage& Record);
+
+private:
+	UOmniSystemRegistrySubsystem& Registry;
+	UOmniClockSubsystem& Clock;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OmniReplayCommandlet.generated.h"
+
+// Headless determinism check. Usage:
+//   -run=OmniReplay -Recording=<file.omnirec|folder> [-Manifest=<object path>]
+//   -run=OmniReplay -SelfCheck [-Recording=<file.omnirec>] [-Manifest=<object path>]
+// -SelfCheck first records a scripted sprint session driven by Movement retry and lazy Status timers, then
+// replays it. Returns the number of recordings that diverged or failed to replay.
+UCLASS()
+class OMNIRUNTIME_API UOmniReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOmniReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+#include "Serialization/Archive.h"
+
+class UOmniRuntimeSystem;
+
+// Saving archive that streams everything written to it into an XXH64 digest instead of a buffer.
+// Names are hashed by their string so digests are stable across processes.
+class OMNIRUNTIME_API FOmniStateHashWriter : public FArchive
+{
+public:
+	FOmniStateHashWriter();
+
+	virtual void Serialize(void* Data, int64 Num) override;
+	virtual FArchive& operator<<(FName& Value) override;
+	virtual FArchive& operator<<(UObject*& Value) override;
+	virtual FString GetArchiveName() const override;
+
+	uint64 GetHash() const;
+
+	static uint64 HashSystemState(UOmniRuntimeSystem& System);
+
+private:
+	FXxHash64Builder Builder;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+#include "Systems/ActionGate/OmniActionGraph.h"
+
+class FOmniActionDefinitionTable;
+
+using FOmniActionDefinitionTablePtr = TSharedPtr<const FOmniActionDefinitionTable, ESPMode::ThreadSafe>;
+
+// Resolved action definitions of one profile, immutable once built: definitions sorted by ActionId, the id index
+// and the action graph over the same order. Tables are interned by content hash, so every ActionGate in the
+// process that resolves the same content (from assets, the cooked manifest or a compiled table) shares one copy.
+// Holds no UObject references and lives outside the GC.
+class OMNIRUNTIME_API FOmniActionDefinitionTable
+{
+public:
+	// Duplicate ids keep the last definition; empty ids are dropped. PrebuiltGraph is adopted instead of building
+	// the graph when it covers the definitions in sorted order (the cooked manifest layout).
+	static FOmniActionDefinitionTablePtr FindOrCreate(
+		TArray<FOmniActionDefinition>&& Definitions,
+		const FOmniActionGraph* PrebuiltGraph = nullptr
+	);
+
+	// Tables currently alive in the process.
+	static int32 GetSharedTableCount();
+
+	int32 Num() const
+	{
+		return Definitions.Num();
+	}
+
+	uint64 GetContentHash() const
+	{
+		return ContentHash;
+	}
+
+	const TArray<FName>& GetSortedActionIds() const
+	{
+		return SortedActionIds;
+	}
+
+	const FOmniActionGraph& GetGraph() const
+	{
+		return Graph;
+	}
+
+	// Index into the sorted order shared with the graph; INDEX_NONE when unknown.
+	int32 FindIndex(const FName ActionId) const
+	{
+		const int32* Index = IndexById.Find(ActionId);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	const FOmniActionDefinition* Find(const FName ActionId) const
+	{
+		const int32 Index = FindIndex(ActionId);
+		return Index != INDEX_NONE ? &Definitions[Index] : nullptr;
+	}
+
+private:
+	uint64 ContentHash = 0;
+	TArray<FOmniActionDefinition> Definitions;
+	TArray<FName> SortedActionIds;
+	TMap<FName, int32> IndexById;
+	FOmniActionGraph Graph;
+};
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Debug/OmniDebugMetrics.h"
 #include "GameplayTagContainer.h"
 #include "Systems/OmniRuntimeSystem.h"
 #include "Systems/ActionGate/OmniActionGateTypes.h"
+#include "Systems/ActionGate/OmniActionDefinitionTable.h"
 #include "OmniActionGateSystem.generated.h"
 
+class FOmniCookedManifest;
+struct FOmniCompiledActionTable;
 class UOmniManifest;
 class UOmniSystemRegistrySubsystem;
 class UOmniDebugSubsystem;
@@ -24,6 +28,7 @@ public:
 	virtual bool HandleCommand_Implementation(const FOmniCommandMessage& Command) override;
 	virtual bool HandleQuery_Implementation(FOmniQueryMessage& Query) override;
 	virtual void HandleEvent_Implementation(const FOmniEventMessage& Event) override;
+	virtual void SaveState(FArchive& Ar) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Omni|ActionGate")
 	bool TryStartAction(FName ActionId, FOmniActionGateDecision& OutDecision);
@@ -46,22 +51,35 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Omni|ActionGate")
 	FOmniActionGateDecision GetLastDecision() const;
 
+	UFUNCTION(BlueprintPure, Category = "Omni|ActionGate")
+	static FString GetDecisionReasonText(const FOmniActionGateDecision& Decision);
+
 private:
 	bool TryLoadDefinitionsFromManifest(const UOmniManifest* Manifest, FString& OutError);
-	void RebuildDefinitionMap();
-	void BroadcastActionLifecycleEvent(FName EventName, FName ActionId, const FString& Reason = FString(), FName EndReason = NAME_None);
-	FGameplayTagContainer BuildCurrentBlockingContext() const;
+	bool TryLoadDefinitionsFromCookedManifest(const FOmniCookedManifest& CookedManifest, FString& OutError);
+	bool TryLoadDefinitionsFromCompiledTable(const FOmniCompiledActionTable& Table, FString& OutError);
+	const FOmniActionDefinition* FindDefinition(FName ActionId) const;
+	int32 GetKnownActionCount() const;
+	void AssignDefinitions(TArray<FOmniActionDefinition>&& LoadedDefinitions, const FOmniActionGraph* CookedGraph = nullptr);
+	void BroadcastActionLifecycleEvent(
+		FName EventName,
+		FName ActionId,
+		EOmniActionGateReason ReasonCode = EOmniActionGateReason::None,
+		const FString& Reason = FString(),
+		FName EndReason = NAME_None
+	);
+	FGameplayTagContainer BuildCurrentBlockingContext(bool bIncludeActiveLocks) const;
 	bool EvaluateStartAction(FName ActionId, FOmniActionGateDecision& OutDecision, bool bApplyChanges);
+	void ReportUnknownAction(FName ActionId) const;
 	static bool TryParseActionId(const FOmniQueryMessage& Query, FName& OutActionId);
 	void AddActionLocks(const FOmniActionDefinition& Definition);
 	void RemoveActionLocks(const FOmniActionDefinition& Definition);
+	void RegisterMetrics();
+	void UnregisterMetrics();
 	void PublishTelemetry();
 	void PublishDecision(const FOmniActionGateDecision& Decision, bool bEmitLogEntry);
 
 private:
-	UPROPERTY(EditDefaultsOnly, Category = "Omni|ActionGate")
-	TArray<FOmniActionDefinition> DefaultDefinitions;
-
 	UPROPERTY(Transient)
 	FString ResolvedProfileName;
 
@@ -72,7 +90,7 @@ private:
 	FString ResolvedLibraryAssetPath;
 
 	UPROPERTY(Transient)
-	TMap<FName, FOmniActionDefinition> DefinitionsById;
+	FName ResolvedProfileFName = NAME_None;
 
 	UPROPERTY(Transient)
 	TSet<FName> ActiveActions;
@@ -91,4 +109,15 @@ private:
 
 	UPROPERTY(Transient)
 	bool bInitialized = false;
+
+	FOmniMetricHandle KnownActionsMetric;
+	FOmniMetricHandle ActiveActionsMetric;
+	FOmniMetricHandle ActiveLocksMetric;
+	FOmniMetricHandle AllowedCountMetric;
+	FOmniMetricHandle DeniedCountMetric;
+
+	// Shared with every ActionGate in the process that resolved the same definitions; never mutated.
+	FOmniActionDefinitionTablePtr DefinitionTable;
+	// Indexed like the table. Per action: how many active actions hold a lock that matches one of its BlockedBy tags.
+	TArray<int32> ActiveLockBlockCounts;
 };
@@ -12,6 +12,24 @@ enum class EOmniActionPolicy : uint8
 	RestartIfActive UMETA(DisplayName = "Restart If Active")
 };
 
+UENUM(BlueprintType)
+enum class EOmniActionGateReason : uint8
+{
+	None UMETA(DisplayName = "None"),
+	Allowed UMETA(DisplayName = "Allowed"),
+	NotInitialized UMETA(DisplayName = "Not Initialized"),
+	UnknownAction UMETA(DisplayName = "Unknown Action"),
+	AlreadyActiveDenied UMETA(DisplayName = "Already Active (Deny)"),
+	AlreadyActiveSucceeded UMETA(DisplayName = "Already Active (Succeed)"),
+	Restarted UMETA(DisplayName = "Restarted"),
+	BlockedByTag UMETA(DisplayName = "Blocked By Tag")
+};
+
+OMNIRUNTIME_API const TCHAR* LexToString(EOmniActionGateReason Reason);
+
+// Human-readable reason with FString::Format placeholders: {0}=ActionId, {1}=ReasonArg (BlockedByTag: the blocking tags).
+OMNIRUNTIME_API const TCHAR* GetReasonTextPattern(EOmniActionGateReason Reason);
+
 USTRUCT(BlueprintType)
 struct FOmniActionDefinition
 {
@@ -37,7 +55,7 @@ struct FOmniActionDefinition
 };
 
 USTRUCT(BlueprintType)
-struct FOmniActionGateDecision
+struct OMNIRUNTIME_API FOmniActionGateDecision
 {
 	GENERATED_BODY()
 
@@ -48,11 +66,31 @@ struct FOmniActionGateDecision
 	bool bAllowed = false;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Omni|ActionGate")
-	FString Reason;
+	EOmniActionGateReason ReasonCode = EOmniActionGateReason::None;
+
+	// UnknownAction: resolved profile name.
+	UPROPERTY(BlueprintReadOnly, Category = "Omni|ActionGate")
+	FName ReasonArg = NAME_None;
+
+	// BlockedByTag: every BlockedBy tag that matched the current blocking context.
+	UPROPERTY(BlueprintReadOnly, Category = "Omni|ActionGate")
+	FGameplayTagContainer BlockingTags;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Omni|ActionGate")
 	EOmniActionPolicy Policy = EOmniActionPolicy::DenyIfActive;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Omni|ActionGate")
 	TArray<FName> CanceledActions;
+
+	FString BuildReasonText() const;
+	FName GetReasonTextArg() const;
+
+	bool IsSameOutcome(const FOmniActionGateDecision& Other) const
+	{
+		return ActionId == Other.ActionId
+			&& bAllowed == Other.bAllowed
+			&& ReasonCode == Other.ReasonCode
+			&& ReasonArg == Other.ReasonArg
+			&& BlockingTags == Other.BlockingTags;
+	}
 };
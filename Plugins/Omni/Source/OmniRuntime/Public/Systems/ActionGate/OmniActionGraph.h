@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+
+struct FOmniActionGraphNode
+{
+	EOmniActionPolicy Policy = EOmniActionPolicy::DenyIfActive;
+	TArray<FName> BlockedBy;
+	// Action indices; out-of-range entries are ignored.
+	TArray<int32> Cancels;
+	TArray<FName> AppliesLocks;
+};
+
+struct FOmniActionGraphIssues
+{
+	// Sorted action indices of each cancel cycle with three or more actions, or a single self-canceling action.
+	// Two actions canceling each other are plain mutual exclusion and are not reported.
+	TArray<TArray<int32>> CancelCycles;
+	// RestartIfActive actions blocked by their own locks, or lying on a reported cancel cycle.
+	TArray<int32> RestartLoops;
+};
+
+// Pairwise relations over a fixed action set, stored as row-major bit matrices (bit B of row A):
+//   LockBlocks    : a lock applied by A matches a BlockedBy tag of B (same tag or an ancestor of it).
+//   CancelClosure : B is reachable from A through Cancels.
+// Forge computes the graph and cooks it; ActionGate answers "is B blocked by an active lock" with a counter.
+class OMNIRUNTIME_API FOmniActionGraph
+{
+public:
+	static void Build(TConstArrayView<FOmniActionGraphNode> Nodes, FOmniActionGraph& OutGraph, FOmniActionGraphIssues* OutIssues = nullptr);
+
+	static int32 GetWordsPerRow(const int32 ActionCount)
+	{
+		return (ActionCount + 63) / 64;
+	}
+
+	// Adopts precomputed matrices (e.g. from a cooked manifest); false when their sizes do not fit ActionCount.
+	bool Assign(int32 InActionCount, TConstArrayView<uint64> InLockBlocks, TConstArrayView<uint64> InCancelClosure);
+	void Reset();
+
+	int32 Num() const
+	{
+		return ActionCount;
+	}
+
+	bool IsEmpty() const
+	{
+		return ActionCount == 0;
+	}
+
+	bool LockBlocks(const int32 Locker, const int32 Blocked) const
+	{
+		return TestBit(LockBlocksBits, Locker, Blocked);
+	}
+
+	bool Cancels(const int32 Canceler, const int32 Target) const
+	{
+		return TestBit(CancelClosureBits, Canceler, Target);
+	}
+
+	TConstArrayView<uint64> GetLockBlocksRow(const int32 Locker) const
+	{
+		return GetRow(LockBlocksBits, Locker);
+	}
+
+	TConstArrayView<uint64> GetCancelClosureRow(const int32 Canceler) const
+	{
+		return GetRow(CancelClosureBits, Canceler);
+	}
+
+	const TArray<uint64>& GetLockBlocksBits() const
+	{
+		return LockBlocksBits;
+	}
+
+	const TArray<uint64>& GetCancelClosureBits() const
+	{
+		return CancelClosureBits;
+	}
+
+	template <typename FunctionType>
+	static void ForEachSetBit(const TConstArrayView<uint64> Row, FunctionType&& Function)
+	{
+		for (int32 WordIndex = 0; WordIndex < Row.Num(); ++WordIndex)
+		{
+			uint64 Word = Row[WordIndex];
+			while (Word != 0)
+			{
+				const int32 BitIndex = static_cast<int32>(FMath::CountTrailingZeros64(Word));
+				Function(WordIndex * 64 + BitIndex);
+				Word &= Word - 1;
+			}
+		}
+	}
+
+private:
+	bool TestBit(const TArray<uint64>& Bits, const int32 Row, const int32 Column) const
+	{
+		if (static_cast<uint32>(Row) >= static_cast<uint32>(ActionCount) || static_cast<uint32>(Column) >= static_cast<uint32>(ActionCount))
+		{
+			return false;
+		}
+		return (Bits[Row * WordsPerRow + Column / 64] >> (Column % 64)) & 1;
+	}
+
+	TConstArrayView<uint64> GetRow(const TArray<uint64>& Bits, const int32 Row) const
+	{
+		if (static_cast<uint32>(Row) >= static_cast<uint32>(ActionCount))
+		{
+			return TConstArrayView<uint64>();
+		}
+		return TConstArrayView<uint64>(Bits.GetData() + Row * WordsPerRow, WordsPerRow);
+	}
+
+private:
+	int32 ActionCount = 0;
+	int32 WordsPerRow = 0;
+	TArray<uint64> LockBlocksBits;
+	TArray<uint64> CancelClosureBits;
+};
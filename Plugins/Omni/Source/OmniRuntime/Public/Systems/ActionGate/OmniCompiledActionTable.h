@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/ActionGate/OmniActionGateTypes.h"
+
+// Action definitions compiled into a game module from source that Forge generates (omni.forge.run code=<dir>).
+// Everything is a constant table of literals: ActionGate builds its definitions from it without parsing,
+// hashing or loading the profile assets. Only use it with frozen content; rerun Forge when the library changes.
+struct FOmniCompiledRange
+{
+	uint32 First = 0;
+	uint32 Count = 0;
+};
+
+struct FOmniCompiledActionRecord
+{
+	const TCHAR* ActionId = nullptr;
+	bool bEnabled = true;
+	EOmniActionPolicy Policy = EOmniActionPolicy::DenyIfActive;
+	// Tag indices into FOmniCompiledActionTable::TagNames.
+	FOmniCompiledRange BlockedBy;
+	// Action indices into FOmniCompiledActionTable::Actions.
+	FOmniCompiledRange Cancels;
+	// Tag indices into FOmniCompiledActionTable::TagNames.
+	FOmniCompiledRange AppliesLocks;
+};
+
+struct FOmniCompiledActionTable
+{
+	const TCHAR* Namespace = nullptr;
+	int32 BuildVersion = 0;
+	const TCHAR* InputHash = nullptr;
+	const TCHAR* ProfileAssetPath = nullptr;
+	const TCHAR* LibraryAssetPath = nullptr;
+	const FOmniCompiledActionRecord* Actions = nullptr;
+	int32 ActionCount = 0;
+	const TCHAR* const* TagNames = nullptr;
+	int32 TagCount = 0;
+	const uint32* Refs = nullptr;
+	int32 RefCount = 0;
+
+	TConstArrayView<FOmniCompiledActionRecord> GetActions() const
+	{
+		return TConstArrayView<FOmniCompiledActionRecord>(Actions, ActionCount);
+	}
+
+	TConstArrayView<const TCHAR*> GetTagNames() const
+	{
+		return TConstArrayView<const TCHAR*>(TagNames, TagCount);
+	}
+
+	TConstArrayView<uint32> GetRefs(const FOmniCompiledRange& Range) const
+	{
+		if (static_cast<uint64>(Range.First) + Range.Count > static_cast<uint64>(RefCount))
+		{
+			return TConstArrayView<uint32>();
+		}
+		return TConstArrayView<uint32>(Refs + Range.First, Range.Count);
+	}
+};
+
+// Process-wide list of compiled tables, keyed by manifest Namespace and BuildVersion. Generated headers register
+// their table during static initialization through FOmniCompiledActionTableRegistrar.
+class OMNIRUNTIME_API FOmniCompiledActionTables
+{
+public:
+	static void Register(const FOmniCompiledActionTable& Table);
+	static void Unregister(const FOmniCompiledActionTable& Table);
+	static const FOmniCompiledActionTable* Find(FName Namespace, int32 BuildVersion);
+};
+
+struct FOmniCompiledActionTableRegistrar
+{
+	explicit FOmniCompiledActionTableRegistrar(const FOmniCompiledActionTable& InTable)
+		: Table(InTable)
+	{
+		FOmniCompiledActionTables::Register(Table);
+	}
+
+	~FOmniCompiledActionTableRegistrar()
+	{
+		FOmniCompiledActionTables::Unregister(Table);
+	}
+
+	UE_NONCOPYABLE(FOmniCompiledActionTableRegistrar);
+
+private:
+	const FOmniCompiledActionTable& Table;
+};
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Debug/OmniDebugMetrics.h"
 #include "Systems/Movement/OmniMovementData.h"
 #include "Systems/OmniRuntimeSystem.h"
+#include "Systems/OmniTimerWheel.h"
 #include "OmniMovementSystem.generated.h"
 
 class UOmniManifest;
@@ -22,7 +24,9 @@ public:
 	virtual void ShutdownSystem_Implementation() override;
 	virtual bool IsTickEnabled_Implementation() const override;
 	virtual void TickSystem_Implementation(float DeltaTime) override;
+	virtual bool HandleCommand_Implementation(const FOmniCommandMessage& Command) override;
 	virtual void HandleEvent_Implementation(const FOmniEventMessage& Event) override;
+	virtual void SaveState(FArchive& Ar) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Omni|Movement")
 	void SetSprintRequested(bool bRequested);
@@ -47,13 +51,19 @@ private:
 	bool BuildDevFallbackSettings();
 	void StartSprinting();
 	void StopSprinting(FName Reason);
+	void RegisterMetrics();
+	void UnregisterMetrics();
 	void PublishTelemetry() const;
-	double GetNowSeconds() const;
 	bool QueryStatusIsExhausted() const;
 	void DispatchStatusSprinting(bool bSprinting) const;
 	bool QueryCanStartSprint(FString* OutReason = nullptr) const;
 	bool DispatchStartSprint() const;
 	bool DispatchStopSprint(FName Reason) const;
+	void ScheduleStartRetry();
+	void ClearStartRetry();
+	void ClearAutoSprint();
+	void HandleStartRetryElapsed();
+	void HandleAutoSprintElapsed();
 
 private:
 	UPROPERTY(Transient)
@@ -65,11 +75,8 @@ private:
 	UPROPERTY(Transient)
 	bool bIsSprinting = false;
 
-	UPROPERTY(Transient)
-	float NextStartAttemptWorldTime = 0.0f;
-
-	UPROPERTY(Transient)
-	float AutoSprintRemainingSeconds = 0.0f;
+	FOmniTimerHandle StartRetryTimerHandle;
+	FOmniTimerHandle AutoSprintTimerHandle;
 
 	UPROPERTY(Transient)
 	bool bObservedSprintStartedEvent = false;
@@ -85,4 +92,8 @@ private:
 
 	UPROPERTY(Transient)
 	TWeakObjectPtr<UOmniDebugSubsystem> DebugSubsystem;
+
+	FOmniMetricHandle SprintRequestedMetric;
+	FOmniMetricHandle IsSprintingMetric;
+	FOmniMetricHandle AutoSprintRemainingMetric;
 };
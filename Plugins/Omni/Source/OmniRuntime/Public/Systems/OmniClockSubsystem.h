@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Tickable.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Systems/OmniTimerWheel.h"
 #include "OmniClockSubsystem.generated.h"
 
 UCLASS()
@@ -28,6 +29,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Omni|Clock")
 	void ResetClock();
 
+	// Manual stepping ignores engine ticks; the owner advances the clock with StepTo (headless replay).
+	void SetManualStepping(bool bEnabled);
+	bool IsManualStepping() const;
+	void StepTo(double NewSimTimeSeconds);
+
+	// True while StepTo runs timer callbacks; messages they send are system-originated, not external input.
+	bool IsDispatchingTimers() const;
+
+	FOmniTimerHandle SetTimer(double DelaySeconds, FOmniTimerDelegate Callback);
+	bool ClearTimer(FOmniTimerHandle& Handle);
+	bool IsTimerActive(const FOmniTimerHandle& Handle) const;
+	double GetTimerRemaining(const FOmniTimerHandle& Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Omni|Clock")
+	int32 GetActiveTimerCount() const;
+
 private:
 	UPROPERTY(EditAnywhere, Category = "Omni|Clock")
 	bool bUseWorldTimeProvider = true;
@@ -37,4 +54,10 @@ private:
 
 	UPROPERTY(Transient)
 	int64 TickIndex = 0;
+
+	UPROPERTY(Transient)
+	bool bManualStepping = false;
+
+	int32 TimerDispatchDepth = 0;
+	FOmniTimerWheel TimerWheel;
 };
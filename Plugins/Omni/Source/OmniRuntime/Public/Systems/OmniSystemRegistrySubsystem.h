@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Tickable.h"
+#include "Debug/OmniDebugMetrics.h"
+#include "Debug/OmniMessageStats.h"
+#include "Manifest/OmniCookedManifest.h"
+#include "Recording/OmniRecorder.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Systems/OmniSystemMessaging.h"
 #include "UObject/SoftObjectPath.h"
@@ -10,6 +14,7 @@
 class UOmniManifest;
 class UOmniRuntimeSystem;
 class UOmniDebugSubsystem;
+class UOmniClockSubsystem;
 
 UCLASS(Config = Game)
 class OMNIRUNTIME_API UOmniSystemRegistrySubsystem : public UGameInstanceSubsystem, public FTickableGameObject
@@ -52,9 +57,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Omni|Registry|Messaging")
 	void BroadcastEvent(const FOmniEventMessage& Event);
 
+	// For player/device input sampled inside a system tick: recorded as external so replays re-inject it.
+	UFUNCTION(BlueprintCallable, Category = "Omni|Registry|Messaging")
+	bool DispatchInputCommand(const FOmniCommandMessage& Command);
+
 	UFUNCTION(BlueprintPure, Category = "Omni|Registry")
 	bool IsDevDefaultsEnabled() const;
 
+	FOmniMessageStats& GetMessageStats();
+
+	// Forge cooked image mapped for the active manifest; null when absent, stale or disabled.
+	const FOmniCookedManifest* GetCookedManifest() const;
+
+	// Cooked manifest whose InputHash matches the live manifest while trust is enabled. Systems may take
+	// their definitions from it and skip the checks Forge already ran.
+	const FOmniCookedManifest* GetTrustedCookedManifest() const;
+
+	// FOmniManifestHash::ComputeInputHash of the manifest being initialized, computed once per
+	// InitializeFromManifest; empty when unavailable. Systems compare cooked data against it.
+	const FString& GetLiveInputHash() const;
+
+	// Replaces the configured cooked image and trust setting for later InitializeFromManifest calls (tools, benchmarks).
+	void SetCookedManifestSource(const FString& FilePath, bool bTrust);
+
+	// Empty FilePath records to Saved/Omni/Recordings/Omni_<timestamp>.omnirec.
+	UFUNCTION(BlueprintCallable, Category = "Omni|Registry|Recording")
+	bool StartRecording(const FString& FilePath);
+
+	UFUNCTION(BlueprintCallable, Category = "Omni|Registry|Recording")
+	void StopRecording();
+
+	UFUNCTION(BlueprintPure, Category = "Omni|Registry|Recording")
+	bool IsRecording() const;
+
+	UFUNCTION(BlueprintPure, Category = "Omni|Registry|Recording")
+	FString GetRecordingFilePath() const;
+
 private:
 	struct FResolvedSystemSpec
 	{
@@ -70,9 +108,16 @@ private:
 		const TMap<FName, FResolvedSystemSpec>& Specs,
 		TArray<FName>& OutInitializationOrder
 	) const;
+	bool TryGetCookedInitializationOrder(
+		const UOmniManifest* Manifest,
+		const TMap<FName, FResolvedSystemSpec>& Specs,
+		TArray<FName>& OutInitializationOrder
+	);
 	void ShutdownSystemsInternal(bool bLogSummary);
 	UOmniDebugSubsystem* TryGetDebugSubsystem() const;
 	void PublishRegistryDiagnostics(bool bManifestLoaded) const;
+	void RecordStateHashes();
+	bool IsExternalMessage() const;
 
 private:
 	UPROPERTY(Config, EditAnywhere, Category = "Omni|Registry")
@@ -90,6 +135,15 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = "Omni|Registry")
 	TArray<FSoftClassPath> FallbackSystemClasses;
 
+	// Forge cooked manifest image. Empty uses Content/Omni/ResolvedManifest.omnibin; relative to the project dir.
+	// A custom location must also be staged for packaged builds.
+	UPROPERTY(Config, EditAnywhere, Category = "Omni|Registry")
+	FString CookedManifestFile;
+
+	// Skip runtime profile validation when the cooked manifest's InputHash matches the live manifest.
+	UPROPERTY(Config, EditAnywhere, Category = "Omni|Registry")
+	bool bTrustVerifiedCookedManifest = false;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UOmniManifest> ActiveManifest = nullptr;
 
@@ -99,6 +153,25 @@ private:
 	UPROPERTY(Transient)
 	TMap<FName, TObjectPtr<UOmniRuntimeSystem>> SystemsById;
 
+	// Parallel to ActiveSystems; avoids the GetSystemId event call on hot paths.
+	TArray<FName> ActiveSystemIds;
+
 	UPROPERTY(Transient)
 	bool bRegistryInitialized = false;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UOmniClockSubsystem> ClockSubsystem;
+
+	FOmniMetricHandle TickTimeMetric;
+	FOmniMessageStats MessageStats;
+	FOmniCookedManifest CookedManifest;
+	bool bCookedManifestTrusted = false;
+	FString LiveInputHash;
+
+	TUniquePtr<FOmniRecorder> Recorder;
+	int64 RecordingTickIndex = 0;
+	// > 0 while a system handler or tick is running; messages sent at depth 0 are external inputs.
+	int32 MessageDepth = 0;
+	bool bTickInProgress = false;
+	bool bDispatchingInput = false;
 };
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_DELEGATE(FOmniTimerDelegate);
+
+struct OMNIRUNTIME_API FOmniTimerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	void Invalidate()
+	{
+		Index = INDEX_NONE;
+		Generation = 0;
+	}
+
+	bool operator==(const FOmniTimerHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+};
+
+// Hierarchical timing wheel (4 levels x 64 slots) over sim time quantized to TicksPerSecond.
+// Insert and cancel are O(1); Advance only touches due slots and cascades higher levels on wrap.
+// Expired timers fire once per Advance, ordered by (deadline, schedule order) for determinism.
+class OMNIRUNTIME_API FOmniTimerWheel
+{
+public:
+	static constexpr int32 NumLevels = 4;
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+
+	explicit FOmniTimerWheel(double InTicksPerSecond = 128.0);
+
+	FOmniTimerHandle Schedule(double NowSeconds, double DelaySeconds, FOmniTimerDelegate Callback);
+	bool Cancel(FOmniTimerHandle& Handle);
+	bool IsActive(const FOmniTimerHandle& Handle) const;
+	double GetRemainingSeconds(const FOmniTimerHandle& Handle, double NowSeconds) const;
+
+	int32 Advance(double NowSeconds);
+	void Rebase(double NowSeconds);
+	void Reset(double NowSeconds);
+
+	int32 Num() const;
+
+private:
+	struct FEntry
+	{
+		double DeadlineSeconds = 0.0;
+		uint64 DeadlineTick = 0;
+		uint64 Sequence = 0;
+		FOmniTimerDelegate Callback;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Slot = INDEX_NONE;
+		uint32 Generation = 0;
+		bool bActive = false;
+	};
+
+	struct FExpired
+	{
+		int32 Index = INDEX_NONE;
+		uint32 Generation = 0;
+	};
+
+	uint64 ToTickFloor(double Seconds) const;
+	uint64 ToTickCeil(double Seconds) const;
+	int32 AllocateEntry();
+	void FreeEntry(int32 Index);
+	void InsertEntry(int32 Index);
+	void LinkIntoSlot(int32 Index, int32 Slot);
+	void UnlinkFromSlot(int32 Index);
+	void CascadeSlot(int32 Level, int32 SlotInLevel);
+	void CollectSlot(int32 Slot);
+	const FEntry* FindEntry(const FOmniTimerHandle& Handle) const;
+
+private:
+	double TicksPerSecond = 128.0;
+	double CurrentSeconds = 0.0;
+	uint64 CurrentTick = 0;
+	uint64 NextSequence = 0;
+	int32 ActiveCount = 0;
+	int32 LinkedCount = 0;
+	int32 SlotHeads[NumLevels * SlotsPerLevel];
+	TArray<FEntry> Entries;
+	TArray<int32> FreeIndices;
+	TArray<FExpired> ExpiredScratch;
+};
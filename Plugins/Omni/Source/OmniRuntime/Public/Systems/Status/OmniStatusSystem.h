@@ -1,14 +1,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Debug/OmniDebugMetrics.h"
 #include "GameplayTagContainer.h"
 #include "Systems/Status/OmniStatusData.h"
 #include "Systems/OmniRuntimeSystem.h"
+#include "Systems/OmniTimerWheel.h"
 #include "OmniStatusSystem.generated.h"
 
 class UOmniManifest;
 class UOmniDebugSubsystem;
 class UOmniSystemRegistrySubsystem;
+class UOmniClockSubsystem;
 
 UCLASS()
 class OMNIRUNTIME_API UOmniStatusSystem : public UOmniRuntimeSystem
@@ -25,6 +28,7 @@ public:
 	virtual bool HandleCommand_Implementation(const FOmniCommandMessage& Command) override;
 	virtual bool HandleQuery_Implementation(FOmniQueryMessage& Query) override;
 	virtual void HandleEvent_Implementation(const FOmniEventMessage& Event) override;
+	virtual void SaveState(FArchive& Ar) override;
 
 	UFUNCTION(BlueprintPure, Category = "Omni|Status")
 	float GetCurrentStamina() const;
@@ -52,7 +56,24 @@ public:
 private:
 	bool TryLoadSettingsFromManifest(const UOmniManifest* Manifest, FString& OutError);
 	void UpdateStateTags();
+	void UpdateExhaustionState();
+	void RegisterMetrics();
+	void UnregisterMetrics();
 	void PublishTelemetry();
+	double GetNowSeconds() const;
+	void RestartRegenDelay();
+	void ClearRegenDelayTimer();
+	void HandleRegenDelayElapsed();
+
+	// Lazy mode: stamina is a piecewise-linear function of sim time anchored at the last segment start.
+	float EvaluateStaminaAt(double TimeSeconds) const;
+	void RebaseLazySegment(double NowSeconds);
+	void ScheduleNextLazyThreshold();
+	void ClearLazyThresholdTimer();
+	void HandleLazyThresholdReached();
+	void ScheduleLazyTelemetryRefresh();
+	void ClearLazyTelemetryTimer();
+	void HandleLazyTelemetryRefresh();
 
 private:
 	UPROPERTY(Transient)
@@ -67,8 +88,19 @@ private:
 	UPROPERTY(Transient)
 	bool bExhausted = false;
 
+	FOmniTimerHandle RegenDelayTimerHandle;
+
+	UPROPERTY(Transient)
+	bool bLazyEvaluation = false;
+
 	UPROPERTY(Transient)
-	float TimeSinceLastConsumption = 0.0f;
+	double LazySegmentStartTime = 0.0;
+
+	UPROPERTY(Transient)
+	double LazyRegenResumeTime = 0.0;
+
+	FOmniTimerHandle LazyThresholdTimerHandle;
+	FOmniTimerHandle LazyTelemetryTimerHandle;
 
 	UPROPERTY(Transient)
 	FGameplayTagContainer StateTags;
@@ -79,6 +111,14 @@ private:
 	UPROPERTY(Transient)
 	TWeakObjectPtr<UOmniSystemRegistrySubsystem> Registry;
 
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UOmniClockSubsystem> ClockSubsystem;
+
 	UPROPERTY(Transient)
 	TWeakObjectPtr<UOmniDebugSubsystem> DebugSubsystem;
+
+	FOmniMetricHandle StaminaMetric;
+	FOmniMetricHandle MaxStaminaMetric;
+	FOmniMetricHandle ExhaustedMetric;
+	FOmniMetricHandle SprintingMetric;
 };